@@ -100,6 +100,12 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_SSE42 "Build with SSE4.2 if compiler has support" ON)
 
+  define_option(ARROW_AVX2 "Build runtime dispatched AVX2 kernels if compiler has support"
+                ON)
+
+  define_option(ARROW_AVX512
+                "Build runtime dispatched AVX-512 kernels if compiler has support" ON)
+
   define_option(ARROW_ALTIVEC "Build with Altivec if compiler has support" ON)
 
   define_option(ARROW_RPATH_ORIGIN "Build Arrow libraries with RATH set to \$ORIGIN" OFF)
@@ -278,6 +284,10 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
   define_option(ARROW_WITH_ZLIB "Build with zlib compression" OFF)
   define_option(ARROW_WITH_ZSTD "Build with zstd compression" OFF)
 
+  define_option(ARROW_WITH_RE2
+                "Build with support for regular expressions using the re2 library"
+                OFF)
+
   #----------------------------------------------------------------------
   if(MSVC)
     set_option_category("MSVC")
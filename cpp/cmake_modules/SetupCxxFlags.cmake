@@ -20,6 +20,10 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+set(ARROW_AVX2_FLAG "-mavx2")
+check_cxx_compiler_flag(${ARROW_AVX2_FLAG} CXX_SUPPORTS_AVX2)
+set(ARROW_AVX512_FLAG "-mavx512f")
+check_cxx_compiler_flag(${ARROW_AVX512_FLAG} CXX_SUPPORTS_AVX512)
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
@@ -270,6 +274,18 @@ if(CXX_SUPPORTS_SSE4_2 AND ARROW_SSE42)
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} -msse4.2")
 endif()
 
+# AVX2 and AVX-512 are only enabled for the kernels dispatched at runtime
+# according to the CPU
+if(CXX_SUPPORTS_AVX2 AND ARROW_AVX2)
+  set(ARROW_HAVE_RUNTIME_AVX2 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+endif()
+
+if(CXX_SUPPORTS_AVX512 AND ARROW_AVX512)
+  set(ARROW_HAVE_RUNTIME_AVX512 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+endif()
+
 if(CXX_SUPPORTS_ALTIVEC AND ARROW_ALTIVEC)
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} -maltivec")
 endif()
@@ -70,10 +70,17 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Allow kernels to split their work across the CPU thread pool
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
+  /// \brief Return true if kernels may use the CPU thread pool (default true)
+  bool use_threads() const { return use_threads_; }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_ = true;
 };
 
 }  // namespace compute
@@ -40,6 +40,8 @@ class FunctionContext;
 /// For example given lhs = [1, null, 3], rhs = [4, 5, 6], the output
 /// will be [5, null, 7]
 ///
+/// See arithmetic.h for scalar operands and overflow checking.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] lhs the first array
 /// \param[in] rhs the second array
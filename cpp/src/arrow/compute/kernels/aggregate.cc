@@ -15,10 +15,15 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/table.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -49,10 +54,82 @@ class ManagedAggregateState {
   std::shared_ptr<Buffer> state_;
 };
 
+// Inputs shorter than this are aggregated on the calling thread.
+static constexpr int64_t kMinParallelLength = 1 << 16;
+// Chunks longer than this are split in several ranges when aggregating in
+// parallel.
+static constexpr int64_t kMaxRangeLength = 1 << 20;
+
+// Split the input in chunks, and large chunks in ranges of at most
+// kMaxRangeLength values.
+static std::vector<std::shared_ptr<Array>> SplitRanges(const Datum& input) {
+  ArrayVector chunks;
+  if (input.is_array()) {
+    chunks.push_back(input.make_array());
+  } else {
+    chunks = input.chunked_array()->chunks();
+  }
+
+  std::vector<std::shared_ptr<Array>> ranges;
+  for (const auto& chunk : chunks) {
+    for (int64_t offset = 0; offset < chunk->length(); offset += kMaxRangeLength) {
+      ranges.push_back(chunk->Slice(offset, kMaxRangeLength));
+    }
+  }
+  return ranges;
+}
+
+Status AggregateUnaryKernel::ParallelCall(FunctionContext* ctx,
+                                          const ArrayVector& ranges, Datum* out) {
+  const int num_tasks = std::min(static_cast<int>(ranges.size()),
+                                 internal::GetCpuThreadPool()->GetCapacity());
+
+  std::vector<std::shared_ptr<ManagedAggregateState>> task_states(num_tasks);
+  for (auto& task_state : task_states) {
+    task_state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+    if (!task_state) {
+      return Status::OutOfMemory("AggregateState allocation failed");
+    }
+  }
+
+  // Each task consumes every num_tasks-th range and merges it into its own
+  // state; task states are merged once all tasks are done.
+  auto consume_ranges = [&](int task) {
+    auto range_state =
+        ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+    if (!range_state) {
+      return Status::OutOfMemory("AggregateState allocation failed");
+    }
+    for (size_t i = task; i < ranges.size(); i += num_tasks) {
+      RETURN_NOT_OK(
+          aggregate_function_->Consume(*ranges[i], range_state->mutable_data()));
+      RETURN_NOT_OK(aggregate_function_->Merge(range_state->mutable_data(),
+                                               task_states[task]->mutable_data()));
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(internal::ParallelFor(num_tasks, consume_ranges));
+
+  for (int task = 1; task < num_tasks; ++task) {
+    RETURN_NOT_OK(aggregate_function_->Merge(task_states[task]->mutable_data(),
+                                             task_states[0]->mutable_data()));
+  }
+  return aggregate_function_->Finalize(task_states[0]->mutable_data(), out);
+}
+
 Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
   if (!input.is_arraylike()) {
     return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
   }
+
+  if (ctx->use_threads() && input.length() >= kMinParallelLength &&
+      internal::GetCpuThreadPool()->GetCapacity() > 1) {
+    auto ranges = SplitRanges(input);
+    if (ranges.size() > 1) {
+      return ParallelCall(ctx, ranges, out);
+    }
+  }
+
   auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
   if (!state) {
     return Status::OutOfMemory("AggregateState allocation failed");
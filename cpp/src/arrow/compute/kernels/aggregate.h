@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 
@@ -98,6 +99,10 @@ class AggregateFunctionStaticState : public AggregateFunction {
 };
 
 /// \brief UnaryKernel implemented by an AggregateState
+///
+/// When the FunctionContext allows it, large inputs are split in ranges
+/// (chunks, and slices of large chunks) consumed in parallel on the CPU
+/// thread pool, with per-task states merged before finalization.
 class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
  public:
   explicit AggregateUnaryKernel(std::shared_ptr<AggregateFunction>& aggregate)
@@ -108,6 +113,9 @@ class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
   std::shared_ptr<DataType> out_type() const override;
 
  private:
+  Status ParallelCall(FunctionContext* ctx,
+                      const std::vector<std::shared_ptr<Array>>& ranges, Datum* out);
+
   std::shared_ptr<AggregateFunction> aggregate_function_;
 };
 
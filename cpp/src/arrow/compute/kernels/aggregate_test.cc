@@ -326,6 +326,22 @@ TYPED_TEST(TestCountKernel, SimpleCount) {
   ValidateCount<TypeParam>(&this->ctx_, "[1, 2, 3, 4, 5, 6, 7, 8, 9]", {9, 0});
 }
 
+TYPED_TEST(TestCountKernel, ChunkedArrayCount) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto chunked_array = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(type, "[1, null, 2]"), ArrayFromJSON(type, "[]"),
+                  ArrayFromJSON(type, "[null, 3, 4]")});
+  Datum result;
+
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_ALL), chunked_array,
+                  &result));
+  AssertDatumsEqual(result, Datum(static_cast<int64_t>(4)));
+
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_NULL), chunked_array,
+                  &result));
+  AssertDatumsEqual(result, Datum(static_cast<int64_t>(2)));
+}
+
 template <typename ArrowType>
 class TestRandomNumericCountKernel : public ComputeFixture, public TestBase {};
 
@@ -397,5 +413,55 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIs("[5, -Inf, 2, 3, 4]", -INFINITY, 5, options);
 }
 
+///
+/// Parallel aggregation
+///
+
+class TestParallelAggregate : public ComputeFixture, public TestBase {
+ public:
+  // Aggregate `input` with and without threads and compare the results
+  template <typename AggregateFunc>
+  void AssertParallelMatchesSerial(const Datum& input, AggregateFunc&& aggregate) {
+    Datum serial, parallel;
+    this->ctx_.set_use_threads(false);
+    ASSERT_OK(aggregate(&this->ctx_, input, &serial));
+    this->ctx_.set_use_threads(true);
+    ASSERT_OK(aggregate(&this->ctx_, input, &parallel));
+    AssertDatumsEqual(serial, parallel);
+  }
+
+  void AssertAllAggregates(const Datum& input) {
+    AssertParallelMatchesSerial(input, [](FunctionContext* ctx, const Datum& value,
+                                          Datum* out) { return Sum(ctx, value, out); });
+    AssertParallelMatchesSerial(input, [](FunctionContext* ctx, const Datum& value,
+                                          Datum* out) { return Mean(ctx, value, out); });
+    AssertParallelMatchesSerial(
+        input, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+          return Count(ctx, CountOptions(CountOptions::COUNT_NULL), value, out);
+        });
+    AssertParallelMatchesSerial(
+        input, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+          return MinMax(ctx, MinMaxOptions(), value, out);
+        });
+  }
+};
+
+TEST_F(TestParallelAggregate, ChunkedArray) {
+  auto rand = random::RandomArrayGenerator(0x2c0a7e1);
+  ArrayVector chunks;
+  for (int64_t length : {0, 1, 1000, 1 << 16, 5, (1 << 17) + 3, 17}) {
+    chunks.push_back(rand.Int64(length, -1000, 1000, 0.1));
+  }
+  AssertAllAggregates(std::make_shared<ChunkedArray>(chunks));
+}
+
+TEST_F(TestParallelAggregate, LargeArray) {
+  // Split in several ranges of a single array
+  auto rand = random::RandomArrayGenerator(0x93bc2f1);
+  auto array = rand.Int32((1 << 21) + 11, -1000, 1000, 0.1);
+  AssertAllAggregates(array);
+  AssertAllAggregates(array->Slice(7));
+}
+
 }  // namespace compute
 }  // namespace arrow
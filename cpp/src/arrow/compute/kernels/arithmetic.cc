@@ -0,0 +1,460 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+template <typename T, typename R = T>
+using enable_if_signed_value =
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                            R>::type;
+
+template <typename T, typename R = T>
+using enable_if_unsigned_value =
+    typename std::enable_if<std::is_unsigned<T>::value, R>::type;
+
+template <typename T, typename R = T>
+using enable_if_integer_value =
+    typename std::enable_if<std::is_integral<T>::value, R>::type;
+
+template <typename T, typename R = T>
+using enable_if_floating_value =
+    typename std::enable_if<std::is_floating_point<T>::value, R>::type;
+
+// Wrapping integer arithmetic is done in the unsigned counterpart of the
+// promoted type, as signed overflow is undefined behaviour.
+template <typename T>
+using WrapType = typename std::make_unsigned<decltype(T() + T())>::type;
+
+template <typename T>
+T WrappingNegate(T value) {
+  return static_cast<T>(WrapType<T>(0) - static_cast<WrapType<T>>(value));
+}
+
+// ----------------------------------------------------------------------
+// Operators compute a single value and return whether they failed. When
+// kChecked is false, integer operators wrap around on overflow and only fail
+// where the hardware would trap, so that loops over them stay branch-free.
+
+struct OverflowError {
+  template <typename... T>
+  static Status Error(T...) {
+    return Status::Invalid("overflow");
+  }
+};
+
+struct AddOp : OverflowError {
+  template <bool kChecked, typename T>
+  static enable_if_integer_value<T, bool> Call(T left, T right, T* out) {
+    if (kChecked) {
+      return internal::AddWithOverflow(left, right, out);
+    }
+    *out = static_cast<T>(static_cast<WrapType<T>>(left) +
+                          static_cast<WrapType<T>>(right));
+    return false;
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_floating_value<T, bool> Call(T left, T right, T* out) {
+    *out = left + right;
+    return false;
+  }
+};
+
+struct SubtractOp : OverflowError {
+  template <bool kChecked, typename T>
+  static enable_if_integer_value<T, bool> Call(T left, T right, T* out) {
+    if (kChecked) {
+      return internal::SubtractWithOverflow(left, right, out);
+    }
+    *out = static_cast<T>(static_cast<WrapType<T>>(left) -
+                          static_cast<WrapType<T>>(right));
+    return false;
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_floating_value<T, bool> Call(T left, T right, T* out) {
+    *out = left - right;
+    return false;
+  }
+};
+
+struct MultiplyOp : OverflowError {
+  template <bool kChecked, typename T>
+  static enable_if_integer_value<T, bool> Call(T left, T right, T* out) {
+    if (kChecked) {
+      return internal::MultiplyWithOverflow(left, right, out);
+    }
+    *out = static_cast<T>(static_cast<WrapType<T>>(left) *
+                          static_cast<WrapType<T>>(right));
+    return false;
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_floating_value<T, bool> Call(T left, T right, T* out) {
+    *out = left * right;
+    return false;
+  }
+};
+
+struct DivideOp {
+  template <bool kChecked, typename T>
+  static enable_if_integer_value<T, bool> Call(T left, T right, T* out) {
+    if (right == 0) {
+      *out = 0;
+      return true;
+    }
+    if (std::is_signed<T>::value && right == static_cast<T>(-1)) {
+      // The minimum value divided by -1 traps on x86
+      *out = WrappingNegate(left);
+      return kChecked && left == std::numeric_limits<T>::min();
+    }
+    *out = static_cast<T>(left / right);
+    return false;
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_floating_value<T, bool> Call(T left, T right, T* out) {
+    *out = left / right;
+    return false;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return right == 0 ? Status::Invalid("divide by zero") : Status::Invalid("overflow");
+  }
+};
+
+struct NegateOp : OverflowError {
+  template <bool kChecked, typename T>
+  static enable_if_integer_value<T, bool> Call(T arg, T* out) {
+    if (kChecked) {
+      return internal::SubtractWithOverflow(static_cast<T>(0), arg, out);
+    }
+    *out = WrappingNegate(arg);
+    return false;
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_floating_value<T, bool> Call(T arg, T* out) {
+    *out = -arg;
+    return false;
+  }
+};
+
+struct AbsoluteValueOp : OverflowError {
+  template <bool kChecked, typename T>
+  static enable_if_signed_value<T, bool> Call(T arg, T* out) {
+    *out = arg < 0 ? WrappingNegate(arg) : arg;
+    return kChecked && arg == std::numeric_limits<T>::min();
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_unsigned_value<T, bool> Call(T arg, T* out) {
+    *out = arg;
+    return false;
+  }
+
+  template <bool kChecked, typename T>
+  static enable_if_floating_value<T, bool> Call(T arg, T* out) {
+    *out = std::fabs(arg);
+    return false;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Loops
+
+template <typename T>
+struct ArrayValues {
+  T operator[](int64_t i) const { return values[i]; }
+  const T* values;
+};
+
+template <typename T>
+struct ScalarValue {
+  T operator[](int64_t) const { return value; }
+  T value;
+};
+
+inline bool IsValid(const ArrayData& data, int64_t i) {
+  return data.buffers[0] == NULLPTR ||
+         BitUtil::GetBit(data.buffers[0]->data(), data.offset + i);
+}
+
+// Operators are applied to all slots, null or not, to keep the loops free
+// of branches on the validity bitmap. Failures are rare, so only once one
+// was seen is a second pass made to find a failing slot that is not null.
+
+template <typename Op, bool kChecked, typename T, typename Left, typename Right>
+Status ApplyBinary(Left left, Right right, ArrayData* out) {
+  T* out_values = out->GetMutableValues<T>(1);
+  const int64_t length = out->length;
+  bool failed = false;
+  for (int64_t i = 0; i < length; ++i) {
+    failed |= Op::template Call<kChecked>(left[i], right[i], &out_values[i]);
+  }
+  if (ARROW_PREDICT_TRUE(!failed)) {
+    return Status::OK();
+  }
+  T unused;
+  for (int64_t i = 0; i < length; ++i) {
+    if (IsValid(*out, i) && Op::template Call<kChecked>(left[i], right[i], &unused)) {
+      return Op::Error(left[i], right[i]);
+    }
+  }
+  return Status::OK();
+}
+
+template <typename Op, bool kChecked, typename T>
+Status ApplyUnary(const T* values, ArrayData* out) {
+  T* out_values = out->GetMutableValues<T>(1);
+  const int64_t length = out->length;
+  bool failed = false;
+  for (int64_t i = 0; i < length; ++i) {
+    failed |= Op::template Call<kChecked>(values[i], &out_values[i]);
+  }
+  if (ARROW_PREDICT_TRUE(!failed)) {
+    return Status::OK();
+  }
+  T unused;
+  for (int64_t i = 0; i < length; ++i) {
+    if (IsValid(*out, i) && Op::template Call<kChecked>(values[i], &unused)) {
+      return Op::Error(values[i]);
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Kernels
+
+template <typename ArrowType, typename Op>
+class BinaryArithmeticKernel : public BinaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  BinaryArithmeticKernel(std::shared_ptr<DataType> type, bool check_overflow)
+      : type_(std::move(type)), check_overflow_(check_overflow) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    ArrayData* out_data = out->array().get();
+
+    if (left.is_array() && right.is_array()) {
+      const ArrayData& left_data = *left.array();
+      const ArrayData& right_data = *right.array();
+      RETURN_NOT_OK(detail::AssignNullIntersection(ctx, left_data, right_data, out_data));
+      return Apply(ArrayValues<T>{left_data.GetValues<T>(1)},
+                   ArrayValues<T>{right_data.GetValues<T>(1)}, out_data);
+    }
+
+    if (left.is_array() && right.is_scalar()) {
+      const ArrayData& left_data = *left.array();
+      const auto& right_scalar = checked_cast<const ScalarType&>(*right.scalar());
+      RETURN_NOT_OK(AssignNulls(ctx, left_data, right_scalar, out_data));
+      return Apply(ArrayValues<T>{left_data.GetValues<T>(1)},
+                   ScalarValue<T>{right_scalar.value}, out_data);
+    }
+
+    if (left.is_scalar() && right.is_array()) {
+      const auto& left_scalar = checked_cast<const ScalarType&>(*left.scalar());
+      const ArrayData& right_data = *right.array();
+      RETURN_NOT_OK(AssignNulls(ctx, right_data, left_scalar, out_data));
+      return Apply(ScalarValue<T>{left_scalar.value},
+                   ArrayValues<T>{right_data.GetValues<T>(1)}, out_data);
+    }
+
+    return Status::Invalid("Invalid datum signature for arithmetic kernel");
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  static Status AssignNulls(FunctionContext* ctx, const ArrayData& array,
+                            const Scalar& scalar, ArrayData* out) {
+    return scalar.is_valid ? detail::PropagateNulls(ctx, array, out)
+                           : detail::SetAllNulls(ctx, array, out);
+  }
+
+  template <typename Left, typename Right>
+  Status Apply(Left left, Right right, ArrayData* out) {
+    return check_overflow_ ? ApplyBinary<Op, true, T>(left, right, out)
+                           : ApplyBinary<Op, false, T>(left, right, out);
+  }
+
+  std::shared_ptr<DataType> type_;
+  bool check_overflow_;
+};
+
+template <typename ArrowType, typename Op>
+class UnaryArithmeticKernel : public UnaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+
+  UnaryArithmeticKernel(std::shared_ptr<DataType> type, bool check_overflow)
+      : type_(std::move(type)), check_overflow_(check_overflow) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    if (!input.is_array()) {
+      return Status::Invalid("Invalid datum signature for arithmetic kernel");
+    }
+    const ArrayData& values = *input.array();
+    ArrayData* out_data = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, values, out_data));
+    return check_overflow_ ? ApplyUnary<Op, true>(values.GetValues<T>(1), out_data)
+                           : ApplyUnary<Op, false>(values.GetValues<T>(1), out_data);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  bool check_overflow_;
+};
+
+#define PROCESS_ARITHMETIC_TYPES(PROCESS) \
+  PROCESS(UInt8Type)                      \
+  PROCESS(Int8Type)                       \
+  PROCESS(UInt16Type)                     \
+  PROCESS(Int16Type)                      \
+  PROCESS(UInt32Type)                     \
+  PROCESS(Int32Type)                      \
+  PROCESS(UInt64Type)                     \
+  PROCESS(Int64Type)                      \
+  PROCESS(FloatType)                      \
+  PROCESS(DoubleType)
+
+template <template <typename, typename> class KernelType, typename Op,
+          typename KernelBase>
+Status MakeArithmeticKernel(const std::shared_ptr<DataType>& type, bool check_overflow,
+                            std::unique_ptr<KernelBase>* out) {
+  switch (type->id()) {
+#define PROCESS(ArrowType)                                         \
+  case ArrowType::type_id:                                         \
+    out->reset(new KernelType<ArrowType, Op>(type, check_overflow)); \
+    return Status::OK();
+
+    PROCESS_ARITHMETIC_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("Arithmetic operations on ", *type, " arrays");
+}
+
+#undef PROCESS_ARITHMETIC_TYPES
+
+template <typename Op>
+Status ExecBinary(FunctionContext* ctx, const Datum& left, const Datum& right,
+                  const ArithmeticOptions& options, Datum* out) {
+  const bool left_ok = left.is_array() || left.is_scalar();
+  const bool right_ok = right.is_array() || right.is_scalar();
+  if (!left_ok || !right_ok || (left.is_scalar() && right.is_scalar())) {
+    return Status::Invalid("Arithmetic kernels expect an array and an array or scalar");
+  }
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Arithmetic operands have differing types ", *left.type(),
+                             " and ", *right.type());
+  }
+  if (left.is_array() && right.is_array() && left.length() != right.length()) {
+    return Status::Invalid("Arithmetic operands have differing lengths");
+  }
+
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK((MakeArithmeticKernel<BinaryArithmeticKernel, Op>(
+      left.type(), options.check_overflow, &kernel)));
+
+  const int64_t length = left.is_array() ? left.length() : right.length();
+  out->value = ArrayData::Make(kernel->out_type(), length);
+  return detail::PrimitiveAllocatingBinaryKernel(kernel.get())
+      .Call(ctx, left, right, out);
+}
+
+template <typename Op>
+Status ExecUnary(FunctionContext* ctx, const Datum& values,
+                 const ArithmeticOptions& options, Datum* out) {
+  if (!values.is_array()) {
+    return Status::Invalid("Arithmetic kernels expect an array");
+  }
+
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeArithmeticKernel<UnaryArithmeticKernel, Op>(
+      values.type(), options.check_overflow, &kernel)));
+
+  out->value = ArrayData::Make(kernel->out_type(), values.length());
+  return detail::PrimitiveAllocatingUnaryKernel(kernel.get()).Call(ctx, values, out);
+}
+
+}  // namespace
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary<AddOp>(ctx, left, right, options, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary<SubtractOp>(ctx, left, right, options, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary<MultiplyOp>(ctx, left, right, options, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              const ArithmeticOptions& options, Datum* out) {
+  return ExecBinary<DivideOp>(ctx, left, right, options, out);
+}
+
+Status Negate(FunctionContext* ctx, const Datum& values,
+              const ArithmeticOptions& options, Datum* out) {
+  return ExecUnary<NegateOp>(ctx, values, options, out);
+}
+
+Status AbsoluteValue(FunctionContext* ctx, const Datum& values,
+                     const ArithmeticOptions& options, Datum* out) {
+  return ExecUnary<AbsoluteValueOp>(ctx, values, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
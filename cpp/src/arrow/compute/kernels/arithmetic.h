@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \class ArithmeticOptions
+///
+/// By default integer results wrap around on overflow, which lets the
+/// kernels run as branch-free loops the compiler can vectorize. With
+/// check_overflow, an overflow in any non-null slot is an error instead.
+/// Floating point arithmetic follows IEEE-754 either way.
+struct ARROW_EXPORT ArithmeticOptions {
+  ArithmeticOptions() : check_overflow(false) {}
+
+  bool check_overflow;
+};
+
+/// \brief Add two numeric datums
+///
+/// Either datum may be a Scalar, which is then broadcast over the other
+/// one, but not both. The inputs must have the same type, which is also
+/// the output type. A slot of the output is null if either input slot is
+/// null.
+///
+/// For example given left = [1, null, 3], right = 4, the output will be
+/// [5, null, 7]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the first operand, an Array or a Scalar
+/// \param[in] right the second operand, an Array or a Scalar
+/// \param[in] options overflow handling
+/// \param[out] out the resulting Array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           const ArithmeticOptions& options, Datum* out);
+
+/// \brief Subtract the right datum from the left one
+///
+/// Inputs and nulls are handled as for Add().
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out);
+
+/// \brief Multiply two numeric datums
+///
+/// Inputs and nulls are handled as for Add().
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out);
+
+/// \brief Divide the left datum by the right one
+///
+/// Inputs and nulls are handled as for Add(). Integer division truncates
+/// towards zero, and a division by zero is always an error. Dividing the
+/// minimum value of a signed integer type by -1 overflows.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              const ArithmeticOptions& options, Datum* out);
+
+/// \brief Negate the values of a numeric Array
+///
+/// Unsigned integers are negated modulo 2^N, which overflows for any
+/// non-zero value.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Negate(FunctionContext* ctx, const Datum& values,
+              const ArithmeticOptions& options, Datum* out);
+
+/// \brief Absolute value of the values of a numeric Array
+///
+/// The absolute value of the minimum value of a signed integer type
+/// overflows.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AbsoluteValue(FunctionContext* ctx, const Datum& values,
+                     const ArithmeticOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
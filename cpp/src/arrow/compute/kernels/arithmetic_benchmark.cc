@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+template <Status (*Op)(FunctionContext*, const Datum&, const Datum&,
+                       const ArithmeticOptions&, Datum*),
+          bool kCheckOverflow>
+static void ArithmeticArrayArrayKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Int64(array_size, -100, 100, null_percent);
+  auto rhs = rand.Int64(array_size, 1, 100, null_percent);
+
+  ArithmeticOptions options;
+  options.check_overflow = kCheckOverflow;
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Op(&ctx, Datum(lhs), Datum(rhs), options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t) * 2);
+}
+
+template <Status (*Op)(FunctionContext*, const Datum&, const Datum&,
+                       const ArithmeticOptions&, Datum*),
+          bool kCheckOverflow>
+static void ArithmeticArrayScalarKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Int64(array_size, -100, 100, null_percent);
+
+  ArithmeticOptions options;
+  options.check_overflow = kCheckOverflow;
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Op(&ctx, Datum(array), Datum(int64_t(7)), options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Add, false)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Add, true)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Multiply, false)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Multiply, true)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Divide, false)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayScalarKernel, Subtract, false)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayScalarKernel, Subtract, true)
+    ->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
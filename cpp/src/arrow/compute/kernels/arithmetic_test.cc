@@ -0,0 +1,304 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+namespace arrow {
+namespace compute {
+
+using BinaryFunction = std::function<Status(FunctionContext*, const Datum&, const Datum&,
+                                            const ArithmeticOptions&, Datum*)>;
+using UnaryFunction = std::function<Status(FunctionContext*, const Datum&,
+                                           const ArithmeticOptions&, Datum*)>;
+
+template <typename ArrowType>
+class TestArithmetic : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename ArrowType::c_type;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<Array> MakeArray(const std::string& json) {
+    return ArrayFromJSON(type(), json);
+  }
+
+  Datum MakeScalar(CType value) { return arrow::MakeScalar(value); }
+
+  void AssertResult(const Datum& out, const std::string& expected) {
+    ASSERT_TRUE(out.is_array());
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*MakeArray(expected), *actual, /*verbose=*/true);
+  }
+
+  void AssertBinary(BinaryFunction func, const Datum& left, const Datum& right,
+                    const std::string& expected, bool check_overflow = false) {
+    ArithmeticOptions options;
+    options.check_overflow = check_overflow;
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, left, right, options, &out));
+    AssertResult(out, expected);
+  }
+
+  void AssertBinary(BinaryFunction func, const std::string& left,
+                    const std::string& right, const std::string& expected) {
+    // The checked and unchecked paths agree when there is no overflow
+    AssertBinary(func, MakeArray(left), MakeArray(right), expected, false);
+    AssertBinary(func, MakeArray(left), MakeArray(right), expected, true);
+  }
+
+  void AssertUnary(UnaryFunction func, const std::string& values,
+                   const std::string& expected, bool check_overflow = false) {
+    ArithmeticOptions options;
+    options.check_overflow = check_overflow;
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, MakeArray(values), options, &out));
+    AssertResult(out, expected);
+  }
+
+  Status Checked(BinaryFunction func, const Datum& left, const Datum& right) {
+    ArithmeticOptions options;
+    options.check_overflow = true;
+    Datum out;
+    return func(&this->ctx_, left, right, options, &out);
+  }
+
+  Status Checked(UnaryFunction func, const std::string& values) {
+    ArithmeticOptions options;
+    options.check_overflow = true;
+    Datum out;
+    return func(&this->ctx_, MakeArray(values), options, &out);
+  }
+};
+
+typedef ::testing::Types<Int8Type, Int16Type, Int32Type, Int64Type>
+    SignedIntegerArrowTypes;
+
+typedef ::testing::Types<UInt8Type, UInt16Type, UInt32Type, UInt64Type>
+    UnsignedIntegerArrowTypes;
+
+template <typename ArrowType>
+class TestArithmeticNumeric : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticNumeric, NumericArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticSigned : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticSigned, SignedIntegerArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticUnsigned : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticUnsigned, UnsignedIntegerArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticReal : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticReal, RealArrowTypes);
+
+TYPED_TEST(TestArithmeticNumeric, ArrayArray) {
+  this->AssertBinary(Add, "[]", "[]", "[]");
+  this->AssertBinary(Add, "[1, 2, null, 4]", "[10, null, 30, 40]",
+                     "[11, null, null, 44]");
+  this->AssertBinary(Subtract, "[10, 20, null, 40]", "[1, 2, 3, null]",
+                     "[9, 18, null, null]");
+  this->AssertBinary(Multiply, "[1, 2, null, 4]", "[10, 5, 3, 0]", "[10, 10, null, 0]");
+  this->AssertBinary(Divide, "[10, 21, null, 40]", "[5, 3, 2, 8]", "[2, 7, null, 5]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, ArrayScalar) {
+  this->AssertBinary(Subtract, this->MakeArray("[10, null, 30]"), this->MakeScalar(4),
+                     "[6, null, 26]");
+  this->AssertBinary(Subtract, this->MakeScalar(40), this->MakeArray("[10, null, 30]"),
+                     "[30, null, 10]");
+  this->AssertBinary(Divide, this->MakeArray("[12, null, 36]"), this->MakeScalar(6),
+                     "[2, null, 6]");
+  this->AssertBinary(Divide, this->MakeScalar(36), this->MakeArray("[12, null, 4]"),
+                     "[3, null, 9]");
+
+  // A null scalar nulls out the whole output
+  auto null_scalar = MakeNullScalar(this->type());
+  this->AssertBinary(Multiply, this->MakeArray("[1, 2, 3]"), null_scalar,
+                     "[null, null, null]");
+  this->AssertBinary(Add, null_scalar, this->MakeArray("[1, 2, 3]"),
+                     "[null, null, null]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, Sliced) {
+  auto left = this->MakeArray("[1, 2, null, 4, 5, 6, null, 8, 9, 10]")->Slice(3, 6);
+  auto right = this->MakeArray("[null, 1, 2, 3, 4, null, 6, 7, 8]")->Slice(2, 6);
+  this->AssertBinary(Add, left, right, "[6, 8, 10, null, 14, 16]");
+  this->AssertBinary(Add, left, this->MakeScalar(1), "[5, 6, 7, null, 9, 10]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, UnaryOperations) {
+  this->AssertUnary(AbsoluteValue, "[]", "[]");
+  this->AssertUnary(AbsoluteValue, "[0, 1, null, 100]", "[0, 1, null, 100]");
+  this->AssertUnary(Negate, "[0, null]", "[0, null]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, Errors) {
+  Datum out;
+  ArithmeticOptions options;
+  auto array = this->MakeArray("[1, 2]");
+  ASSERT_RAISES(TypeError, Add(&this->ctx_, array, ArrayFromJSON(null(), "[null, null]"),
+                               options, &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, array, this->MakeArray("[1]"), options, &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, this->MakeScalar(1), this->MakeScalar(2),
+                             options, &out));
+
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{array});
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, chunked, array, options, &out));
+  ASSERT_RAISES(Invalid, Negate(&this->ctx_, chunked, options, &out));
+}
+
+TYPED_TEST(TestArithmeticNumeric, MatchesScalarLoop) {
+  using CType = typename TypeParam::c_type;
+  random::RandomArrayGenerator rand(0x5eed);
+  const int64_t length = 1003;
+  auto left = std::static_pointer_cast<NumericArray<TypeParam>>(
+      rand.Numeric<TypeParam>(length, 0, 10, 0.1));
+  auto right = std::static_pointer_cast<NumericArray<TypeParam>>(
+      rand.Numeric<TypeParam>(length, 1, 10, 0.1));
+
+  Datum out;
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  ASSERT_OK(Multiply(&this->ctx_, left, right, options, &out));
+  auto product = std::static_pointer_cast<NumericArray<TypeParam>>(out.make_array());
+  ASSERT_OK(product->ValidateFull());
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_EQ(left->IsValid(i) && right->IsValid(i), product->IsValid(i));
+    if (product->IsValid(i)) {
+      ASSERT_EQ(static_cast<CType>(left->Value(i) * right->Value(i)), product->Value(i));
+    }
+  }
+}
+
+TYPED_TEST(TestArithmeticSigned, Overflow) {
+  using CType = typename TypeParam::c_type;
+  const auto min = std::to_string(std::numeric_limits<CType>::min());
+  const auto max = std::to_string(std::numeric_limits<CType>::max());
+  auto max_array = this->MakeArray("[1, " + max + "]");
+  auto min_array = this->MakeArray("[-1, " + min + "]");
+
+  // Unchecked arithmetic wraps around
+  this->AssertBinary(Add, max_array, this->MakeScalar(1), "[2, " + min + "]");
+  this->AssertBinary(Subtract, min_array, this->MakeScalar(1), "[-2, " + max + "]");
+  this->AssertBinary(Multiply, max_array, this->MakeScalar(2), "[2, -2]");
+  this->AssertBinary(Divide, min_array, this->MakeScalar(-1), "[1, " + min + "]");
+  this->AssertUnary(Negate, "[-1, " + min + "]", "[1, " + min + "]");
+  this->AssertUnary(AbsoluteValue, "[-1, " + min + "]", "[1, " + min + "]");
+
+  ASSERT_RAISES(Invalid, this->Checked(Add, max_array, this->MakeScalar(1)));
+  ASSERT_RAISES(Invalid, this->Checked(Subtract, min_array, this->MakeScalar(1)));
+  ASSERT_RAISES(Invalid, this->Checked(Multiply, max_array, this->MakeScalar(2)));
+  ASSERT_RAISES(Invalid, this->Checked(Divide, min_array, this->MakeScalar(-1)));
+  ASSERT_RAISES(Invalid, this->Checked(Negate, "[-1, " + min + "]"));
+  ASSERT_RAISES(Invalid, this->Checked(AbsoluteValue, "[-1, " + min + "]"));
+
+  this->AssertUnary(Negate, "[-3, null, 5, " + max + "]", "[3, null, -5, -" + max + "]",
+                    true);
+  this->AssertUnary(AbsoluteValue, "[-3, null, 5, " + max + "]",
+                    "[3, null, 5, " + max + "]", true);
+}
+
+TYPED_TEST(TestArithmeticUnsigned, Overflow) {
+  using CType = typename TypeParam::c_type;
+  const auto max = std::to_string(std::numeric_limits<CType>::max());
+
+  this->AssertBinary(Add, this->MakeArray("[1, " + max + "]"), this->MakeScalar(1),
+                     "[2, 0]");
+  this->AssertBinary(Subtract, this->MakeArray("[1, 0]"), this->MakeScalar(1),
+                     "[0, " + max + "]");
+  this->AssertUnary(Negate, "[0, 1]", "[0, " + max + "]");
+
+  ASSERT_RAISES(Invalid, this->Checked(Add, this->MakeArray("[" + max + "]"),
+                                       this->MakeScalar(1)));
+  ASSERT_RAISES(Invalid,
+                this->Checked(Subtract, this->MakeArray("[0]"), this->MakeScalar(1)));
+  ASSERT_RAISES(Invalid, this->Checked(Multiply, this->MakeArray("[" + max + "]"),
+                                       this->MakeScalar(2)));
+  ASSERT_RAISES(Invalid, this->Checked(Negate, "[0, 1]"));
+  this->AssertUnary(Negate, "[0, null]", "[0, null]", true);
+}
+
+TYPED_TEST(TestArithmeticSigned, DivideByZero) {
+  ArithmeticOptions options;
+  Datum out;
+  // Integer division by zero is an error even without overflow checking...
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, this->MakeArray("[1, 2]"),
+                                this->MakeArray("[1, 0]"), options, &out));
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, this->MakeArray("[1, 2]"),
+                                this->MakeScalar(0), options, &out));
+  // ...unless the slot is null
+  this->AssertBinary(Divide, "[4, null, 6]", "[2, 0, null]", "[2, null, null]");
+  this->AssertBinary(Divide, this->MakeArray("[1, 2]"), MakeNullScalar(this->type()),
+                     "[null, null]");
+  // Truncation towards zero
+  this->AssertBinary(Divide, "[7, -7, 7, -7]", "[2, 2, -2, -2]", "[3, -3, -3, 3]");
+}
+
+TYPED_TEST(TestArithmeticSigned, OverflowInNullSlot) {
+  using CType = typename TypeParam::c_type;
+  const auto max = std::to_string(std::numeric_limits<CType>::max());
+  auto values = this->MakeArray("[" + max + ", 1]");
+  ASSERT_RAISES(Invalid, this->Checked(Add, values, this->MakeScalar(1)));
+
+  // A null slot may hold any value, which must not make the checked path fail
+  auto data = values->data()->Copy();
+  data->buffers[0] = Buffer::FromString(std::string(1, '\x02'));
+  data->null_count = 1;
+  this->AssertBinary(Add, arrow::MakeArray(data), this->MakeScalar(1), "[null, 2]", true);
+  this->AssertBinary(Divide, this->MakeArray("[1, 2]"), arrow::MakeArray(data),
+                     "[null, 2]");
+}
+
+TYPED_TEST(TestArithmeticReal, FloatingPoint) {
+  this->AssertBinary(Divide, "[1, -1, 2.5]", "[0, 0, 2]", "[Inf, -Inf, 1.25]");
+  this->AssertBinary(Add, "[1.5, -0.25]", "[0.25, 0.25]", "[1.75, 0]");
+  this->AssertUnary(Negate, "[1.5, -2, null]", "[-1.5, 2, null]", true);
+  this->AssertUnary(AbsoluteValue, "[1.5, -2, null, -Inf]", "[1.5, 2, null, Inf]", true);
+}
+
+TEST(TestArithmeticTypes, NotImplemented) {
+  FunctionContext ctx;
+  ArithmeticOptions options;
+  Datum out;
+  auto strings = ArrayFromJSON(utf8(), R"(["a"])");
+  ASSERT_RAISES(NotImplemented, Add(&ctx, strings, strings, options, &out));
+  ASSERT_RAISES(NotImplemented, Negate(&ctx, strings, options, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
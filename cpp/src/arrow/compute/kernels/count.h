@@ -58,7 +58,7 @@ ARROW_EXPORT
 std::shared_ptr<AggregateFunction> MakeCount(FunctionContext* context,
                                              const CountOptions& options);
 
-/// \brief Count non-null (or null) values in an array.
+/// \brief Count non-null (or null) values in an array or a chunked array.
 ///
 /// \param[in] context the FunctionContext
 /// \param[in] options counting options, see CountOptions for more information
@@ -24,6 +24,7 @@
 
 #include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
+#include "arrow/compute/kernels/selection_vector.h"
 #include "arrow/compute/kernels/take_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
@@ -148,6 +149,14 @@ Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filte
               std::shared_ptr<RecordBatch>* out) {
   ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(Datum(filter.data())));
 
+  if (filter_array->null_count() == 0 &&
+      filter_array->length() <= std::numeric_limits<int32_t>::max()) {
+    // Scan the filter once rather than once per column
+    std::shared_ptr<SelectionVector> selection;
+    RETURN_NOT_OK(SelectionVector::FromFilter(ctx, *filter_array, &selection));
+    return Take(ctx, batch, *selection, out);
+  }
+
   std::vector<std::unique_ptr<FilterKernel>> kernels(batch.num_columns());
   for (int i = 0; i < batch.num_columns(); ++i) {
     RETURN_NOT_OK(FilterKernel::Make(batch.schema()->field(i)->type(), &kernels[i]));
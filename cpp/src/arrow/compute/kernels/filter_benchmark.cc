@@ -17,10 +17,16 @@
 
 #include "benchmark/benchmark.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/selection_vector.h"
 
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -92,6 +98,63 @@ static void FilterString(benchmark::State& state) {
   }
 }
 
+// Three predicates over a batch of four int64 columns, as in a scan with a
+// conjunctive filter
+struct ChainedFilterArgs : public RegressionArgs {
+  explicit ChainedFilterArgs(benchmark::State& state) : RegressionArgs(state) {
+    const int64_t num_rows = size / sizeof(int64_t) / 4;
+    auto rand = random::RandomArrayGenerator(kSeed);
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < 4; ++i) {
+      fields.push_back(field("f" + std::to_string(i), int64()));
+      columns.push_back(rand.Int64(num_rows, -100, 100, null_proportion));
+    }
+    batch = RecordBatch::Make(schema(fields), num_rows, columns);
+    for (int i = 0; i < 3; ++i) {
+      predicates.push_back(rand.Boolean(num_rows, 0.75, 0.0));
+    }
+  }
+
+  std::shared_ptr<RecordBatch> batch;
+  std::vector<std::shared_ptr<Array>> predicates;
+};
+
+static void FilterBatchChained(benchmark::State& state) {
+  ChainedFilterArgs args(state);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    // Materialize the batch, and the remaining predicates, after each filter
+    std::shared_ptr<RecordBatch> batch = args.batch;
+    std::vector<std::shared_ptr<Array>> predicates = args.predicates;
+    for (size_t i = 0; i < predicates.size(); ++i) {
+      auto predicate = predicates[i];
+      ABORT_NOT_OK(Filter(&ctx, *batch, *predicate, &batch));
+      for (size_t j = i + 1; j < predicates.size(); ++j) {
+        ABORT_NOT_OK(Filter(&ctx, *predicates[j], *predicate, &predicates[j]));
+      }
+    }
+    benchmark::DoNotOptimize(batch);
+  }
+}
+
+static void FilterBatchSelectionVector(benchmark::State& state) {
+  ChainedFilterArgs args(state);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<SelectionVector> selection;
+    ABORT_NOT_OK(SelectionVector::FromFilter(&ctx, *args.predicates[0], &selection));
+    for (size_t i = 1; i < args.predicates.size(); ++i) {
+      ABORT_NOT_OK(selection->Intersect(&ctx, *args.predicates[i], &selection));
+    }
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(Take(&ctx, *args.batch, *selection, &batch));
+    benchmark::DoNotOptimize(batch);
+  }
+}
+
 BENCHMARK(FilterInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -113,5 +176,15 @@ BENCHMARK(FilterString)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(FilterBatchChained)
+    ->Apply(RegressionSetArgs)
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(FilterBatchSelectionVector)
+    ->Apply(RegressionSetArgs)
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,543 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group_by.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Grouped aggregators: one accumulator per group, addressed by group id.
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  // Make room for accumulators up to `num_groups`.
+  virtual void Resize(int32_t num_groups) = 0;
+
+  // Accumulate `values` into the groups designated by `group_ids`.
+  virtual void Consume(const ArrayData& values, const int32_t* group_ids) = 0;
+
+  // Accumulate the groups of `other` into the groups designated by
+  // `group_id_mapping`.
+  virtual void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) = 0;
+
+  virtual Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const = 0;
+};
+
+// Invoke `visit(group_id, value)` for each non-null value.
+template <typename CType, typename Visitor>
+void VisitGroupedValues(const ArrayData& data, const int32_t* group_ids,
+                        Visitor&& visit) {
+  const CType* values = data.GetValues<CType>(1);
+  if (data.GetNullCount() == 0) {
+    for (int64_t i = 0; i < data.length; ++i) {
+      visit(group_ids[i], values[i]);
+    }
+    return;
+  }
+
+  internal::BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+  for (int64_t i = 0; i < data.length; ++i) {
+    if (reader.IsSet()) {
+      visit(group_ids[i], values[i]);
+    }
+    reader.Next();
+  }
+}
+
+// Build an array of `length` values given by `generate(i, &value)`, which
+// returns false for null entries.
+template <typename OutType, typename Generator>
+Status MakeGroupedResult(MemoryPool* pool, int64_t length, Generator&& generate,
+                         std::shared_ptr<Array>* out) {
+  using CType = typename OutType::c_type;
+
+  NumericBuilder<OutType> builder(pool);
+  RETURN_NOT_OK(builder.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    CType value;
+    if (generate(i, &value)) {
+      builder.UnsafeAppend(value);
+    } else {
+      builder.UnsafeAppendNull();
+    }
+  }
+  return builder.Finish(out);
+}
+
+class GroupedCountAggregator final : public GroupedAggregator {
+ public:
+  void Resize(int32_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    if (values.GetNullCount() == 0) {
+      for (int64_t i = 0; i < values.length; ++i) {
+        counts_[group_ids[i]]++;
+      }
+      return;
+    }
+    if (values.buffers[0] == nullptr) {
+      // Null arrays have no validity bitmap, none of their values is counted
+      return;
+    }
+
+    internal::BitmapReader reader(values.buffers[0]->data(), values.offset,
+                                  values.length);
+    for (int64_t i = 0; i < values.length; ++i) {
+      counts_[group_ids[i]] += reader.IsSet();
+      reader.Next();
+    }
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_counts = checked_cast<const GroupedCountAggregator&>(other).counts_;
+    for (size_t i = 0; i < other_counts.size(); ++i) {
+      counts_[group_id_mapping[i]] += other_counts[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    auto generate = [this](int64_t i, int64_t* value) {
+      *value = counts_[i];
+      return true;
+    };
+    return MakeGroupedResult<Int64Type>(pool, counts_.size(), generate, out);
+  }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+// Sum, or mean when kMean is true
+template <typename ArrowType, bool kMean>
+class GroupedSumAggregator final : public GroupedAggregator {
+ public:
+  using ThisType = GroupedSumAggregator<ArrowType, kMean>;
+  using CType = typename ArrowType::c_type;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  void Resize(int32_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    VisitGroupedValues<CType>(values, group_ids, [this](int32_t group_id, CType value) {
+      sums_[group_id] += value;
+      counts_[group_id]++;
+    });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_state = checked_cast<const ThisType&>(other);
+    for (size_t i = 0; i < other_state.sums_.size(); ++i) {
+      sums_[group_id_mapping[i]] += other_state.sums_[i];
+      counts_[group_id_mapping[i]] += other_state.counts_[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    if (kMean) {
+      auto generate = [this](int64_t i, double* value) {
+        *value = static_cast<double>(sums_[i]) / static_cast<double>(counts_[i]);
+        return counts_[i] > 0;
+      };
+      return MakeGroupedResult<DoubleType>(pool, sums_.size(), generate, out);
+    }
+    auto generate = [this](int64_t i, SumCType* value) {
+      *value = sums_[i];
+      return counts_[i] > 0;
+    };
+    return MakeGroupedResult<SumType>(pool, sums_.size(), generate, out);
+  }
+
+ private:
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename CType, bool kMax, typename Enable = void>
+struct MinMaxOp {
+  static constexpr CType identity() {
+    return kMax ? std::numeric_limits<CType>::lowest()
+                : std::numeric_limits<CType>::max();
+  }
+  static CType Call(CType a, CType b) { return kMax ? std::max(a, b) : std::min(a, b); }
+};
+
+// As in MinMax, NaNs are ignored for floating point values, unless a group
+// only has NaNs: starting from NaN, the result is then NaN
+template <typename CType, bool kMax>
+struct MinMaxOp<CType, kMax, enable_if_t<std::is_floating_point<CType>::value>> {
+  static constexpr CType identity() { return std::numeric_limits<CType>::quiet_NaN(); }
+  static CType Call(CType a, CType b) { return kMax ? std::fmax(a, b) : std::fmin(a, b); }
+};
+
+// Min, or max when kMax is true
+template <typename ArrowType, bool kMax>
+class GroupedMinMaxAggregator final : public GroupedAggregator {
+ public:
+  using ThisType = GroupedMinMaxAggregator<ArrowType, kMax>;
+  using CType = typename ArrowType::c_type;
+  using Op = MinMaxOp<CType, kMax>;
+
+  void Resize(int32_t num_groups) override {
+    values_.resize(num_groups, Op::identity());
+    seen_.resize(num_groups, false);
+  }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    VisitGroupedValues<CType>(values, group_ids, [this](int32_t group_id, CType value) {
+      values_[group_id] = Op::Call(values_[group_id], value);
+      seen_[group_id] = true;
+    });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_state = checked_cast<const ThisType&>(other);
+    for (size_t i = 0; i < other_state.values_.size(); ++i) {
+      const int32_t group_id = group_id_mapping[i];
+      values_[group_id] = Op::Call(values_[group_id], other_state.values_[i]);
+      seen_[group_id] = seen_[group_id] || other_state.seen_[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    auto generate = [this](int64_t i, CType* value) {
+      *value = values_[i];
+      return seen_[i];
+    };
+    return MakeGroupedResult<ArrowType>(pool, values_.size(), generate, out);
+  }
+
+ private:
+  std::vector<CType> values_;
+  std::vector<bool> seen_;
+};
+
+template <template <typename, bool> class Aggregator, bool kFlag>
+Status MakeNumericAggregator(const DataType& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  switch (type.id()) {
+#define NUMERIC_AGG_CASE(T)                \
+  case T::type_id:                         \
+    out->reset(new Aggregator<T, kFlag>()); \
+    return Status::OK();
+
+    NUMERIC_AGG_CASE(UInt8Type);
+    NUMERIC_AGG_CASE(Int8Type);
+    NUMERIC_AGG_CASE(UInt16Type);
+    NUMERIC_AGG_CASE(Int16Type);
+    NUMERIC_AGG_CASE(UInt32Type);
+    NUMERIC_AGG_CASE(Int32Type);
+    NUMERIC_AGG_CASE(UInt64Type);
+    NUMERIC_AGG_CASE(Int64Type);
+    NUMERIC_AGG_CASE(FloatType);
+    NUMERIC_AGG_CASE(DoubleType);
+#undef NUMERIC_AGG_CASE
+    default:
+      break;
+  }
+  return Status::Invalid("GroupBy aggregate requires a numeric value column, got ",
+                         type);
+}
+
+Status MakeGroupedAggregator(const GroupByAggregate& aggregate, const DataType& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  switch (aggregate.kind) {
+    case GroupByAggregate::COUNT:
+      out->reset(new GroupedCountAggregator());
+      return Status::OK();
+    case GroupByAggregate::SUM:
+      return MakeNumericAggregator<GroupedSumAggregator, false>(type, out);
+    case GroupByAggregate::MEAN:
+      return MakeNumericAggregator<GroupedSumAggregator, true>(type, out);
+    case GroupByAggregate::MIN:
+      return MakeNumericAggregator<GroupedMinMaxAggregator, false>(type, out);
+    case GroupByAggregate::MAX:
+      return MakeNumericAggregator<GroupedMinMaxAggregator, true>(type, out);
+  }
+  return Status::Invalid("Unknown GroupBy aggregate");
+}
+
+// ----------------------------------------------------------------------
+// HashAggregator implementation
+
+class HashAggregatorImpl final : public HashAggregator {
+ public:
+  HashAggregatorImpl(FunctionContext* ctx, std::vector<GroupByAggregate> aggregates,
+                     size_t num_keys, size_t num_values)
+      : ctx_(ctx),
+        aggregates_(std::move(aggregates)),
+        num_keys_(num_keys),
+        num_values_(num_values) {}
+
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types,
+              const std::vector<std::shared_ptr<DataType>>& value_types) {
+    RETURN_NOT_OK(grouper_.Init(key_types, ctx_->memory_pool()));
+
+    aggregators_.resize(aggregates_.size());
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      const auto& value_type = value_types[aggregates_[i].value_index];
+      RETURN_NOT_OK(MakeGroupedAggregator(aggregates_[i], *value_type, &aggregators_[i]));
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 const std::vector<std::shared_ptr<Array>>& values) override {
+    if (keys.size() != num_keys_ || values.size() != num_values_) {
+      return Status::Invalid("HashAggregator expected ", num_keys_, " keys and ",
+                             num_values_, " values, got ", keys.size(), " and ",
+                             values.size());
+    }
+    const int64_t length = keys[0]->length();
+    for (const auto& array : keys) {
+      if (array->length() != length) {
+        return Status::Invalid("GroupBy keys must all have the same length");
+      }
+    }
+    for (const auto& array : values) {
+      if (array->length() != length) {
+        return Status::Invalid("GroupBy values must have the same length as keys");
+      }
+    }
+
+    RETURN_NOT_OK(grouper_.Consume(keys, length, &group_ids_));
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+      aggregators_[i]->Resize(grouper_.num_groups());
+      aggregators_[i]->Consume(*values[aggregates_[i].value_index]->data(),
+                               group_ids_.data());
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const HashAggregator& other) override {
+    const auto& other_impl = checked_cast<const HashAggregatorImpl&>(other);
+    if (other_impl.num_groups() == 0) {
+      return Status::OK();
+    }
+
+    // Regroup the keys of `other` to find where its groups land in this one
+    std::vector<std::shared_ptr<Array>> other_keys;
+    RETURN_NOT_OK(other_impl.grouper_.GetUniques(ctx_, &other_keys));
+    std::vector<int32_t> group_id_mapping;
+    RETURN_NOT_OK(
+        grouper_.Consume(other_keys, other_impl.num_groups(), &group_id_mapping));
+
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+      aggregators_[i]->Resize(grouper_.num_groups());
+      aggregators_[i]->Merge(*other_impl.aggregators_[i], group_id_mapping.data());
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(Datum* out) override {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(grouper_.GetUniques(ctx_, &columns));
+    for (const auto& aggregator : aggregators_) {
+      // Groups may be absent from the batches an aggregator was fed
+      aggregator->Resize(grouper_.num_groups());
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(aggregator->Finalize(ctx_->memory_pool(), &column));
+      columns.push_back(std::move(column));
+    }
+
+    std::vector<Datum> collection(columns.begin(), columns.end());
+    *out = Datum(collection);
+    return Status::OK();
+  }
+
+  int32_t num_groups() const override { return grouper_.num_groups(); }
+
+ private:
+  FunctionContext* ctx_;
+  std::vector<GroupByAggregate> aggregates_;
+  size_t num_keys_;
+  size_t num_values_;
+  Grouper grouper_;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators_;
+  // Scratch space for the group ids of the current batch
+  std::vector<int32_t> group_ids_;
+};
+
+// Split [0, length) into ranges which do not straddle any chunk boundary of
+// `columns` and are at most `max_length` long.
+std::vector<std::pair<int64_t, int64_t>> SplitIntoRanges(
+    const std::vector<Datum>& columns, int64_t length, int64_t max_length) {
+  std::vector<int64_t> boundaries = {0, length};
+  for (const Datum& column : columns) {
+    if (column.kind() != Datum::CHUNKED_ARRAY) continue;
+    int64_t offset = 0;
+    for (const auto& chunk : column.chunked_array()->chunks()) {
+      offset += chunk->length();
+      boundaries.push_back(offset);
+    }
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  for (size_t i = 1; i < boundaries.size(); ++i) {
+    for (int64_t offset = boundaries[i - 1]; offset < boundaries[i];
+         offset += max_length) {
+      ranges.emplace_back(offset, std::min(max_length, boundaries[i] - offset));
+    }
+  }
+  return ranges;
+}
+
+std::shared_ptr<Array> SliceColumn(const Datum& column, int64_t offset, int64_t length) {
+  if (column.kind() == Datum::ARRAY) {
+    return column.make_array()->Slice(offset, length);
+  }
+  // The range does not straddle chunks, so the slice is made of a single chunk
+  auto sliced = column.chunked_array()->Slice(offset, length);
+  DCHECK_EQ(sliced->num_chunks(), 1);
+  return sliced->chunk(0);
+}
+
+std::vector<std::shared_ptr<DataType>> ColumnTypes(const std::vector<Datum>& columns) {
+  std::vector<std::shared_ptr<DataType>> types;
+  for (const Datum& column : columns) {
+    types.push_back(column.type());
+  }
+  return types;
+}
+
+}  // namespace
+
+Status HashAggregator::Make(FunctionContext* ctx,
+                            const std::vector<std::shared_ptr<DataType>>& key_types,
+                            const std::vector<std::shared_ptr<DataType>>& value_types,
+                            const std::vector<GroupByAggregate>& aggregates,
+                            std::unique_ptr<HashAggregator>* out) {
+  if (key_types.empty()) {
+    return Status::Invalid("GroupBy requires at least one key column");
+  }
+  for (const auto& aggregate : aggregates) {
+    if (aggregate.value_index < 0 ||
+        aggregate.value_index >= static_cast<int>(value_types.size())) {
+      return Status::Invalid("GroupBy aggregate refers to value column ",
+                             aggregate.value_index, " out of ", value_types.size());
+    }
+  }
+
+  auto impl = std::unique_ptr<HashAggregatorImpl>(
+      new HashAggregatorImpl(ctx, aggregates, key_types.size(), value_types.size()));
+  RETURN_NOT_OK(impl->Init(key_types, value_types));
+  *out = std::move(impl);
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& values, const GroupByOptions& options,
+               Datum* out) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy requires at least one key column");
+  }
+  if (options.max_rows_per_task <= 0) {
+    return Status::Invalid("GroupByOptions::max_rows_per_task must be positive");
+  }
+  std::vector<Datum> columns(keys);
+  columns.insert(columns.end(), values.begin(), values.end());
+  for (const Datum& column : columns) {
+    if (!column.is_arraylike()) {
+      return Status::Invalid("GroupBy expects Array or ChunkedArray datums");
+    }
+    if (column.length() != keys[0].length()) {
+      return Status::Invalid("GroupBy columns must all have the same length");
+    }
+  }
+
+  const auto ranges =
+      SplitIntoRanges(columns, keys[0].length(), options.max_rows_per_task);
+  int num_tasks = 1;
+  if (options.use_threads && ctx->use_threads()) {
+    num_tasks = std::max(1, std::min(static_cast<int>(ranges.size()),
+                                     internal::GetCpuThreadPool()->GetCapacity()));
+  }
+
+  // Each task aggregates every num_tasks-th range into its own state
+  std::vector<std::unique_ptr<HashAggregator>> states(num_tasks);
+  for (auto& state : states) {
+    RETURN_NOT_OK(HashAggregator::Make(ctx, ColumnTypes(keys), ColumnTypes(values),
+                                       options.aggregates, &state));
+  }
+
+  auto consume_ranges = [&](int task) {
+    std::vector<std::shared_ptr<Array>> key_arrays(keys.size());
+    std::vector<std::shared_ptr<Array>> value_arrays(values.size());
+    for (size_t r = task; r < ranges.size(); r += num_tasks) {
+      const int64_t offset = ranges[r].first;
+      const int64_t length = ranges[r].second;
+      for (size_t i = 0; i < keys.size(); ++i) {
+        key_arrays[i] = SliceColumn(keys[i], offset, length);
+      }
+      for (size_t i = 0; i < values.size(); ++i) {
+        value_arrays[i] = SliceColumn(values[i], offset, length);
+      }
+      RETURN_NOT_OK(states[task]->Consume(key_arrays, value_arrays));
+    }
+    return Status::OK();
+  };
+
+  if (num_tasks > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, consume_ranges));
+  } else {
+    RETURN_NOT_OK(consume_ranges(0));
+  }
+
+  for (int task = 1; task < num_tasks; ++task) {
+    RETURN_NOT_OK(states[0]->Merge(*states[task]));
+  }
+  return states[0]->Finalize(out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class GroupByAggregate
+///
+/// Describe one aggregate column of a grouped aggregation: which reduction to
+/// apply and to which of the value columns.
+struct ARROW_EXPORT GroupByAggregate {
+  enum type {
+    // Sum of the non-null values, typed as for Sum().
+    SUM = 0,
+    // Number of non-null values, as int64.
+    COUNT,
+    // Mean of the non-null values, as double.
+    MEAN,
+    // Smallest non-null value. NaNs are ignored, unless all the non-null
+    // values of the group are NaN.
+    MIN,
+    // Largest non-null value. NaNs are ignored, unless all the non-null
+    // values of the group are NaN.
+    MAX,
+  };
+
+  GroupByAggregate(enum type kind, int value_index)
+      : kind(kind), value_index(value_index) {}
+
+  enum type kind;
+  /// Index of the aggregated column in the `values` argument
+  int value_index;
+};
+
+/// \class GroupByOptions
+///
+/// Control the GroupBy kernel. Input is split into ranges (chunk boundaries,
+/// and large chunks into sub-ranges) which are aggregated independently and
+/// merged at the end.
+struct ARROW_EXPORT GroupByOptions {
+  explicit GroupByOptions(std::vector<GroupByAggregate> aggregates = {})
+      : aggregates(std::move(aggregates)) {}
+
+  std::vector<GroupByAggregate> aggregates;
+
+  /// Aggregate ranges in parallel on the CPU thread pool, if the
+  /// FunctionContext allows it
+  bool use_threads = true;
+
+  /// Upper bound on the number of rows aggregated by a single task
+  int64_t max_rows_per_task = 1 << 20;
+};
+
+/// \brief Partial grouped aggregation state
+///
+/// A HashAggregator assigns a group id to each distinct combination of key
+/// values (nulls included) through the memo tables in arrow/util/hashing.h,
+/// and maintains one accumulator per group and aggregate. Independent
+/// aggregators can consume disjoint parts of the input on separate threads
+/// and be merged afterwards.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT HashAggregator {
+ public:
+  virtual ~HashAggregator() = default;
+
+  /// \brief Create an empty aggregator
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types types of the key columns
+  /// \param[in] value_types types of the value columns
+  /// \param[in] aggregates aggregates to compute, see GroupByAggregate
+  /// \param[out] out the resulting aggregator
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     const std::vector<std::shared_ptr<DataType>>& value_types,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     std::unique_ptr<HashAggregator>* out);
+
+  /// \brief Accumulate a batch of rows
+  ///
+  /// \param[in] keys key arrays, all of the same length
+  /// \param[in] values value arrays, of the same length as the keys
+  virtual Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                         const std::vector<std::shared_ptr<Array>>& values) = 0;
+
+  /// \brief Fold the groups of another aggregator into this one
+  ///
+  /// `other` must have been created with the same types and aggregates.
+  virtual Status Merge(const HashAggregator& other) = 0;
+
+  /// \brief Produce the result
+  ///
+  /// The output is a collection of arrays of length num_groups(): the unique
+  /// keys, one array per key column, followed by one array per aggregate.
+  virtual Status Finalize(Datum* out) = 0;
+
+  /// \brief Number of groups seen so far
+  virtual int32_t num_groups() const = 0;
+};
+
+/// \brief Compute aggregates over groups of rows sharing the same keys
+///
+/// Rows whose keys are null are gathered in a group of their own. When
+/// use_threads is false, groups are emitted in order of first appearance;
+/// otherwise the group order is unspecified.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] keys key columns, expecting Array or ChunkedArray
+/// \param[in] values value columns, expecting Array or ChunkedArray
+/// \param[in] options aggregates and parallelism, see GroupByOptions
+/// \param[out] out collection of the unique keys followed by the aggregates,
+/// see HashAggregator::Finalize
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& values, const GroupByOptions& options,
+               Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
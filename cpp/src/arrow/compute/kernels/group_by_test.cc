@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/group_by.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+const std::vector<GroupByAggregate> kAllAggregates = {
+    {GroupByAggregate::SUM, 0},  {GroupByAggregate::COUNT, 0},
+    {GroupByAggregate::MEAN, 0}, {GroupByAggregate::MIN, 0},
+    {GroupByAggregate::MAX, 0},
+};
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ public:
+  void AssertGroupBy(const std::vector<Datum>& keys, const std::vector<Datum>& values,
+                     const GroupByOptions& options,
+                     const std::vector<std::shared_ptr<Array>>& expected) {
+    Datum out;
+    ASSERT_OK(GroupBy(&this->ctx_, keys, values, options, &out));
+    ASSERT_TRUE(out.is_collection());
+    const auto columns = out.collection();
+    ASSERT_EQ(columns.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      AssertArraysEqual(*expected[i], *columns[i].make_array());
+    }
+  }
+
+  GroupByOptions SerialOptions(std::vector<GroupByAggregate> aggregates) {
+    GroupByOptions options(std::move(aggregates));
+    options.use_threads = false;
+    return options;
+  }
+};
+
+TEST_F(TestGroupBy, IntegerKey) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2, 1, null, 2, 1]");
+  auto values = ArrayFromJSON(int64(), "[10, 20, null, 5, 1, 3]");
+
+  AssertGroupBy({keys}, {values}, SerialOptions(kAllAggregates),
+                {ArrayFromJSON(int32(), "[1, 2, null]"),
+                 ArrayFromJSON(int64(), "[13, 21, 5]"),
+                 ArrayFromJSON(int64(), "[2, 2, 1]"),
+                 ArrayFromJSON(float64(), "[6.5, 10.5, 5]"),
+                 ArrayFromJSON(int64(), "[3, 1, 5]"),
+                 ArrayFromJSON(int64(), "[10, 20, 5]")});
+}
+
+TEST_F(TestGroupBy, FloatingValues) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", "b", "c"])");
+  auto values = ArrayFromJSON(float32(), "[1.5, -2, 0.5, null, null]");
+
+  AssertGroupBy({keys}, {values}, SerialOptions(kAllAggregates),
+                {ArrayFromJSON(utf8(), R"(["a", "b", "c"])"),
+                 ArrayFromJSON(float64(), "[2, -2, null]"),
+                 ArrayFromJSON(int64(), "[2, 1, 0]"),
+                 ArrayFromJSON(float64(), "[1, -2, null]"),
+                 ArrayFromJSON(float32(), "[0.5, -2, null]"),
+                 ArrayFromJSON(float32(), "[1.5, -2, null]")});
+}
+
+TEST_F(TestGroupBy, NaNValues) {
+  // NaNs are ignored by MIN and MAX, unless a group only has NaNs
+  auto keys = ArrayFromJSON(int32(), "[1, 2, 1, 2, 3, 3]");
+  auto values = ArrayFromJSON(float64(), "[NaN, NaN, 2, NaN, null, NaN]");
+  Datum out;
+  auto options =
+      SerialOptions({{GroupByAggregate::MIN, 0}, {GroupByAggregate::MAX, 0}});
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values}, options, &out));
+  const auto columns = out.collection();
+  ASSERT_EQ(columns.size(), 3);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3]"), *columns[0].make_array());
+  for (int i = 1; i < 3; ++i) {
+    auto aggregated = columns[i].make_array();
+    ASSERT_OK(aggregated->ValidateFull());
+    ASSERT_EQ(aggregated->null_count(), 0);
+    const auto& typed = checked_cast<const DoubleArray&>(*aggregated);
+    ASSERT_EQ(typed.Value(0), 2);
+    ASSERT_TRUE(std::isnan(typed.Value(1)));
+    ASSERT_TRUE(std::isnan(typed.Value(2)));
+  }
+}
+
+TEST_F(TestGroupBy, CountNullType) {
+  // Null arrays have no validity bitmap
+  auto keys = ArrayFromJSON(int32(), "[1, 2, 1]");
+  auto values = std::make_shared<NullArray>(3);
+
+  AssertGroupBy({keys}, {values}, SerialOptions({{GroupByAggregate::COUNT, 0}}),
+                {ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int64(), "[0, 0]")});
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto key0 = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", null, "y", null])");
+  auto key1 = ArrayFromJSON(int8(), "[1, 1, 2, 1, 1, 1, 1]");
+  auto value0 = ArrayFromJSON(uint8(), "[1, 2, 3, 4, 5, 6, 7]");
+  auto value1 = ArrayFromJSON(boolean(), "[true, null, false, null, true, true, true]");
+
+  AssertGroupBy({key0, key1}, {value0, value1},
+                SerialOptions({{GroupByAggregate::SUM, 0}, {GroupByAggregate::COUNT, 1}}),
+                {ArrayFromJSON(utf8(), R"(["x", "y", "x", null])"),
+                 ArrayFromJSON(int8(), "[1, 1, 2, 1]"),
+                 ArrayFromJSON(uint64(), "[5, 8, 3, 12]"),
+                 ArrayFromJSON(int64(), "[1, 1, 1, 2]")});
+}
+
+TEST_F(TestGroupBy, EmptyInput) {
+  auto keys = ArrayFromJSON(int64(), "[]");
+  auto values = ArrayFromJSON(int16(), "[]");
+
+  AssertGroupBy({keys}, {values},
+                SerialOptions({{GroupByAggregate::SUM, 0}, {GroupByAggregate::MAX, 0}}),
+                {ArrayFromJSON(int64(), "[]"), ArrayFromJSON(int64(), "[]"),
+                 ArrayFromJSON(int16(), "[]")});
+}
+
+TEST_F(TestGroupBy, ChunkedInput) {
+  auto keys = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[1, 3, 2]", "[3]"});
+  auto values = ChunkedArrayFromJSON(int32(), {"[1]", "[2, 3, 4]", "[5, 6]"});
+
+  GroupByOptions options({{GroupByAggregate::SUM, 0}, {GroupByAggregate::MIN, 0}});
+  options.use_threads = false;
+  options.max_rows_per_task = 1;
+  AssertGroupBy({keys}, {values}, options,
+                {ArrayFromJSON(int32(), "[1, 2, 3]"),
+                 ArrayFromJSON(int64(), "[4, 7, 10]"),
+                 ArrayFromJSON(int32(), "[1, 2, 4]")});
+}
+
+TEST_F(TestGroupBy, ParallelMatchesSerial) {
+  random::RandomArrayGenerator rand(0x5487655);
+  const int64_t length = 10000;
+
+  ArrayVector key_chunks, value_chunks;
+  for (int i = 0; i < 8; ++i) {
+    key_chunks.push_back(rand.Int64(length, 0, 100, 0.01));
+    value_chunks.push_back(rand.Int64(length, -1000, 1000, 0.1));
+  }
+  auto keys = std::make_shared<ChunkedArray>(key_chunks);
+  auto values = std::make_shared<ChunkedArray>(value_chunks);
+
+  auto to_map = [](const Datum& out) {
+    const auto columns = out.collection();
+    const auto& group_keys = checked_cast<const Int64Array&>(*columns[0].make_array());
+    const auto& sums = checked_cast<const Int64Array&>(*columns[1].make_array());
+    const auto& counts = checked_cast<const Int64Array&>(*columns[2].make_array());
+    std::map<std::string, std::pair<int64_t, int64_t>> result;
+    for (int64_t i = 0; i < group_keys.length(); ++i) {
+      auto key = group_keys.IsNull(i) ? "null" : std::to_string(group_keys.Value(i));
+      result[key] = {sums.Value(i), counts.Value(i)};
+    }
+    return result;
+  };
+
+  GroupByOptions options({{GroupByAggregate::SUM, 0}, {GroupByAggregate::COUNT, 0}});
+  options.max_rows_per_task = 3000;
+
+  Datum serial, parallel;
+  options.use_threads = false;
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values}, options, &serial));
+  options.use_threads = true;
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values}, options, &parallel));
+
+  ASSERT_EQ(to_map(serial), to_map(parallel));
+}
+
+TEST_F(TestGroupBy, MergeAggregators) {
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::MAX, 0},
+                                              {GroupByAggregate::COUNT, 0}};
+  std::unique_ptr<HashAggregator> left, right;
+  ASSERT_OK(HashAggregator::Make(&this->ctx_, {utf8(), int32()}, {float64()},
+                                 aggregates, &left));
+  ASSERT_OK(HashAggregator::Make(&this->ctx_, {utf8(), int32()}, {float64()},
+                                 aggregates, &right));
+
+  ASSERT_OK(left->Consume({ArrayFromJSON(utf8(), R"(["a", "b", "a"])"),
+                           ArrayFromJSON(int32(), "[1, 1, 2]")},
+                          {ArrayFromJSON(float64(), "[1, 2, 3]")}));
+  ASSERT_OK(right->Consume({ArrayFromJSON(utf8(), R"(["c", "a", "b"])"),
+                            ArrayFromJSON(int32(), "[1, 2, 1]")},
+                           {ArrayFromJSON(float64(), "[4, 5, null]")}));
+  ASSERT_EQ(left->num_groups(), 3);
+  ASSERT_OK(left->Merge(*right));
+  ASSERT_EQ(left->num_groups(), 4);
+
+  Datum out;
+  ASSERT_OK(left->Finalize(&out));
+  const auto columns = out.collection();
+  ASSERT_EQ(columns.size(), 4U);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "a", "c"])"),
+                    *columns[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 1, 2, 1]"), *columns[1].make_array());
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 2, 5, 4]"), *columns[2].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 1, 2, 1]"), *columns[3].make_array());
+}
+
+TEST_F(TestGroupBy, Errors) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  Datum out;
+
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {}, {strings},
+                                 SerialOptions({{GroupByAggregate::COUNT, 0}}), &out));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {keys}, {strings},
+                                 SerialOptions({{GroupByAggregate::SUM, 0}}), &out));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {keys}, {strings},
+                                 SerialOptions({{GroupByAggregate::COUNT, 1}}), &out));
+  ASSERT_RAISES(Invalid,
+                GroupBy(&this->ctx_, {keys}, {ArrayFromJSON(int32(), "[1]")},
+                        SerialOptions({{GroupByAggregate::SUM, 0}}), &out));
+  ASSERT_RAISES(NotImplemented,
+                GroupBy(&this->ctx_, {ArrayFromJSON(list(int32()), "[[1], [2]]")},
+                        {keys}, SerialOptions({{GroupByAggregate::SUM, 0}}), &out));
+
+  // COUNT accepts any value type
+  AssertGroupBy({keys}, {strings}, SerialOptions({{GroupByAggregate::COUNT, 0}}),
+                {keys, ArrayFromJSON(int64(), "[1, 1]")});
+}
+
+}  // namespace compute
+}  // namespace arrow
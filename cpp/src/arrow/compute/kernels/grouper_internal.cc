@@ -0,0 +1,288 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/grouper_internal.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/dict_internal.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::DictionaryTraits;
+using internal::HashTraits;
+using internal::kKeyNotFound;
+using internal::ScalarHelper;
+
+namespace compute {
+
+namespace {
+
+// Mix one column's hash into a row hash. Algorithm 1 is used for the values
+// so that row hashes are independent from the memo tables' own hashing.
+inline uint64_t CombineHash(uint64_t row_hash, uint64_t value_hash) {
+  return (row_hash ^ value_hash) * 0x9E3779B97F4A7C15ULL;
+}
+
+template <typename Type, typename Scalar>
+class RegularKeyEncoder : public KeyEncoder {
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+ public:
+  RegularKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(new MemoTable(pool, 0)) {}
+
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    out_ids_ = ids;
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
+
+  Status VisitNull() {
+    *out_ids_++ = memo_table_->GetOrInsertNull();
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    return memo_table_->GetOrInsert(value, out_ids_++);
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* ids) const override {
+    LookupVisitor visitor{*memo_table_, ids};
+    return ArrayDataVisitor<Type>::Visit(data, &visitor);
+  }
+
+  Status Hash(const ArrayData& data, uint64_t* hashes) const override {
+    HashVisitor visitor{hashes};
+    return ArrayDataVisitor<Type>::Visit(data, &visitor);
+  }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) const override {
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, *memo_table_,
+                                                          0 /* start_offset */, out);
+  }
+
+  int32_t size() const override { return memo_table_->size(); }
+
+ private:
+  struct LookupVisitor {
+    const MemoTable& memo_table;
+    int32_t* out_ids;
+
+    Status VisitNull() {
+      *out_ids++ = memo_table.GetNull();
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      *out_ids++ = memo_table.Get(value);
+      return Status::OK();
+    }
+  };
+
+  struct HashVisitor {
+    uint64_t* out_hashes;
+
+    Status VisitNull() {
+      *out_hashes = CombineHash(*out_hashes, 0);
+      ++out_hashes;
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      *out_hashes = CombineHash(*out_hashes, ScalarHelper<Scalar, 1>::ComputeHash(value));
+      ++out_hashes;
+      return Status::OK();
+    }
+  };
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  std::unique_ptr<MemoTable> memo_table_;
+  int32_t* out_ids_ = NULLPTR;
+};
+
+template <typename Type, typename Enable = void>
+struct KeyEncoderTraits {};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using KeyEncoderImpl = RegularKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct KeyEncoderTraits<Type, enable_if_has_string_view<Type>> {
+  using KeyEncoderImpl = RegularKeyEncoder<Type, util::string_view>;
+};
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(StringType)                        \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+}  // namespace
+
+Status MakeKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                      std::unique_ptr<KeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                      \
+  case InType::type_id:                                                      \
+    out->reset(new typename KeyEncoderTraits<InType>::KeyEncoderImpl(type, pool)); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("Hashing not implemented for key type ",
+                                type->ToString());
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+Status Grouper::Init(const std::vector<std::shared_ptr<DataType>>& key_types,
+                     MemoryPool* pool) {
+  encoders_.resize(key_types.size());
+  for (size_t i = 0; i < key_types.size(); ++i) {
+    RETURN_NOT_OK(MakeKeyEncoder(key_types[i], pool, &encoders_[i]));
+  }
+  if (encoders_.size() > 1) {
+    tuple_memo_table_.reset(new internal::BinaryMemoTable(pool, 0));
+    group_key_ids_.resize(encoders_.size());
+    key_ids_.resize(encoders_.size());
+  }
+  return Status::OK();
+}
+
+Status Grouper::Consume(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                        std::vector<int32_t>* group_ids) {
+  group_ids->resize(length);
+  if (encoders_.size() == 1) {
+    RETURN_NOT_OK(encoders_[0]->Encode(*keys[0]->data(), group_ids->data()));
+    num_groups_ = encoders_[0]->size();
+    return Status::OK();
+  }
+
+  for (size_t k = 0; k < encoders_.size(); ++k) {
+    key_ids_[k].resize(length);
+    RETURN_NOT_OK(encoders_[k]->Encode(*keys[k]->data(), key_ids_[k].data()));
+  }
+
+  std::vector<int32_t> tuple(encoders_.size());
+  const auto tuple_size = static_cast<int32_t>(tuple.size() * sizeof(int32_t));
+  auto on_found = [](int32_t group_id) {};
+  auto on_not_found = [&](int32_t group_id) {
+    for (size_t k = 0; k < tuple.size(); ++k) {
+      group_key_ids_[k].push_back(tuple[k]);
+    }
+  };
+  for (int64_t i = 0; i < length; ++i) {
+    for (size_t k = 0; k < tuple.size(); ++k) {
+      tuple[k] = key_ids_[k][i];
+    }
+    RETURN_NOT_OK(tuple_memo_table_->GetOrInsert(tuple.data(), tuple_size, on_found,
+                                                 on_not_found, &(*group_ids)[i]));
+  }
+  num_groups_ = tuple_memo_table_->size();
+  return Status::OK();
+}
+
+Status Grouper::Lookup(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                       std::vector<int32_t>* group_ids) const {
+  group_ids->resize(length);
+  if (encoders_.size() == 1) {
+    return encoders_[0]->Lookup(*keys[0]->data(), group_ids->data());
+  }
+
+  // Local scratch space, as concurrent lookups cannot share key_ids_
+  std::vector<std::vector<int32_t>> key_ids(encoders_.size());
+  for (size_t k = 0; k < encoders_.size(); ++k) {
+    key_ids[k].resize(length);
+    RETURN_NOT_OK(encoders_[k]->Lookup(*keys[k]->data(), key_ids[k].data()));
+  }
+
+  std::vector<int32_t> tuple(encoders_.size());
+  const auto tuple_size = static_cast<int32_t>(tuple.size() * sizeof(int32_t));
+  for (int64_t i = 0; i < length; ++i) {
+    int32_t group_id = 0;
+    for (size_t k = 0; k < tuple.size() && group_id != kKeyNotFound; ++k) {
+      tuple[k] = key_ids[k][i];
+      if (tuple[k] == kKeyNotFound) {
+        group_id = kKeyNotFound;
+      }
+    }
+    if (group_id != kKeyNotFound) {
+      group_id = tuple_memo_table_->Get(tuple.data(), tuple_size);
+    }
+    (*group_ids)[i] = group_id;
+  }
+  return Status::OK();
+}
+
+Status Grouper::Hash(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                     std::vector<uint64_t>* hashes) const {
+  hashes->assign(length, 0);
+  for (size_t k = 0; k < encoders_.size(); ++k) {
+    RETURN_NOT_OK(encoders_[k]->Hash(*keys[k]->data(), hashes->data()));
+  }
+  return Status::OK();
+}
+
+Status Grouper::GetUniques(FunctionContext* ctx,
+                           std::vector<std::shared_ptr<Array>>* out) const {
+  out->resize(encoders_.size());
+  for (size_t k = 0; k < encoders_.size(); ++k) {
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(encoders_[k]->GetUniques(&uniques));
+    if (encoders_.size() == 1) {
+      (*out)[k] = MakeArray(uniques);
+      continue;
+    }
+    Int32Array indices(num_groups_, Buffer::Wrap(group_key_ids_[k]));
+    RETURN_NOT_OK(Take(ctx, *MakeArray(uniques), indices, TakeOptions(), &(*out)[k]));
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+struct ArrayData;
+class DataType;
+class MemoryPool;
+
+namespace compute {
+
+class FunctionContext;
+
+// ----------------------------------------------------------------------
+// Key encoding: map each row of a key column to a dense id, using the
+// memo table matching the column type.
+
+class KeyEncoder {
+ public:
+  virtual ~KeyEncoder() = default;
+
+  // Write the id of each row of `data` into `ids`, inserting unseen values.
+  virtual Status Encode(const ArrayData& data, int32_t* ids) = 0;
+
+  // Write the id of each row of `data` into `ids`, or kKeyNotFound for unseen
+  // values. Safe to call concurrently.
+  virtual Status Lookup(const ArrayData& data, int32_t* ids) const = 0;
+
+  // Mix the hash of each row of `data` into `hashes`. Hashes do not depend on
+  // the contents of the memo table.
+  virtual Status Hash(const ArrayData& data, uint64_t* hashes) const = 0;
+
+  // Distinct values seen so far, in id order.
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) const = 0;
+
+  virtual int32_t size() const = 0;
+};
+
+Status MakeKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                      std::unique_ptr<KeyEncoder>* out);
+
+// ----------------------------------------------------------------------
+// Grouper: map each row to a group id, a group being a distinct combination
+// of key values. Nulls are regular key values.
+//
+// With a single key column, group ids are the ids of the key encoder. With
+// several key columns, the tuple of per-column ids is itself memoized in a
+// BinaryMemoTable.
+
+class ARROW_EXPORT Grouper {
+ public:
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types,
+              MemoryPool* pool);
+
+  // Assign a group id to each row, creating groups for unseen keys.
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                 std::vector<int32_t>* group_ids);
+
+  // Find the group id of each row, or internal::kKeyNotFound if its key was
+  // never consumed. Safe to call concurrently, but not with Consume().
+  Status Lookup(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                std::vector<int32_t>* group_ids) const;
+
+  // Hash each row over all key columns. Equal keys hash equally across
+  // Groupers of the same key types.
+  Status Hash(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+              std::vector<uint64_t>* hashes) const;
+
+  // One array of length num_groups() per key column, such that row i holds
+  // the key values of group i.
+  Status GetUniques(FunctionContext* ctx, std::vector<std::shared_ptr<Array>>* out) const;
+
+  int32_t num_groups() const { return num_groups_; }
+
+ private:
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  // The following are only used with several key columns
+  std::unique_ptr<internal::BinaryMemoTable> tuple_memo_table_;
+  // Per key column, the key id of each group
+  std::vector<std::vector<int32_t>> group_key_ids_;
+  // Per key column, the key id of each row of the current batch
+  std::vector<std::vector<int32_t>> key_ids_;
+  int32_t num_groups_ = 0;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,538 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash_join.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::kKeyNotFound;
+
+namespace compute {
+
+namespace {
+
+template <typename Func>
+Status RunTasks(bool use_threads, int num_tasks, Func&& func) {
+  if (use_threads && num_tasks > 1) {
+    return internal::ParallelFor(num_tasks, std::forward<Func>(func));
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
+// Wrap indices without copying them; `data` must outlive the array.
+std::shared_ptr<Array> WrapIndices(const int64_t* data, int64_t length) {
+  return std::make_shared<Int64Array>(length, Buffer::Wrap(data, length));
+}
+
+Status TakeColumns(FunctionContext* ctx,
+                   const std::vector<std::shared_ptr<Array>>& columns,
+                   const Array& indices, std::vector<std::shared_ptr<Array>>* out) {
+  out->resize(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    RETURN_NOT_OK(Take(ctx, *columns[i], indices, TakeOptions(), &(*out)[i]));
+  }
+  return Status::OK();
+}
+
+Status ColumnToArray(MemoryPool* pool, const ChunkedArray& column,
+                     std::shared_ptr<Array>* out) {
+  switch (column.num_chunks()) {
+    case 0:
+      return MakeArrayOfNull(pool, column.type(), 0, out);
+    case 1:
+      *out = column.chunk(0);
+      return Status::OK();
+    default:
+      return Concatenate(column.chunks(), pool, out);
+  }
+}
+
+bool HasNullKey(const std::vector<std::shared_ptr<Array>>& keys, int64_t row) {
+  for (const auto& key : keys) {
+    if (key->null_count() != 0 && key->IsNull(row)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// ----------------------------------------------------------------------
+// Hash table on the build side of a join.
+//
+// Build rows are hash partitioned on their keys. Each partition has its own
+// Grouper, mapping distinct keys to group ids, and lists the build rows of
+// each group, so partitions can be built concurrently. Rows whose key has a
+// null are left out, as they never match.
+
+class JoinHashTable {
+ public:
+  JoinHashTable(FunctionContext* ctx, bool use_threads, int num_partitions)
+      : ctx_(ctx), use_threads_(use_threads), partitions_(num_partitions) {}
+
+  Status Build(const std::vector<std::shared_ptr<Array>>& keys, int64_t length) {
+    std::vector<std::shared_ptr<DataType>> key_types;
+    bool has_nulls = false;
+    for (const auto& key : keys) {
+      key_types.push_back(key->type());
+      has_nulls |= key->null_count() != 0;
+    }
+    for (auto& partition : partitions_) {
+      RETURN_NOT_OK(partition.grouper.Init(key_types, ctx_->memory_pool()));
+    }
+
+    if (partitions_.size() == 1 && !has_nulls) {
+      return BuildPartition(&partitions_[0], keys, NULLPTR, length);
+    }
+
+    std::vector<int64_t> offsets, rows;
+    RETURN_NOT_OK(Partition(keys, length, /*skip_null_keys=*/true, &offsets, &rows));
+    return RunTasks(use_threads_, num_partitions(), [&](int p) {
+      const int64_t* partition_rows = rows.data() + offsets[p];
+      const int64_t num_rows = offsets[p + 1] - offsets[p];
+      std::vector<std::shared_ptr<Array>> partition_keys;
+      RETURN_NOT_OK(TakeColumns(ctx_, keys, *WrapIndices(partition_rows, num_rows),
+                                &partition_keys));
+      return BuildPartition(&partitions_[p], partition_keys, partition_rows, num_rows);
+    });
+  }
+
+  // Pair each probe row with its matching build rows, in probe row order.
+  // For LEFT_OUTER joins, a probe row without a match is paired with a null
+  // build row (build_valid is 0). For semi and anti joins, only probe_rows
+  // is filled.
+  Status Probe(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+               JoinType join_type, std::vector<int64_t>* probe_rows,
+               std::vector<int64_t>* build_rows,
+               std::vector<uint8_t>* build_valid) const {
+    std::vector<int32_t> partition_ids, group_ids;
+    RETURN_NOT_OK(Lookup(keys, length, &partition_ids, &group_ids));
+
+    for (int64_t row = 0; row < length; ++row) {
+      const int32_t group_id = group_ids[row];
+      switch (join_type) {
+        case JoinType::LEFT_SEMI:
+          if (group_id != kKeyNotFound) {
+            probe_rows->push_back(row);
+          }
+          break;
+        case JoinType::LEFT_ANTI:
+          if (group_id == kKeyNotFound) {
+            probe_rows->push_back(row);
+          }
+          break;
+        case JoinType::INNER:
+        case JoinType::LEFT_OUTER:
+          if (group_id != kKeyNotFound) {
+            const auto& partition = partitions_[partition_ids[row]];
+            for (int64_t i = partition.offsets[group_id];
+                 i < partition.offsets[group_id + 1]; ++i) {
+              probe_rows->push_back(row);
+              build_rows->push_back(partition.rows[i]);
+              build_valid->push_back(1);
+            }
+          } else if (join_type == JoinType::LEFT_OUTER) {
+            probe_rows->push_back(row);
+            build_rows->push_back(0);
+            build_valid->push_back(0);
+          }
+          break;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct HashPartition {
+    Grouper grouper;
+    // Build rows of group g are rows[offsets[g], offsets[g + 1])
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> rows;
+  };
+
+  int num_partitions() const { return static_cast<int>(partitions_.size()); }
+
+  // `row_ids` maps rows of `keys` to build rows, nullptr for the identity
+  Status BuildPartition(HashPartition* partition,
+                        const std::vector<std::shared_ptr<Array>>& keys,
+                        const int64_t* row_ids, int64_t length) {
+    std::vector<int32_t> group_ids;
+    RETURN_NOT_OK(partition->grouper.Consume(keys, length, &group_ids));
+
+    // Counting sort of the rows by group id
+    auto& offsets = partition->offsets;
+    offsets.assign(partition->grouper.num_groups() + 1, 0);
+    for (int32_t group_id : group_ids) {
+      ++offsets[group_id + 1];
+    }
+    for (size_t g = 1; g < offsets.size(); ++g) {
+      offsets[g] += offsets[g - 1];
+    }
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    partition->rows.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      partition->rows[cursors[group_ids[i]]++] = row_ids ? row_ids[i] : i;
+    }
+    return Status::OK();
+  }
+
+  // Group rows by hash partition: rows of partition p are
+  // rows[offsets[p], offsets[p + 1]), in increasing order.
+  Status Partition(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                   bool skip_null_keys, std::vector<int64_t>* offsets,
+                   std::vector<int64_t>* rows) const {
+    std::vector<uint64_t> hashes;
+    RETURN_NOT_OK(partitions_[0].grouper.Hash(keys, length, &hashes));
+
+    const int64_t kSkipped = -1;
+    std::vector<int64_t> partition_ids(length);
+    offsets->assign(num_partitions() + 1, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      if (skip_null_keys && HasNullKey(keys, i)) {
+        partition_ids[i] = kSkipped;
+        continue;
+      }
+      partition_ids[i] = static_cast<int64_t>((hashes[i] >> 32) % num_partitions());
+      ++(*offsets)[partition_ids[i] + 1];
+    }
+    for (size_t p = 1; p < offsets->size(); ++p) {
+      (*offsets)[p] += (*offsets)[p - 1];
+    }
+    std::vector<int64_t> cursors(offsets->begin(), offsets->end() - 1);
+    rows->resize(offsets->back());
+    for (int64_t i = 0; i < length; ++i) {
+      if (partition_ids[i] != kSkipped) {
+        (*rows)[cursors[partition_ids[i]]++] = i;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Find the partition and group of each probe row, kKeyNotFound as group if
+  // it has no match. Null keys were not inserted, so they are never found.
+  Status Lookup(const std::vector<std::shared_ptr<Array>>& keys, int64_t length,
+                std::vector<int32_t>* partition_ids,
+                std::vector<int32_t>* group_ids) const {
+    partition_ids->assign(length, 0);
+    if (partitions_.size() == 1) {
+      return partitions_[0].grouper.Lookup(keys, length, group_ids);
+    }
+
+    group_ids->resize(length);
+    std::vector<int64_t> offsets, rows;
+    RETURN_NOT_OK(Partition(keys, length, /*skip_null_keys=*/false, &offsets, &rows));
+    std::vector<int32_t> partition_group_ids;
+    for (int p = 0; p < num_partitions(); ++p) {
+      const int64_t* partition_rows = rows.data() + offsets[p];
+      const int64_t num_rows = offsets[p + 1] - offsets[p];
+      if (num_rows == 0) continue;
+
+      std::vector<std::shared_ptr<Array>> partition_keys;
+      RETURN_NOT_OK(TakeColumns(ctx_, keys, *WrapIndices(partition_rows, num_rows),
+                                &partition_keys));
+      RETURN_NOT_OK(
+          partitions_[p].grouper.Lookup(partition_keys, num_rows, &partition_group_ids));
+      for (int64_t i = 0; i < num_rows; ++i) {
+        (*partition_ids)[partition_rows[i]] = p;
+        (*group_ids)[partition_rows[i]] = partition_group_ids[i];
+      }
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  bool use_threads_;
+  std::vector<HashPartition> partitions_;
+};
+
+// ----------------------------------------------------------------------
+// Schema resolution and output assembly
+
+struct JoinColumns {
+  std::vector<int> left_keys;
+  std::vector<int> right_keys;
+  // Right columns appearing in the output
+  std::vector<int> right_outputs;
+  std::shared_ptr<Schema> output_schema;
+};
+
+Status FindColumns(const Schema& schema, const std::vector<std::string>& names,
+                   std::vector<int>* indices) {
+  for (const auto& name : names) {
+    const int index = schema.GetFieldIndex(name);
+    if (index < 0) {
+      return Status::Invalid("Join key column not found: ", name);
+    }
+    indices->push_back(index);
+  }
+  return Status::OK();
+}
+
+Status ResolveJoinColumns(const Schema& left, const Schema& right,
+                          const HashJoinOptions& options, JoinColumns* out) {
+  if (options.left_keys.empty() ||
+      options.left_keys.size() != options.right_keys.size()) {
+    return Status::Invalid(
+        "Join expects the same non-zero number of left and right keys");
+  }
+  RETURN_NOT_OK(FindColumns(left, options.left_keys, &out->left_keys));
+  RETURN_NOT_OK(FindColumns(right, options.right_keys, &out->right_keys));
+  for (size_t i = 0; i < out->left_keys.size(); ++i) {
+    const auto& left_type = left.field(out->left_keys[i])->type();
+    const auto& right_type = right.field(out->right_keys[i])->type();
+    if (!left_type->Equals(*right_type)) {
+      return Status::TypeError("Join keys ", options.left_keys[i], " and ",
+                               options.right_keys[i], " have different types: ",
+                               *left_type, " vs ", *right_type);
+    }
+  }
+
+  std::vector<std::shared_ptr<Field>> fields = left.fields();
+  if (options.join_type == JoinType::INNER || options.join_type == JoinType::LEFT_OUTER) {
+    for (int i = 0; i < right.num_fields(); ++i) {
+      if (std::find(out->right_keys.begin(), out->right_keys.end(), i) !=
+          out->right_keys.end()) {
+        continue;
+      }
+      out->right_outputs.push_back(i);
+      auto field = right.field(i);
+      if (options.join_type == JoinType::LEFT_OUTER) {
+        field = field->WithNullable(true);
+      }
+      fields.push_back(std::move(field));
+    }
+  }
+  out->output_schema = schema(std::move(fields));
+  return Status::OK();
+}
+
+// Left columns taken at left_rows, then right columns taken at right_rows
+Status AssembleBatch(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const std::vector<std::shared_ptr<Array>>& left_columns,
+                     const std::vector<int64_t>& left_rows,
+                     const std::vector<std::shared_ptr<Array>>& right_columns,
+                     const std::vector<int64_t>& right_rows,
+                     const std::vector<uint8_t>& right_valid,
+                     std::shared_ptr<RecordBatch>* out) {
+  const auto length = static_cast<int64_t>(left_rows.size());
+  std::vector<std::shared_ptr<Array>> columns;
+  RETURN_NOT_OK(
+      TakeColumns(ctx, left_columns, *WrapIndices(left_rows.data(), length), &columns));
+
+  if (!right_columns.empty()) {
+    Int64Builder builder(ctx->memory_pool());
+    // All right rows are valid if right_valid is empty
+    RETURN_NOT_OK(builder.AppendValues(
+        right_rows.data(), length, right_valid.empty() ? nullptr : right_valid.data()));
+    std::shared_ptr<Array> right_indices;
+    RETURN_NOT_OK(builder.Finish(&right_indices));
+    std::vector<std::shared_ptr<Array>> taken;
+    RETURN_NOT_OK(TakeColumns(ctx, right_columns, *right_indices, &taken));
+    columns.insert(columns.end(), taken.begin(), taken.end());
+  }
+  *out = RecordBatch::Make(schema, length, std::move(columns));
+  return Status::OK();
+}
+
+std::vector<std::shared_ptr<Array>> SelectColumns(
+    const std::vector<std::shared_ptr<Array>>& columns, const std::vector<int>& indices) {
+  std::vector<std::shared_ptr<Array>> selected;
+  for (int i : indices) {
+    selected.push_back(columns[i]);
+  }
+  return selected;
+}
+
+std::vector<std::shared_ptr<Array>> BatchColumns(const RecordBatch& batch) {
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns[i] = batch.column(i);
+  }
+  return columns;
+}
+
+Status TableToArrays(MemoryPool* pool, const Table& table,
+                     std::vector<std::shared_ptr<Array>>* out) {
+  out->resize(table.num_columns());
+  for (int i = 0; i < table.num_columns(); ++i) {
+    RETURN_NOT_OK(ColumnToArray(pool, *table.column(i), &(*out)[i]));
+  }
+  return Status::OK();
+}
+
+int NumPartitions(FunctionContext* ctx, const HashJoinOptions& options) {
+  if (options.num_partitions > 0) {
+    return options.num_partitions;
+  }
+  if (options.use_threads && ctx->use_threads()) {
+    return std::max(1, internal::GetCpuThreadPool()->GetCapacity());
+  }
+  return 1;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// HashJoiner implementation
+
+class HashJoiner::Impl {
+ public:
+  Impl(FunctionContext* ctx, const HashJoinOptions& options)
+      : ctx_(ctx),
+        options_(options),
+        table_(ctx, options.use_threads && ctx->use_threads(),
+               NumPartitions(ctx, options)) {}
+
+  Status Init(const std::shared_ptr<Schema>& left_schema, const Table& right) {
+    left_schema_ = left_schema;
+    RETURN_NOT_OK(ResolveJoinColumns(*left_schema, *right.schema(), options_, &columns_));
+
+    std::vector<std::shared_ptr<Array>> right_columns;
+    RETURN_NOT_OK(TableToArrays(ctx_->memory_pool(), right, &right_columns));
+    right_outputs_ = SelectColumns(right_columns, columns_.right_outputs);
+    return table_.Build(SelectColumns(right_columns, columns_.right_keys),
+                        right.num_rows());
+  }
+
+  Status Probe(const RecordBatch& left, std::shared_ptr<RecordBatch>* out) const {
+    if (!left.schema()->Equals(*left_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("HashJoiner expects batches of schema ", *left_schema_,
+                             ", got ", *left.schema());
+    }
+    std::vector<int64_t> left_rows, right_rows;
+    std::vector<uint8_t> right_valid;
+    RETURN_NOT_OK(table_.Probe(SelectColumns(BatchColumns(left), columns_.left_keys),
+                               left.num_rows(), options_.join_type, &left_rows,
+                               &right_rows, &right_valid));
+    return AssembleBatch(ctx_, columns_.output_schema, BatchColumns(left), left_rows,
+                         right_outputs_, right_rows, right_valid, out);
+  }
+
+  std::shared_ptr<Schema> schema() const { return columns_.output_schema; }
+
+ private:
+  FunctionContext* ctx_;
+  HashJoinOptions options_;
+  std::shared_ptr<Schema> left_schema_;
+  JoinColumns columns_;
+  std::vector<std::shared_ptr<Array>> right_outputs_;
+  JoinHashTable table_;
+};
+
+HashJoiner::HashJoiner(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+HashJoiner::~HashJoiner() {}
+
+Status HashJoiner::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                        const std::shared_ptr<Table>& right,
+                        const HashJoinOptions& options,
+                        std::unique_ptr<HashJoiner>* out) {
+  std::unique_ptr<Impl> impl(new Impl(ctx, options));
+  RETURN_NOT_OK(impl->Init(left_schema, *right));
+  out->reset(new HashJoiner(std::move(impl)));
+  return Status::OK();
+}
+
+Status HashJoiner::Probe(const RecordBatch& left,
+                         std::shared_ptr<RecordBatch>* out) const {
+  return impl_->Probe(left, out);
+}
+
+std::shared_ptr<Schema> HashJoiner::schema() const { return impl_->schema(); }
+
+// ----------------------------------------------------------------------
+// Table join
+
+Status HashJoin(FunctionContext* ctx, const std::shared_ptr<Table>& left,
+                const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                std::shared_ptr<Table>* out) {
+  if (options.probe_batch_size <= 0) {
+    return Status::Invalid("HashJoinOptions::probe_batch_size must be positive");
+  }
+  const bool use_threads = options.use_threads && ctx->use_threads();
+  // Build on the smaller side; only inner joins are symmetric
+  const bool build_left =
+      options.join_type == JoinType::INNER && left->num_rows() < right->num_rows();
+  const auto& probe_side = build_left ? right : left;
+
+  std::vector<std::shared_ptr<RecordBatch>> probe_batches;
+  TableBatchReader reader(*probe_side);
+  reader.set_chunksize(options.probe_batch_size);
+  RETURN_NOT_OK(reader.ReadAll(&probe_batches));
+
+  std::shared_ptr<Schema> output_schema;
+  const auto num_batches = static_cast<int>(probe_batches.size());
+  std::vector<std::shared_ptr<RecordBatch>> output_batches(num_batches);
+  if (build_left) {
+    JoinColumns columns;
+    RETURN_NOT_OK(
+        ResolveJoinColumns(*left->schema(), *right->schema(), options, &columns));
+    output_schema = columns.output_schema;
+
+    std::vector<std::shared_ptr<Array>> left_columns;
+    RETURN_NOT_OK(TableToArrays(ctx->memory_pool(), *left, &left_columns));
+    JoinHashTable table(ctx, use_threads, NumPartitions(ctx, options));
+    RETURN_NOT_OK(table.Build(SelectColumns(left_columns, columns.left_keys),
+                              left->num_rows()));
+
+    RETURN_NOT_OK(RunTasks(use_threads, num_batches, [&](int i) {
+      const auto& batch = *probe_batches[i];
+      std::vector<int64_t> right_rows, left_rows;
+      std::vector<uint8_t> left_valid;
+      RETURN_NOT_OK(table.Probe(SelectColumns(BatchColumns(batch), columns.right_keys),
+                                batch.num_rows(), JoinType::INNER, &right_rows,
+                                &left_rows, &left_valid));
+      return AssembleBatch(ctx, output_schema, left_columns, left_rows,
+                           SelectColumns(BatchColumns(batch), columns.right_outputs),
+                           right_rows, /*right_valid=*/{}, &output_batches[i]);
+    }));
+  } else {
+    std::unique_ptr<HashJoiner> joiner;
+    RETURN_NOT_OK(HashJoiner::Make(ctx, left->schema(), right, options, &joiner));
+    output_schema = joiner->schema();
+
+    RETURN_NOT_OK(RunTasks(use_threads, num_batches, [&](int i) {
+      return joiner->Probe(*probe_batches[i], &output_batches[i]);
+    }));
+  }
+  return Table::FromRecordBatches(output_schema, output_batches, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Kind of equi-join
+enum class JoinType {
+  /// Pairs of left and right rows with equal keys
+  INNER,
+  /// As INNER, plus left rows without a match, padded with nulls
+  LEFT_OUTER,
+  /// Left rows with at least one match, right columns omitted
+  LEFT_SEMI,
+  /// Left rows without any match, right columns omitted
+  LEFT_ANTI,
+};
+
+/// \class HashJoinOptions
+///
+/// Describe an equi-join: left_keys[i] is compared with right_keys[i]. Rows
+/// with a null key never match.
+struct ARROW_EXPORT HashJoinOptions {
+  HashJoinOptions(JoinType join_type, std::vector<std::string> left_keys,
+                  std::vector<std::string> right_keys)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)) {}
+
+  JoinType join_type;
+  std::vector<std::string> left_keys;
+  std::vector<std::string> right_keys;
+
+  /// Build and probe in parallel on the CPU thread pool, if the
+  /// FunctionContext allows it
+  bool use_threads = true;
+
+  /// Number of hash partitions of the build side, each built independently;
+  /// 0 picks the capacity of the CPU thread pool
+  int num_partitions = 0;
+
+  /// Number of left rows probed by a single task
+  int64_t probe_batch_size = 1 << 16;
+};
+
+/// \brief Hash table on the right side of a join, probed with batches of
+/// left rows
+///
+/// The right table's key columns are hash partitioned, and each partition
+/// maps its distinct keys to the matching rows through the memo tables in
+/// arrow/util/hashing.h. Output rows are gathered with the Take kernel.
+///
+/// The output has the columns of the left side followed, for INNER and
+/// LEFT_OUTER joins, by the non-key columns of the right side. Output rows
+/// follow the order of the probed left rows.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT HashJoiner {
+ public:
+  ~HashJoiner();
+
+  /// \brief Build the hash table
+  ///
+  /// \param[in] ctx the FunctionContext, must outlive the joiner
+  /// \param[in] left_schema schema of the probed batches
+  /// \param[in] right table to build the hash table on
+  /// \param[in] options join type, keys and parallelism
+  /// \param[out] out the resulting joiner
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                     const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                     std::unique_ptr<HashJoiner>* out);
+
+  /// \brief Join a batch of left rows with the right table
+  ///
+  /// Safe to call concurrently.
+  Status Probe(const RecordBatch& left, std::shared_ptr<RecordBatch>* out) const;
+
+  /// \brief Schema of the joined batches
+  std::shared_ptr<Schema> schema() const;
+
+ private:
+  class Impl;
+  explicit HashJoiner(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Join two tables on equal keys
+///
+/// For INNER joins the hash table is built on the smaller table; otherwise it
+/// is built on the right table and probed with the left one. The output
+/// schema is as for HashJoiner. Row order is unspecified.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left left table
+/// \param[in] right right table
+/// \param[in] options join type, keys and parallelism
+/// \param[out] out joined table
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* ctx, const std::shared_ptr<Table>& left,
+                const std::shared_ptr<Table>& right, const HashJoinOptions& options,
+                std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
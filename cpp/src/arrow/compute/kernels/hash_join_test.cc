@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash_join.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ public:
+  void SetUp() override {
+    left_schema_ = schema({field("id", int32()), field("l", utf8())});
+    right_schema_ = schema({field("key", int32()), field("r", int64())});
+    left_ = TableFromJSON(left_schema_, {R"([{"id": 1, "l": "a"}, {"id": 2, "l": "b"}])",
+                                         R"([{"id": 2, "l": "c"}, {"id": null, "l": "d"},
+                                             {"id": 3, "l": "e"}])"});
+    right_ = TableFromJSON(right_schema_, {R"([{"key": 2, "r": 20}, {"key": 3, "r": 30},
+                                               {"key": 3, "r": 31}])",
+                                           R"([{"key": 4, "r": 40},
+                                               {"key": null, "r": 0}])"});
+  }
+
+  // Sort on all columns, as the row order of HashJoin is unspecified
+  std::shared_ptr<Table> SortTable(const std::shared_ptr<Table>& table) {
+    SortOptions options;
+    for (const auto& field : table->schema()->fields()) {
+      options.sort_keys.emplace_back(field->name());
+    }
+    std::shared_ptr<Array> indices;
+    std::shared_ptr<Table> sorted;
+    ABORT_NOT_OK(SortToIndices(&this->ctx_, *table, options, &indices));
+    ABORT_NOT_OK(Take(&this->ctx_, *table, *indices, TakeOptions(), &sorted));
+    ABORT_NOT_OK(sorted->CombineChunks(default_memory_pool(), &sorted));
+    return sorted;
+  }
+
+  void AssertJoin(const std::shared_ptr<Table>& left, const std::shared_ptr<Table>& right,
+                  const HashJoinOptions& options,
+                  const std::shared_ptr<Table>& expected) {
+    std::shared_ptr<Table> out;
+    ASSERT_OK(HashJoin(&this->ctx_, left, right, options, &out));
+    ASSERT_OK(out->ValidateFull());
+    AssertSchemaEqual(*expected->schema(), *out->schema());
+    AssertTablesEqual(*SortTable(expected), *SortTable(out));
+  }
+
+  HashJoinOptions Options(JoinType join_type) {
+    return HashJoinOptions(join_type, {"id"}, {"key"});
+  }
+
+ protected:
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  auto expected_schema =
+      schema({field("id", int32()), field("l", utf8()), field("r", int64())});
+  auto expected = TableFromJSON(expected_schema, {R"([
+      {"id": 2, "l": "b", "r": 20}, {"id": 2, "l": "c", "r": 20},
+      {"id": 3, "l": "e", "r": 30}, {"id": 3, "l": "e", "r": 31}])"});
+  AssertJoin(left_, right_, Options(JoinType::INNER), expected);
+
+  // The hash table is built on the smaller left side instead
+  auto small_left = TableFromJSON(left_schema_, {R"([{"id": 3, "l": "e"}])"});
+  AssertJoin(small_left, right_, Options(JoinType::INNER),
+             TableFromJSON(expected_schema, {R"([{"id": 3, "l": "e", "r": 30},
+                                                 {"id": 3, "l": "e", "r": 31}])"}));
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  auto expected = TableFromJSON(
+      schema({field("id", int32()), field("l", utf8()), field("r", int64(), true)}),
+      {R"([{"id": 1, "l": "a", "r": null}, {"id": 2, "l": "b", "r": 20},
+           {"id": 2, "l": "c", "r": 20}, {"id": null, "l": "d", "r": null},
+           {"id": 3, "l": "e", "r": 30}, {"id": 3, "l": "e", "r": 31}])"});
+  AssertJoin(left_, right_, Options(JoinType::LEFT_OUTER), expected);
+}
+
+TEST_F(TestHashJoin, SemiAndAnti) {
+  AssertJoin(left_, right_, Options(JoinType::LEFT_SEMI),
+             TableFromJSON(left_schema_, {R"([{"id": 2, "l": "b"}, {"id": 2, "l": "c"},
+                                              {"id": 3, "l": "e"}])"}));
+  AssertJoin(left_, right_, Options(JoinType::LEFT_ANTI),
+             TableFromJSON(left_schema_, {R"([{"id": 1, "l": "a"},
+                                              {"id": null, "l": "d"}])"}));
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto left = TableFromJSON(schema({field("a", utf8()), field("b", int8())}),
+                            {R"([{"a": "x", "b": 1}, {"a": "x", "b": 2},
+                                 {"a": "y", "b": 1}, {"a": null, "b": 1}])"});
+  auto right_schema =
+      schema({field("b2", int8()), field("a2", utf8()), field("v", float64())});
+  auto right = TableFromJSON(right_schema, {R"([{"b2": 1, "a2": "x", "v": 1.5},
+                                                {"b2": 1, "a2": "y", "v": 2.5},
+                                                {"b2": 3, "a2": "x", "v": 3.5},
+                                                {"b2": 1, "a2": null, "v": 4.5}])"});
+  HashJoinOptions options(JoinType::INNER, {"a", "b"}, {"a2", "b2"});
+  AssertJoin(left, right, options,
+             TableFromJSON(schema({field("a", utf8()), field("b", int8()),
+                                   field("v", float64())}),
+                           {R"([{"a": "x", "b": 1, "v": 1.5},
+                                {"a": "y", "b": 1, "v": 2.5}])"}));
+}
+
+TEST_F(TestHashJoin, EmptyInputs) {
+  auto empty_left = TableFromJSON(left_schema_, {"[]"});
+  auto empty_right = TableFromJSON(right_schema_, {"[]"});
+  auto expected_schema =
+      schema({field("id", int32()), field("l", utf8()), field("r", int64())});
+  AssertJoin(empty_left, right_, Options(JoinType::INNER),
+             TableFromJSON(expected_schema, {"[]"}));
+  AssertJoin(left_, empty_right, Options(JoinType::INNER),
+             TableFromJSON(expected_schema, {"[]"}));
+  AssertJoin(left_, empty_right, Options(JoinType::LEFT_ANTI), left_);
+}
+
+TEST_F(TestHashJoin, PartitionedMatchesSerial) {
+  random::RandomArrayGenerator rand(0x3b1d7);
+  auto make_table = [&](const std::shared_ptr<Schema>& schema, int64_t length) {
+    return Table::Make(schema, {rand.Int32(length, 0, 500, 0.05),
+                                rand.Int64(length, -1000, 1000, 0.1)});
+  };
+  auto left = make_table(schema({field("id", int32()), field("l", int64())}), 5000);
+  auto right = make_table(right_schema_, 2000);
+
+  for (auto join_type : {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::LEFT_SEMI,
+                         JoinType::LEFT_ANTI}) {
+    auto options = Options(join_type);
+    options.use_threads = false;
+    options.num_partitions = 1;
+    std::shared_ptr<Table> expected;
+    ASSERT_OK(HashJoin(&this->ctx_, left, right, options, &expected));
+
+    options.use_threads = true;
+    options.num_partitions = 7;
+    options.probe_batch_size = 999;
+    AssertJoin(left, right, options, expected);
+  }
+}
+
+TEST_F(TestHashJoin, Joiner) {
+  std::unique_ptr<HashJoiner> joiner;
+  ASSERT_OK(HashJoiner::Make(&this->ctx_, left_schema_, right_,
+                             Options(JoinType::LEFT_OUTER), &joiner));
+  auto expected_schema =
+      schema({field("id", int32()), field("l", utf8()), field("r", int64(), true)});
+  AssertSchemaEqual(*expected_schema, *joiner->schema());
+
+  // Output rows follow the order of the probed rows
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(joiner->Probe(*RecordBatchFromJSON(left_schema_, R"([
+      {"id": 3, "l": "p"}, {"id": 5, "l": "q"}, {"id": 2, "l": "r"}])"),
+                          &out));
+  AssertBatchesEqual(*RecordBatchFromJSON(expected_schema, R"([
+      {"id": 3, "l": "p", "r": 30}, {"id": 3, "l": "p", "r": 31},
+      {"id": 5, "l": "q", "r": null}, {"id": 2, "l": "r", "r": 20}])"),
+                     *out);
+
+  ASSERT_RAISES(Invalid, joiner->Probe(*RecordBatchFromJSON(right_schema_, "[]"), &out));
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::shared_ptr<Table> out;
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, left_, right_,
+                                  HashJoinOptions(JoinType::INNER, {}, {}), &out));
+  ASSERT_RAISES(Invalid,
+                HashJoin(&this->ctx_, left_, right_,
+                         HashJoinOptions(JoinType::INNER, {"id"}, {"key", "r"}), &out));
+  ASSERT_RAISES(Invalid,
+                HashJoin(&this->ctx_, left_, right_,
+                         HashJoinOptions(JoinType::INNER, {"x"}, {"key"}), &out));
+  ASSERT_RAISES(TypeError,
+                HashJoin(&this->ctx_, left_, right_,
+                         HashJoinOptions(JoinType::INNER, {"l"}, {"key"}), &out));
+
+  auto list_table = TableFromJSON(schema({field("key", list(int32()))}), {"[]"});
+  ASSERT_RAISES(NotImplemented,
+                HashJoin(&this->ctx_, list_table, list_table,
+                         HashJoinOptions(JoinType::INNER, {"key"}, {"key"}), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
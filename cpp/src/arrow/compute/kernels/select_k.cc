@@ -0,0 +1,409 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/select_k.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+#define PROCESS_SELECTABLE_TYPES(PROCESS) \
+  PROCESS(BooleanType)                    \
+  PROCESS(UInt8Type)                      \
+  PROCESS(Int8Type)                       \
+  PROCESS(UInt16Type)                     \
+  PROCESS(Int16Type)                      \
+  PROCESS(UInt32Type)                     \
+  PROCESS(Int32Type)                      \
+  PROCESS(UInt64Type)                     \
+  PROCESS(Int64Type)                      \
+  PROCESS(FloatType)                      \
+  PROCESS(DoubleType)                     \
+  PROCESS(Date32Type)                     \
+  PROCESS(Date64Type)                     \
+  PROCESS(Time32Type)                     \
+  PROCESS(Time64Type)                     \
+  PROCESS(TimestampType)                  \
+  PROCESS(DurationType)                   \
+  PROCESS(BinaryType)                     \
+  PROCESS(StringType)                     \
+  PROCESS(LargeBinaryType)                \
+  PROCESS(LargeStringType)                \
+  PROCESS(FixedSizeBinaryType)
+
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+
+bool IsNaN(float value) { return std::isnan(value); }
+
+bool IsNaN(double value) { return std::isnan(value); }
+
+// Order two indices of non-null values: true if `left` comes first. Equal
+// values are ordered by index, which makes selections stable. NaNs come after
+// all other values, whatever the order, so that the comparison is a strict
+// weak ordering.
+template <typename ArrayType>
+class IndexLess {
+ public:
+  IndexLess(const ArrayType& values, SortOrder order) : values_(values), order_(order) {}
+
+  bool operator()(int64_t left, int64_t right) const {
+    const auto left_value = values_.GetView(left);
+    const auto right_value = values_.GetView(right);
+    const bool left_nan = IsNaN(left_value);
+    const bool right_nan = IsNaN(right_value);
+    if (left_nan || right_nan) {
+      return left_nan == right_nan ? left < right : right_nan;
+    }
+    if (left_value == right_value) {
+      return left < right;
+    }
+    return order_ == SortOrder::ASCENDING ? left_value < right_value
+                                          : right_value < left_value;
+  }
+
+ private:
+  const ArrayType& values_;
+  const SortOrder order_;
+};
+
+template <typename ArrowType>
+struct NthPartitioner {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  static void Exec(const Array& array, int64_t n, int64_t* indices_begin,
+                   int64_t* indices_end) {
+    const auto& values = checked_cast<const ArrayType&>(array);
+    std::iota(indices_begin, indices_end, 0);
+
+    auto nulls_begin = indices_end;
+    if (values.null_count() != 0) {
+      nulls_begin =
+          std::partition(indices_begin, indices_end,
+                         [&values](int64_t ind) { return !values.IsNull(ind); });
+    }
+    auto nth = indices_begin + n;
+    if (nth < nulls_begin) {
+      std::nth_element(indices_begin, nth, nulls_begin,
+                       IndexLess<ArrayType>(values, SortOrder::ASCENDING));
+    }
+  }
+};
+
+template <typename ArrowType>
+struct TopKSelectorImpl {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  // Append the indices of the k first values, in sort order, to `out`
+  static void Exec(const Array& array, int64_t k, SortOrder order,
+                   NullPlacement null_placement, std::vector<int64_t>* out) {
+    const auto& values = checked_cast<const ArrayType&>(array);
+    const int64_t length = values.length();
+    const bool has_nulls = values.null_count() != 0;
+    k = std::min(k, length);
+
+    auto append_nulls = [&](int64_t count) {
+      for (int64_t i = 0; count > 0 && i < length; ++i) {
+        if (values.IsNull(i)) {
+          out->push_back(i);
+          --count;
+        }
+      }
+    };
+
+    int64_t capacity = k;
+    if (null_placement == NullPlacement::AT_START) {
+      const int64_t num_nulls = std::min(k, values.null_count());
+      append_nulls(num_nulls);
+      capacity -= num_nulls;
+    }
+
+    // Max-heap of the best values so far: its top is the first to evict
+    IndexLess<ArrayType> less(values, order);
+    std::vector<int64_t> heap;
+    heap.reserve(capacity);
+    for (int64_t i = 0; capacity > 0 && i < length; ++i) {
+      if (has_nulls && values.IsNull(i)) {
+        continue;
+      }
+      if (static_cast<int64_t>(heap.size()) < capacity) {
+        heap.push_back(i);
+        std::push_heap(heap.begin(), heap.end(), less);
+      } else if (less(i, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), less);
+        heap.back() = i;
+        std::push_heap(heap.begin(), heap.end(), less);
+      }
+    }
+    std::sort_heap(heap.begin(), heap.end(), less);
+    out->insert(out->end(), heap.begin(), heap.end());
+
+    if (null_placement == NullPlacement::AT_END) {
+      append_nulls(k - static_cast<int64_t>(heap.size()));
+    }
+  }
+};
+
+template <template <typename> class Impl, typename... Args>
+Status DispatchSelect(const DataType& type, Args&&... args) {
+  switch (type.id()) {
+#define SELECT_K_CASE(TYPE_CLASS)                       \
+  case TYPE_CLASS::type_id:                             \
+    Impl<TYPE_CLASS>::Exec(std::forward<Args>(args)...); \
+    return Status::OK();
+
+    PROCESS_SELECTABLE_TYPES(SELECT_K_CASE)
+
+#undef SELECT_K_CASE
+
+    default:
+      break;
+  }
+  return Status::NotImplemented("Selecting from ", type, " arrays");
+}
+
+Status CheckSelectable(const DataType& type) {
+  switch (type.id()) {
+#define SELECT_K_CASE(TYPE_CLASS) \
+  case TYPE_CLASS::type_id:       \
+    return Status::OK();
+
+    PROCESS_SELECTABLE_TYPES(SELECT_K_CASE)
+
+#undef SELECT_K_CASE
+
+    default:
+      break;
+  }
+  return Status::NotImplemented("Selecting from ", type, " arrays");
+}
+
+Status SelectTopK(const Array& values, int64_t k, SortOrder order,
+                  NullPlacement null_placement, std::vector<int64_t>* out) {
+  if (k < 0) {
+    return Status::Invalid("TopK expects a non-negative k, got ", k);
+  }
+  out->clear();
+  return DispatchSelect<TopKSelectorImpl>(*values.type(), values, k, order,
+                                          null_placement, out);
+}
+
+Status MakeIndices(FunctionContext* ctx, const std::vector<int64_t>& indices,
+                   int64_t offset, std::shared_ptr<Array>* out) {
+  const int64_t length = static_cast<int64_t>(indices.size());
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t),
+                               &indices_buf));
+  auto raw_indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  for (int64_t i = 0; i < length; ++i) {
+    raw_indices[i] = static_cast<uint64_t>(indices[i] + offset);
+  }
+  *out = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status NthToIndices(FunctionContext* ctx, const Array& values, int64_t n,
+                    std::shared_ptr<Array>* offsets) {
+  if (n < 0 || n > values.length()) {
+    return Status::Invalid("NthToIndices expects n between 0 and ", values.length(),
+                           ", got ", n);
+  }
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), values.length() * sizeof(uint64_t),
+                               &indices_buf));
+  auto indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+  RETURN_NOT_OK(DispatchSelect<NthPartitioner>(*values.type(), values, n, indices_begin,
+                                               indices_begin + values.length()));
+  *offsets = std::make_shared<UInt64Array>(values.length(), indices_buf);
+  return Status::OK();
+}
+
+Status TopK(FunctionContext* ctx, const Array& values, int64_t k, SortOrder order,
+            std::shared_ptr<Array>* offsets) {
+  std::vector<int64_t> indices;
+  RETURN_NOT_OK(SelectTopK(values, k, order, NullPlacement::AT_END, &indices));
+  return MakeIndices(ctx, indices, 0, offsets);
+}
+
+Status TopK(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+            SortOrder order, std::shared_ptr<Array>* offsets) {
+  auto schema = ::arrow::schema({field("values", values.type())});
+  std::unique_ptr<TopKSelector> selector;
+  RETURN_NOT_OK(TopKSelector::Make(ctx, schema, SortKey("values", order), k, &selector));
+  for (const auto& chunk : values.chunks()) {
+    RETURN_NOT_OK(
+        selector->Consume(*RecordBatch::Make(schema, chunk->length(), {chunk})));
+  }
+  std::shared_ptr<RecordBatch> selected;
+  return selector->Finish(&selected, offsets);
+}
+
+class TopKSelector::Impl {
+ public:
+  Impl(FunctionContext* ctx, std::shared_ptr<Schema> schema, SortKey sort_key,
+       int column_index, int64_t k)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        sort_key_(std::move(sort_key)),
+        column_index_(column_index),
+        k_(k) {}
+
+  Status Consume(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("TopKSelector expects batches of schema ", *schema_,
+                             ", got ", *batch.schema());
+    }
+
+    // Select among the new rows first, so that only up to k of them are
+    // copied, then among those and the currently selected rows
+    std::shared_ptr<RecordBatch> candidates;
+    std::shared_ptr<Array> candidate_indices;
+    RETURN_NOT_OK(Select(batch, num_rows_seen_, &candidates, &candidate_indices));
+    num_rows_seen_ += batch.num_rows();
+    if (candidates->num_rows() == 0) {
+      return Status::OK();
+    }
+    if (selected_ == nullptr) {
+      selected_ = std::move(candidates);
+      selected_indices_ = std::move(candidate_indices);
+      return Status::OK();
+    }
+
+    // Previously selected rows come first and win ties
+    std::vector<std::shared_ptr<Array>> columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      RETURN_NOT_OK(Concatenate({selected_->column(i), candidates->column(i)},
+                                ctx_->memory_pool(), &columns[i]));
+    }
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(Concatenate({selected_indices_, candidate_indices},
+                              ctx_->memory_pool(), &indices));
+    auto combined = RecordBatch::Make(schema_, indices->length(), std::move(columns));
+
+    std::shared_ptr<Array> take_indices;
+    RETURN_NOT_OK(Select(*combined, 0, &selected_, &take_indices));
+    return Take(ctx_, *indices, *take_indices, TakeOptions(), &selected_indices_);
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out, std::shared_ptr<Array>* row_indices) {
+    if (selected_ == nullptr) {
+      std::vector<std::shared_ptr<Array>> columns(schema_->num_fields());
+      for (int i = 0; i < schema_->num_fields(); ++i) {
+        RETURN_NOT_OK(MakeArrayOfNull(ctx_->memory_pool(), schema_->field(i)->type(), 0,
+                                      &columns[i]));
+      }
+      *out = RecordBatch::Make(schema_, 0, std::move(columns));
+      return MakeIndices(ctx_, {}, 0, row_indices);
+    }
+    *out = selected_;
+    *row_indices = selected_indices_;
+    return Status::OK();
+  }
+
+  int64_t num_rows_seen() const { return num_rows_seen_; }
+
+ private:
+  // Take the k first rows of `batch` in sort order, along with their indices
+  // shifted by `offset`
+  Status Select(const RecordBatch& batch, int64_t offset,
+                std::shared_ptr<RecordBatch>* out, std::shared_ptr<Array>* indices) {
+    std::vector<int64_t> selection;
+    RETURN_NOT_OK(SelectTopK(*batch.column(column_index_), k_, sort_key_.order,
+                             sort_key_.null_placement, &selection));
+    std::shared_ptr<Array> take_indices;
+    RETURN_NOT_OK(MakeIndices(ctx_, selection, 0, &take_indices));
+    RETURN_NOT_OK(Take(ctx_, batch, *take_indices, TakeOptions(), out));
+    if (offset == 0) {
+      *indices = std::move(take_indices);
+      return Status::OK();
+    }
+    return MakeIndices(ctx_, selection, offset, indices);
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  SortKey sort_key_;
+  int column_index_;
+  int64_t k_;
+
+  // The best rows seen so far, in sort order, and their positions in the stream
+  std::shared_ptr<RecordBatch> selected_;
+  std::shared_ptr<Array> selected_indices_;
+  int64_t num_rows_seen_ = 0;
+};
+
+TopKSelector::TopKSelector(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+TopKSelector::~TopKSelector() {}
+
+Status TopKSelector::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                          const SortKey& sort_key, int64_t k,
+                          std::unique_ptr<TopKSelector>* out) {
+  if (k < 0) {
+    return Status::Invalid("TopKSelector expects a non-negative k, got ", k);
+  }
+  const int column_index = schema->GetFieldIndex(sort_key.name);
+  if (column_index < 0) {
+    return Status::Invalid("Sort key column not found: ", sort_key.name);
+  }
+  RETURN_NOT_OK(CheckSelectable(*schema->field(column_index)->type()));
+  out->reset(new TopKSelector(
+      std::unique_ptr<Impl>(new Impl(ctx, schema, sort_key, column_index, k))));
+  return Status::OK();
+}
+
+Status TopKSelector::Consume(const RecordBatch& batch) { return impl_->Consume(batch); }
+
+Status TopKSelector::Finish(std::shared_ptr<RecordBatch>* out) {
+  std::shared_ptr<Array> row_indices;
+  return impl_->Finish(out, &row_indices);
+}
+
+Status TopKSelector::Finish(std::shared_ptr<RecordBatch>* out,
+                            std::shared_ptr<Array>* row_indices) {
+  return impl_->Finish(out, row_indices);
+}
+
+int64_t TopKSelector::num_rows_seen() const { return impl_->num_rows_seen(); }
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class ChunkedArray;
+class RecordBatch;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Returns indices that partially sort an array around its n-th element.
+///
+/// The output has the same length as the input. The n-th output index points to
+/// the value that would be at position n if the array were sorted in ascending
+/// order, NaNs then nulls at the end. Indices before it point to values that
+/// are less or equal, indices after it to values that are greater or equal (or
+/// NaN, or null).
+/// Neither side is sorted. This takes linear time on average.
+///
+/// For example given values = [5, null, 3, 8, 1] and n = 2, the output could
+/// be [4, 2, 0, 3, 1]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to partition
+/// \param[in] n position of the pivot, between 0 and values.length()
+/// \param[out] offsets partitioning indices
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status NthToIndices(FunctionContext* ctx, const Array& values, int64_t n,
+                    std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k first values of an array in sort order.
+///
+/// Equivalent to the first k indices of a stable sort, in O(n log k) time and
+/// O(k) memory. NaNs then nulls are placed at the end, in either order, so they
+/// are only returned if the array has fewer than k other values.
+///
+/// For example given values = [5, null, 3, 8, 1], k = 2 and a descending
+/// order, the output will be [3, 0]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to select from
+/// \param[in] k maximum number of indices to return
+/// \param[in] order ASCENDING for the k smallest values, DESCENDING for the k
+/// largest
+/// \param[out] offsets indices of the selected values, in sort order
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopK(FunctionContext* ctx, const Array& values, int64_t k, SortOrder order,
+            std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices of the k first values of a chunked array in sort
+/// order.
+///
+/// Chunks are consumed one at a time, see TopKSelector.
+ARROW_EXPORT
+Status TopK(FunctionContext* ctx, const ChunkedArray& values, int64_t k,
+            SortOrder order, std::shared_ptr<Array>* offsets);
+
+/// \brief Incremental selection of the k first rows of a stream of record
+/// batches
+///
+/// Only the k best rows seen so far are retained between calls to Consume(),
+/// so the selector can run over the output of a dataset Scanner without
+/// materializing a Table. Ties are broken by order of arrival.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT TopKSelector {
+ public:
+  ~TopKSelector();
+
+  /// \brief Create a selector
+  ///
+  /// \param[in] ctx the FunctionContext, must outlive the selector
+  /// \param[in] schema schema of the consumed record batches
+  /// \param[in] sort_key column to sort on, its order and null placement
+  /// \param[in] k maximum number of rows to retain
+  /// \param[out] out the resulting selector
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const SortKey& sort_key, int64_t k,
+                     std::unique_ptr<TopKSelector>* out);
+
+  /// \brief Select among the rows of another batch
+  Status Consume(const RecordBatch& batch);
+
+  /// \brief Return the selected rows, in sort order
+  Status Finish(std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Return the selected rows, in sort order, and their positions in
+  /// the stream of consumed rows (as uint64)
+  Status Finish(std::shared_ptr<RecordBatch>* out, std::shared_ptr<Array>* row_indices);
+
+  /// \brief Number of rows consumed so far
+  int64_t num_rows_seen() const;
+
+ private:
+  class Impl;
+  explicit TopKSelector(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
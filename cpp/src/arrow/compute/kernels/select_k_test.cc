@@ -0,0 +1,272 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/select_k.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestSelectK : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopK(const std::shared_ptr<Array>& values, int64_t k, SortOrder order,
+                  const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopK(&this->ctx_, *values, k, order, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+
+  // The first k indices of a full sort are the expected TopK result
+  void AssertTopKMatchesSort(const std::shared_ptr<Array>& values, int64_t k) {
+    std::shared_ptr<Array> sorted, actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, *values, &sorted));
+    ASSERT_OK(TopK(&this->ctx_, *values, k, SortOrder::ASCENDING, &actual));
+    AssertArraysEqual(*sorted->Slice(0, k), *actual);
+  }
+
+  void AssertNthToIndices(const std::shared_ptr<Array>& values, int64_t n) {
+    std::shared_ptr<Array> sorted, actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, *values, &sorted));
+    ASSERT_OK(NthToIndices(&this->ctx_, *values, n, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_EQ(actual->length(), values->length());
+    if (n == values->length()) {
+      return;
+    }
+
+    // Equal values may be permuted, so check the partitioning property
+    const auto& sorted_indices = checked_cast<const UInt64Array&>(*sorted);
+    const auto& indices = checked_cast<const UInt64Array&>(*actual);
+    const auto& typed_values = checked_cast<const Int32Array&>(*values);
+    const int64_t num_non_null = values->length() - values->null_count();
+    for (int64_t i = 0; i < values->length(); ++i) {
+      ASSERT_EQ(i >= num_non_null, typed_values.IsNull(indices.Value(i)));
+    }
+    if (n >= num_non_null) {
+      return;
+    }
+    const int32_t nth = typed_values.Value(sorted_indices.Value(n));
+    ASSERT_EQ(nth, typed_values.Value(indices.Value(n)));
+    for (int64_t i = 0; i < num_non_null; ++i) {
+      const int32_t value = typed_values.Value(indices.Value(i));
+      if (i < n) {
+        ASSERT_LE(value, nth);
+      } else {
+        ASSERT_GE(value, nth);
+      }
+    }
+  }
+};
+
+TEST_F(TestSelectK, TopK) {
+  auto values = ArrayFromJSON(int32(), "[5, null, 3, 8, 1, 3, null]");
+  AssertTopK(values, 0, SortOrder::ASCENDING, "[]");
+  AssertTopK(values, 2, SortOrder::ASCENDING, "[4, 2]");
+  AssertTopK(values, 3, SortOrder::ASCENDING, "[4, 2, 5]");
+  AssertTopK(values, 2, SortOrder::DESCENDING, "[3, 0]");
+  AssertTopK(values, 6, SortOrder::DESCENDING, "[3, 0, 2, 5, 4, 1]");
+  AssertTopK(values, 100, SortOrder::ASCENDING, "[4, 2, 5, 0, 3, 1, 6]");
+
+  AssertTopK(ArrayFromJSON(utf8(), R"(["b", "ab", null, "c", "a"])"), 3,
+             SortOrder::ASCENDING, "[4, 1, 0]");
+  AssertTopK(ArrayFromJSON(float64(), "[-1.5, 2.5, 0, -3]"), 2, SortOrder::DESCENDING,
+             "[1, 2]");
+  AssertTopK(ArrayFromJSON(int64(), "[]"), 2, SortOrder::ASCENDING, "[]");
+}
+
+TEST_F(TestSelectK, TopKRandom) {
+  random::RandomArrayGenerator rand(0x61a5e);
+  auto values = rand.Int32(10000, -100, 100, 0.1);
+  for (int64_t k : {0, 1, 10, 100, 9999, 10000}) {
+    AssertTopKMatchesSort(values, k);
+  }
+}
+
+TEST_F(TestSelectK, TopKChunked) {
+  auto values = ChunkedArrayFromJSON(int32(), {"[5, null, 3]", "[]", "[8, 1, 3, null]"});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(TopK(&this->ctx_, *values, 3, SortOrder::ASCENDING, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[4, 2, 5]"), *actual);
+  ASSERT_OK(TopK(&this->ctx_, *values, 6, SortOrder::DESCENDING, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 0, 2, 5, 4, 1]"), *actual);
+}
+
+TEST_F(TestSelectK, NthToIndices) {
+  AssertNthToIndices(ArrayFromJSON(int32(), "[]"), 0);
+  AssertNthToIndices(ArrayFromJSON(int32(), "[5, null, 3, 8, 1]"), 2);
+
+  random::RandomArrayGenerator rand(0x2f0a3);
+  auto values = rand.Int32(1000, -50, 50, 0.2);
+  for (int64_t n : {0, 1, 500, 799, 800, 999, 1000}) {
+    AssertNthToIndices(values, n);
+  }
+}
+
+TEST_F(TestSelectK, NaN) {
+  // NaNs come after the other values, in either order, and before nulls
+  auto values = ArrayFromJSON(float64(), "[NaN, 2, null, -1, NaN, 5, 2]");
+  AssertTopK(values, 3, SortOrder::ASCENDING, "[3, 1, 6]");
+  AssertTopK(values, 3, SortOrder::DESCENDING, "[5, 1, 6]");
+  AssertTopK(values, 7, SortOrder::ASCENDING, "[3, 1, 6, 5, 0, 4, 2]");
+  AssertTopK(values, 7, SortOrder::DESCENDING, "[5, 1, 6, 3, 0, 4, 2]");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(NthToIndices(&this->ctx_, *values, 4, &actual));
+  const auto& indices = checked_cast<const UInt64Array&>(*actual);
+  std::vector<uint64_t> before(indices.raw_values(), indices.raw_values() + 4);
+  std::sort(before.begin(), before.end());
+  ASSERT_EQ(before, std::vector<uint64_t>({1, 3, 5, 6}));
+  ASSERT_TRUE(std::isnan(checked_cast<const DoubleArray&>(*values).Value(
+      static_cast<int64_t>(indices.Value(4)))));
+  ASSERT_EQ(indices.Value(6), 2);
+
+  // Many NaNs, which used to break the heap invariants
+  DoubleBuilder builder;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_OK(builder.Append(i % 3 == 0 ? NAN : static_cast<double>((i * 37) % 101)));
+  }
+  std::shared_ptr<Array> many_nans;
+  ASSERT_OK(builder.Finish(&many_nans));
+  AssertTopK(many_nans, 1, SortOrder::DESCENDING, "[131]");
+  ASSERT_OK(TopK(&this->ctx_, *many_nans, 700, SortOrder::ASCENDING, &actual));
+  const auto& selected = checked_cast<const UInt64Array&>(*actual);
+  const auto& typed_values = checked_cast<const DoubleArray&>(*many_nans);
+  for (int64_t i = 0; i < selected.length(); ++i) {
+    const double value = typed_values.Value(static_cast<int64_t>(selected.Value(i)));
+    // 666 values are not NaN
+    ASSERT_EQ(i >= 666, std::isnan(value));
+    if (i > 0 && i < 666) {
+      ASSERT_LE(typed_values.Value(static_cast<int64_t>(selected.Value(i - 1))), value);
+    }
+  }
+}
+
+TEST_F(TestSelectK, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, NthToIndices(&this->ctx_, *values, 3, &out));
+  ASSERT_RAISES(Invalid, NthToIndices(&this->ctx_, *values, -1, &out));
+  ASSERT_RAISES(Invalid, TopK(&this->ctx_, *values, -1, SortOrder::ASCENDING, &out));
+  ASSERT_RAISES(NotImplemented, TopK(&this->ctx_, *ArrayFromJSON(list(int32()), "[]"),
+                                     1, SortOrder::ASCENDING, &out));
+}
+
+TEST_F(TestSelectK, Selector) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  std::unique_ptr<TopKSelector> selector;
+  ASSERT_OK(TopKSelector::Make(&this->ctx_, schema,
+                               SortKey("a", SortOrder::DESCENDING), 3, &selector));
+
+  std::shared_ptr<RecordBatch> selected;
+  std::shared_ptr<Array> row_indices;
+  ASSERT_OK(selector->Finish(&selected, &row_indices));
+  ASSERT_EQ(selected->num_rows(), 0);
+  ASSERT_EQ(row_indices->length(), 0);
+
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(
+      schema, R"([{"a": 1, "b": "x"}, {"a": 4, "b": "y"}, {"a": null, "b": "z"}])")));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schema, "[]")));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(
+      schema, R"([{"a": 4, "b": "u"}, {"a": 7, "b": "v"}, {"a": 2, "b": "w"}])")));
+  ASSERT_EQ(selector->num_rows_seen(), 6);
+
+  ASSERT_OK(selector->Finish(&selected, &row_indices));
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(
+          schema, R"([{"a": 7, "b": "v"}, {"a": 4, "b": "y"}, {"a": 4, "b": "u"}])"),
+      *selected);
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[4, 1, 3]"), *row_indices);
+}
+
+TEST_F(TestSelectK, SelectorNullsFirst) {
+  auto schema = ::arrow::schema({field("a", int64())});
+  std::unique_ptr<TopKSelector> selector;
+  ASSERT_OK(TopKSelector::Make(
+      &this->ctx_, schema,
+      SortKey("a", SortOrder::ASCENDING, NullPlacement::AT_START), 2, &selector));
+  ASSERT_OK(selector->Consume(*RecordBatchFromJSON(schema, R"([{"a": 3}, {"a": 1}])")));
+  ASSERT_OK(
+      selector->Consume(*RecordBatchFromJSON(schema, R"([{"a": 2}, {"a": null}])")));
+
+  std::shared_ptr<RecordBatch> selected;
+  std::shared_ptr<Array> row_indices;
+  ASSERT_OK(selector->Finish(&selected, &row_indices));
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([{"a": null}, {"a": 1}])"),
+                     *selected);
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 1]"), *row_indices);
+}
+
+TEST_F(TestSelectK, SelectorMatchesSort) {
+  random::RandomArrayGenerator rand(0x7c0ffee);
+  auto schema = ::arrow::schema({field("a", float64())});
+  std::unique_ptr<TopKSelector> selector;
+  ASSERT_OK(TopKSelector::Make(&this->ctx_, schema, SortKey("a"), 50, &selector));
+
+  ArrayVector chunks;
+  for (int64_t length : {100, 0, 3, 1000, 20}) {
+    chunks.push_back(rand.Float64(length, -10, 10, 0.1));
+    ASSERT_OK(selector->Consume(*RecordBatch::Make(schema, length, {chunks.back()})));
+  }
+  std::shared_ptr<RecordBatch> selected;
+  std::shared_ptr<Array> row_indices;
+  ASSERT_OK(selector->Finish(&selected, &row_indices));
+
+  std::shared_ptr<Array> sorted;
+  ASSERT_OK(SortToIndices(&this->ctx_, ChunkedArray(chunks), &sorted));
+  AssertArraysEqual(*sorted->Slice(0, 50), *row_indices);
+}
+
+TEST_F(TestSelectK, SelectorErrors) {
+  auto schema = ::arrow::schema({field("a", int32())});
+  std::unique_ptr<TopKSelector> selector;
+  ASSERT_RAISES(Invalid,
+                TopKSelector::Make(&this->ctx_, schema, SortKey("b"), 1, &selector));
+  ASSERT_RAISES(Invalid,
+                TopKSelector::Make(&this->ctx_, schema, SortKey("a"), -1, &selector));
+  ASSERT_RAISES(NotImplemented,
+                TopKSelector::Make(&this->ctx_, ::arrow::schema({field("a", null())}),
+                                   SortKey("a"), 1, &selector));
+
+  ASSERT_OK(TopKSelector::Make(&this->ctx_, schema, SortKey("a"), 1, &selector));
+  ASSERT_RAISES(Invalid, selector->Consume(*RecordBatchFromJSON(
+                             ::arrow::schema({field("a", int64())}), "[]")));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/selection_vector.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+namespace {
+
+// IndexSequence which yields the positions of a SelectionVector, which are
+// known to be valid and in bounds
+class SelectionIndexSequence {
+ public:
+  constexpr bool never_out_of_bounds() const { return true; }
+  void set_never_out_of_bounds() {}
+
+  constexpr SelectionIndexSequence() = default;
+
+  explicit SelectionIndexSequence(const Int32Array& indices)
+      : indices_(indices.raw_values()), length_(indices.length()) {}
+
+  std::pair<int64_t, bool> Next() { return std::make_pair(indices_[index_++], true); }
+
+  int64_t length() const { return length_; }
+
+  int64_t null_count() const { return 0; }
+
+ private:
+  const int32_t* indices_ = nullptr;
+  int64_t index_ = 0, length_ = 0;
+};
+
+Status CheckInputLength(int64_t length) {
+  if (length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Selection vectors support up to 2^31 - 1 rows, got ",
+                                 length);
+  }
+  return Status::OK();
+}
+
+Result<const BooleanArray*> GetFilter(const Array& filter, int64_t input_length) {
+  if (filter.type_id() != Type::BOOL) {
+    return Status::TypeError("filter array must be of boolean type, got ",
+                             *filter.type());
+  }
+  if (filter.length() != input_length) {
+    return Status::Invalid("filter has ", filter.length(), " values, expected ",
+                           input_length);
+  }
+  return checked_cast<const BooleanArray*>(&filter);
+}
+
+// A bitmap starting at bit 0 of the positions at which a filter is true and
+// valid
+Result<std::shared_ptr<Buffer>> SelectedBits(FunctionContext* ctx,
+                                             const BooleanArray& filter) {
+  const ArrayData& data = *filter.data();
+  if (filter.null_count() > 0) {
+    return internal::BitmapAnd(ctx->memory_pool(), data.buffers[1]->data(), data.offset,
+                               data.buffers[0]->data(), data.offset, data.length, 0);
+  }
+  if (data.offset % 8 != 0) {
+    return internal::CopyBitmap(ctx->memory_pool(), data.buffers[1]->data(),
+                                data.offset, data.length);
+  }
+  return SliceBuffer(data.buffers[1], data.offset / 8,
+                     BitUtil::BytesForBits(data.length));
+}
+
+// Write the positions of the set bits of a bitmap, 64 bits at a time
+void WriteSetBitPositions(const uint8_t* bitmap, int64_t length, int32_t* out) {
+  int64_t i = 0;
+  for (; i + 64 <= length; i += 64) {
+    uint64_t word;
+    std::memcpy(&word, bitmap + i / 8, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    while (word != 0) {
+      *out++ = static_cast<int32_t>(i + BitUtil::CountTrailingZeros(word));
+      word &= word - 1;
+    }
+  }
+  for (; i < length; ++i) {
+    if (BitUtil::GetBit(bitmap, i)) {
+      *out++ = static_cast<int32_t>(i);
+    }
+  }
+}
+
+}  // namespace
+
+SelectionVector::SelectionVector(std::shared_ptr<Int32Array> indices,
+                                 int64_t input_length)
+    : indices_(std::move(indices)), input_length_(input_length) {}
+
+int64_t SelectionVector::length() const { return indices_->length(); }
+
+Status SelectionVector::FromFilter(FunctionContext* ctx, const Array& filter,
+                                   std::shared_ptr<SelectionVector>* out) {
+  RETURN_NOT_OK(CheckInputLength(filter.length()));
+  ARROW_ASSIGN_OR_RAISE(auto boolean_filter, GetFilter(filter, filter.length()));
+  const int64_t input_length = filter.length();
+
+  int64_t length = 0;
+  std::shared_ptr<Buffer> bits;
+  if (input_length > 0) {
+    ARROW_ASSIGN_OR_RAISE(bits, SelectedBits(ctx, *boolean_filter));
+    length = internal::CountSetBits(bits->data(), 0, input_length);
+  }
+  std::shared_ptr<Buffer> positions;
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(int32_t), &positions));
+  if (length > 0) {
+    WriteSetBitPositions(bits->data(), input_length,
+                         reinterpret_cast<int32_t*>(positions->mutable_data()));
+  }
+
+  auto indices = std::make_shared<Int32Array>(length, std::move(positions));
+  out->reset(new SelectionVector(std::move(indices), input_length));
+  return Status::OK();
+}
+
+Status SelectionVector::All(FunctionContext* ctx, int64_t input_length,
+                            std::shared_ptr<SelectionVector>* out) {
+  RETURN_NOT_OK(CheckInputLength(input_length));
+  std::shared_ptr<Buffer> positions;
+  RETURN_NOT_OK(ctx->Allocate(input_length * sizeof(int32_t), &positions));
+  auto raw_positions = reinterpret_cast<int32_t*>(positions->mutable_data());
+  for (int32_t i = 0; i < input_length; ++i) {
+    raw_positions[i] = i;
+  }
+
+  auto indices = std::make_shared<Int32Array>(input_length, std::move(positions));
+  out->reset(new SelectionVector(std::move(indices), input_length));
+  return Status::OK();
+}
+
+Status SelectionVector::Make(std::shared_ptr<Array> indices, int64_t input_length,
+                             std::shared_ptr<SelectionVector>* out) {
+  RETURN_NOT_OK(CheckInputLength(input_length));
+  if (indices->type_id() != Type::INT32) {
+    return Status::TypeError("selection indices must be of int32 type, got ",
+                             *indices->type());
+  }
+  if (indices->null_count() != 0) {
+    return Status::Invalid("selection indices must not be null");
+  }
+  auto int32_indices = std::static_pointer_cast<Int32Array>(std::move(indices));
+  const int32_t* raw_indices = int32_indices->raw_values();
+  int64_t previous = -1;
+  for (int64_t i = 0; i < int32_indices->length(); ++i) {
+    if (raw_indices[i] <= previous || raw_indices[i] >= input_length) {
+      return Status::Invalid("selection indices must be ascending and less than ",
+                             input_length);
+    }
+    previous = raw_indices[i];
+  }
+  out->reset(new SelectionVector(std::move(int32_indices), input_length));
+  return Status::OK();
+}
+
+Status SelectionVector::Intersect(FunctionContext* ctx, const Array& filter,
+                                  std::shared_ptr<SelectionVector>* out) const {
+  ARROW_ASSIGN_OR_RAISE(auto boolean_filter, GetFilter(filter, input_length_));
+
+  const int64_t num_selected = length();
+  std::shared_ptr<Buffer> positions;
+  RETURN_NOT_OK(ctx->Allocate(num_selected * sizeof(int32_t), &positions));
+  auto out_positions = reinterpret_cast<int32_t*>(positions->mutable_data());
+
+  int64_t length = 0;
+  if (num_selected > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto bits, SelectedBits(ctx, *boolean_filter));
+    const uint8_t* bitmap = bits->data();
+    const int32_t* in_positions = indices_->raw_values();
+    for (int64_t i = 0; i < num_selected; ++i) {
+      // Branch-free compaction: always write, advance only when selected
+      out_positions[length] = in_positions[i];
+      length += BitUtil::GetBit(bitmap, in_positions[i]);
+    }
+  }
+
+  auto indices = std::make_shared<Int32Array>(
+      length, SliceBuffer(positions, 0, length * sizeof(int32_t)));
+  out->reset(new SelectionVector(std::move(indices), input_length_));
+  return Status::OK();
+}
+
+Status Take(FunctionContext* ctx, const Array& values, const SelectionVector& selection,
+            std::shared_ptr<Array>* out) {
+  if (values.length() != selection.input_length()) {
+    return Status::Invalid("selection refers to ", selection.input_length(),
+                           " values, got an array of length ", values.length());
+  }
+  std::unique_ptr<Taker<SelectionIndexSequence>> taker;
+  RETURN_NOT_OK(Taker<SelectionIndexSequence>::Make(values.type(), &taker));
+  RETURN_NOT_OK(taker->SetContext(ctx));
+  RETURN_NOT_OK(taker->Take(values, SelectionIndexSequence(*selection.indices())));
+  return taker->Finish(out);
+}
+
+Status Take(FunctionContext* ctx, const RecordBatch& batch,
+            const SelectionVector& selection, std::shared_ptr<RecordBatch>* out) {
+  if (batch.num_rows() != selection.input_length()) {
+    return Status::Invalid("selection refers to ", selection.input_length(),
+                           " rows, got a batch of ", batch.num_rows(), " rows");
+  }
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(Take(ctx, *batch.column(i), selection, &columns[i]));
+  }
+  *out = RecordBatch::Make(batch.schema(), selection.length(), std::move(columns));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class SelectionVector
+/// \brief Ascending positions of the rows selected from an array or batch
+///
+/// A selection vector records the outcome of one or more filters without
+/// copying any values. Successive predicates narrow it with Intersect(), and
+/// a single Take() at the end materializes the selected rows of each column.
+///
+/// Unlike Filter(), positions at which a filter is null are not selected,
+/// as in a SQL WHERE clause. Positions are stored as int32, so the input can
+/// have at most 2^31 - 1 rows.
+///
+/// Take() is the only kernel that consumes a selection vector; predicates
+/// such as Compare() still evaluate every row of their input.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT SelectionVector {
+ public:
+  /// \brief Select the positions at which a boolean filter is true
+  static Status FromFilter(FunctionContext* ctx, const Array& filter,
+                           std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Select every position of an input of the given length
+  static Status All(FunctionContext* ctx, int64_t input_length,
+                    std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Wrap existing positions
+  ///
+  /// indices must be a non-null Int32Array of ascending positions smaller
+  /// than input_length.
+  static Status Make(std::shared_ptr<Array> indices, int64_t input_length,
+                     std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Keep the selected positions at which a boolean filter is true
+  ///
+  /// The filter is indexed by input position and must have input_length()
+  /// slots. It is evaluated in full, but only its slots at selected
+  /// positions affect the result.
+  Status Intersect(FunctionContext* ctx, const Array& filter,
+                   std::shared_ptr<SelectionVector>* out) const;
+
+  /// The selected positions, as a non-null Int32Array
+  const std::shared_ptr<Int32Array>& indices() const { return indices_; }
+
+  /// Number of selected positions
+  int64_t length() const;
+
+  /// Number of rows of the input the positions refer to
+  int64_t input_length() const { return input_length_; }
+
+ private:
+  SelectionVector(std::shared_ptr<Int32Array> indices, int64_t input_length);
+
+  std::shared_ptr<Int32Array> indices_;
+  int64_t input_length_;
+};
+
+/// \brief Take the selected values of an array
+///
+/// Equivalent to Take() with selection.indices(), but skips bounds and null
+/// checks on the indices.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array with selection.input_length() values
+/// \param[in] selection positions to take
+/// \param[out] out resulting array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Take(FunctionContext* ctx, const Array& values, const SelectionVector& selection,
+            std::shared_ptr<Array>* out);
+
+/// \brief Take the selected rows of a record batch
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Take(FunctionContext* ctx, const RecordBatch& batch,
+            const SelectionVector& selection, std::shared_ptr<RecordBatch>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,207 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/selection_vector.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestSelectionVector : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<SelectionVector> FromFilter(const std::string& filter) {
+    std::shared_ptr<SelectionVector> selection;
+    ABORT_NOT_OK(SelectionVector::FromFilter(&ctx_, *ArrayFromJSON(boolean(), filter),
+                                             &selection));
+    return selection;
+  }
+
+  void AssertSelection(const SelectionVector& selection, int64_t input_length,
+                       const std::string& expected) {
+    ASSERT_EQ(input_length, selection.input_length());
+    ASSERT_OK(selection.indices()->ValidateFull());
+    ASSERT_EQ(0, selection.indices()->null_count());
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected), *selection.indices(),
+                      /*verbose=*/true);
+  }
+};
+
+TEST_F(TestSelectionVector, FromFilter) {
+  AssertSelection(*FromFilter("[]"), 0, "[]");
+  AssertSelection(*FromFilter("[false, false]"), 2, "[]");
+  AssertSelection(*FromFilter("[true, false, true, true]"), 4, "[0, 2, 3]");
+  // Nulls are not selected
+  AssertSelection(*FromFilter("[null, true, null, false, true]"), 5, "[1, 4]");
+}
+
+TEST_F(TestSelectionVector, FromSlicedFilter) {
+  auto filter = ArrayFromJSON(boolean(), "[true, true, false, null, true, true, false]");
+  for (int64_t offset = 0; offset < filter->length(); ++offset) {
+    auto sliced = filter->Slice(offset);
+    std::shared_ptr<SelectionVector> selection;
+    ASSERT_OK(SelectionVector::FromFilter(&ctx_, *sliced, &selection));
+    std::vector<int32_t> expected;
+    const auto& boolean_filter = internal::checked_cast<const BooleanArray&>(*sliced);
+    for (int64_t i = 0; i < sliced->length(); ++i) {
+      if (boolean_filter.IsValid(i) && boolean_filter.Value(i)) {
+        expected.push_back(static_cast<int32_t>(i));
+      }
+    }
+    std::shared_ptr<Array> expected_indices;
+    ArrayFromVector<Int32Type>(expected, &expected_indices);
+    AssertArraysEqual(*expected_indices, *selection->indices());
+  }
+}
+
+TEST_F(TestSelectionVector, All) {
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::All(&ctx_, 4, &selection));
+  AssertSelection(*selection, 4, "[0, 1, 2, 3]");
+  ASSERT_OK(SelectionVector::All(&ctx_, 0, &selection));
+  AssertSelection(*selection, 0, "[]");
+}
+
+TEST_F(TestSelectionVector, Make) {
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::Make(ArrayFromJSON(int32(), "[1, 3]"), 4, &selection));
+  AssertSelection(*selection, 4, "[1, 3]");
+
+  ASSERT_RAISES(TypeError,
+                SelectionVector::Make(ArrayFromJSON(int64(), "[1]"), 4, &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(ArrayFromJSON(int32(), "[null]"), 4, &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(ArrayFromJSON(int32(), "[3, 1]"), 4, &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(ArrayFromJSON(int32(), "[1, 1]"), 4, &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(ArrayFromJSON(int32(), "[4]"), 4, &selection));
+  ASSERT_RAISES(Invalid,
+                SelectionVector::Make(ArrayFromJSON(int32(), "[-1]"), 4, &selection));
+}
+
+TEST_F(TestSelectionVector, Intersect) {
+  auto selection = FromFilter("[true, false, true, true, null, true]");
+  std::shared_ptr<SelectionVector> narrowed;
+  // Slots at unselected positions are ignored
+  ASSERT_OK(selection->Intersect(
+      &ctx_, *ArrayFromJSON(boolean(), "[true, true, false, true, true, null]"),
+      &narrowed));
+  AssertSelection(*narrowed, 6, "[0, 3]");
+
+  std::shared_ptr<SelectionVector> empty;
+  ASSERT_OK(narrowed->Intersect(
+      &ctx_, *ArrayFromJSON(boolean(), "[false, true, true, false, true, true]"),
+      &empty));
+  AssertSelection(*empty, 6, "[]");
+
+  // The input selection is left unchanged
+  AssertSelection(*selection, 6, "[0, 2, 3, 5]");
+}
+
+TEST_F(TestSelectionVector, Errors) {
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_RAISES(TypeError, SelectionVector::FromFilter(
+                               &ctx_, *ArrayFromJSON(int8(), "[1]"), &selection));
+
+  selection = FromFilter("[true, false]");
+  std::shared_ptr<SelectionVector> narrowed;
+  ASSERT_RAISES(Invalid, selection->Intersect(
+                             &ctx_, *ArrayFromJSON(boolean(), "[true]"), &narrowed));
+
+  std::shared_ptr<Array> taken;
+  ASSERT_RAISES(Invalid,
+                Take(&ctx_, *ArrayFromJSON(int32(), "[1, 2, 3]"), *selection, &taken));
+}
+
+TEST_F(TestSelectionVector, TakeArray) {
+  auto selection = FromFilter("[true, false, null, true, true]");
+  std::shared_ptr<Array> taken;
+  ASSERT_OK(Take(&ctx_, *ArrayFromJSON(utf8(), R"(["a", "b", "c", null, "e"])"),
+                 *selection, &taken));
+  ASSERT_OK(taken->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", null, "e"])"), *taken);
+
+  auto list_values = ArrayFromJSON(list(int32()), "[[1], [], null, [2, 3], [4]]");
+  ASSERT_OK(Take(&ctx_, *list_values, *selection, &taken));
+  ASSERT_OK(taken->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(list(int32()), "[[1], [2, 3], [4]]"), *taken);
+}
+
+TEST_F(TestSelectionVector, TakeRecordBatch) {
+  auto schm = schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schm, R"([
+    {"a": null, "b": "yo"},
+    {"a": 1, "b": ""},
+    {"a": 2, "b": "hello"},
+    {"a": 4, "b": "eh"}
+  ])");
+  auto selection = FromFilter("[true, true, false, true]");
+  std::shared_ptr<SelectionVector> narrowed;
+  ASSERT_OK(selection->Intersect(
+      &ctx_, *ArrayFromJSON(boolean(), "[false, true, true, true]"), &narrowed));
+
+  std::shared_ptr<RecordBatch> taken;
+  ASSERT_OK(Take(&ctx_, *batch, *narrowed, &taken));
+  ASSERT_OK(taken->ValidateFull());
+  ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(schm, R"([
+    {"a": 1, "b": ""},
+    {"a": 4, "b": "eh"}
+  ])"),
+                       *taken);
+}
+
+TEST_F(TestSelectionVector, ChainedFiltersMatchFilter) {
+  // Intersecting the selection with each predicate is equivalent to
+  // applying Filter() once per predicate
+  random::RandomArrayGenerator rand(0x5e1ec7);
+  const int64_t length = 1000;
+  auto values = rand.Int64(length, -100, 100, 0.1);
+  auto first = rand.Boolean(length, 0.6, 0.0);
+  auto second = rand.Boolean(length, 0.4, 0.0);
+
+  std::shared_ptr<SelectionVector> selection, narrowed;
+  ASSERT_OK(SelectionVector::FromFilter(&ctx_, *first, &selection));
+  ASSERT_OK(selection->Intersect(&ctx_, *second, &narrowed));
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(Take(&ctx_, *values, *narrowed, &actual));
+
+  std::shared_ptr<Array> filtered_values, filtered_second, expected;
+  ASSERT_OK(Filter(&ctx_, *values, *first, &filtered_values));
+  ASSERT_OK(Filter(&ctx_, *second, *first, &filtered_second));
+  ASSERT_OK(Filter(&ctx_, *filtered_values, *filtered_second, &expected));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*expected, *actual);
+}
+
+}  // namespace compute
+}  // namespace arrow
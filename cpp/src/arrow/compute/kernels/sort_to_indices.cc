@@ -18,19 +18,31 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
 class Array;
 
+using internal::checked_cast;
+
 namespace compute {
 
 /// \brief UnaryKernel implementing SortToIndices operation
@@ -70,6 +82,79 @@ bool CompareViews(const ArrayType& array, uint64_t lhs, uint64_t rhs) {
   return array.GetView(lhs) < array.GetView(rhs);
 }
 
+// Sorts of fewer indices than this are not split across threads
+static constexpr int64_t kMinParallelSortLength = 1 << 16;
+
+/// \brief Sort [indices_begin, indices_end) with a stable sort_range function,
+/// in parallel on the CPU thread pool when the FunctionContext allows it
+///
+/// The indices are split into one run per thread, each run is sorted by
+/// sort_range, then runs are merged pairwise with `less` until one remains.
+/// Runs are contiguous and std::merge favours its first input, so stability
+/// is preserved.
+template <typename SortRange, typename Less>
+Status ParallelSort(FunctionContext* ctx, int64_t* indices_begin, int64_t* indices_end,
+                    SortRange&& sort_range, Less&& less) {
+  const int64_t length = indices_end - indices_begin;
+  int64_t num_runs = 1;
+  if (ctx->use_threads() && length >= kMinParallelSortLength) {
+    num_runs = std::min<int64_t>(internal::GetCpuThreadPool()->GetCapacity(),
+                                 length / (kMinParallelSortLength / 2));
+  }
+  if (num_runs <= 1) {
+    return sort_range(indices_begin, indices_end);
+  }
+
+  std::vector<int64_t> bounds(num_runs + 1);
+  for (int64_t i = 0; i <= num_runs; ++i) {
+    bounds[i] = length * i / num_runs;
+  }
+  RETURN_NOT_OK(internal::ParallelFor(static_cast<int>(num_runs), [&](int i) {
+    return sort_range(indices_begin + bounds[i], indices_begin + bounds[i + 1]);
+  }));
+
+  std::shared_ptr<Buffer> scratch;
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(int64_t), &scratch));
+  int64_t* src = indices_begin;
+  int64_t* dest = reinterpret_cast<int64_t*>(scratch->mutable_data());
+
+  while (bounds.size() > 2) {
+    // Merge runs 2i and 2i + 1; an odd trailing run is merged with nothing
+    const int num_merges = static_cast<int>(bounds.size() / 2);
+    RETURN_NOT_OK(internal::ParallelFor(num_merges, [&](int i) {
+      const int64_t begin = bounds[2 * i];
+      const int64_t middle = bounds[2 * i + 1];
+      const int64_t end = bounds[std::min<size_t>(2 * i + 2, bounds.size() - 1)];
+      std::merge(src + begin, src + middle, src + middle, src + end, dest + begin, less);
+      return Status::OK();
+    }));
+    std::vector<int64_t> merged_bounds;
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != length) {
+      merged_bounds.push_back(length);
+    }
+    bounds = std::move(merged_bounds);
+    std::swap(src, dest);
+  }
+  if (src != indices_begin) {
+    std::copy(src, src + length, indices_begin);
+  }
+  return Status::OK();
+}
+
+/// \brief Move the indices of null values to the end, return the first of them
+template <typename ArrayType>
+int64_t* PartitionNulls(int64_t* indices_begin, int64_t* indices_end,
+                        const ArrayType& values) {
+  if (values.null_count() == 0) {
+    return indices_end;
+  }
+  return std::stable_partition(indices_begin, indices_end,
+                               [&values](uint64_t ind) { return !values.IsNull(ind); });
+}
+
 template <typename ArrowType, typename Comparator>
 class CompareSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -77,23 +162,152 @@ class CompareSorter {
  public:
   explicit CompareSorter(Comparator compare) : compare_(compare) {}
 
-  void Sort(int64_t* indices_begin, int64_t* indices_end, const ArrayType& values) {
+  Status Sort(FunctionContext* ctx, int64_t* indices_begin, int64_t* indices_end,
+              const ArrayType& values) {
     std::iota(indices_begin, indices_end, 0);
+    auto nulls_begin = PartitionNulls(indices_begin, indices_end, values);
+
+    auto less = [&values, this](uint64_t left, uint64_t right) {
+      return compare_(values, left, right);
+    };
+    return ParallelSort(ctx, indices_begin, nulls_begin,
+                        [&less](int64_t* begin, int64_t* end) {
+                          std::stable_sort(begin, end, less);
+                          return Status::OK();
+                        },
+                        less);
+  }
+
+ private:
+  Comparator compare_;
+};
+
+/// \brief Map a value to an unsigned integer with the same ordering
+template <typename CType, typename Enable = void>
+struct RadixKey {
+  // Unsigned integers are their own key
+  using Type = CType;
+  static Type Get(CType value) { return value; }
+};
 
-    auto nulls_begin = indices_end;
-    if (values.null_count()) {
-      nulls_begin =
-          std::stable_partition(indices_begin, indices_end,
-                                [&values](uint64_t ind) { return !values.IsNull(ind); });
+template <typename CType>
+struct RadixKey<CType, typename std::enable_if<std::is_integral<CType>::value &&
+                                               std::is_signed<CType>::value>::type> {
+  // Flip the sign bit so that negative values come first
+  using Type = typename std::make_unsigned<CType>::type;
+  static Type Get(CType value) {
+    return static_cast<Type>(value) ^ (Type(1) << (sizeof(Type) * 8 - 1));
+  }
+};
+
+template <typename CType>
+struct RadixKey<CType,
+                typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  // Flip all bits of negative values, and only the sign bit of positive ones.
+  // NaNs, whatever their sign, come after all other values.
+  using Type = typename std::conditional<sizeof(CType) == 4, uint32_t, uint64_t>::type;
+  static Type Get(CType value) {
+    if (std::isnan(value)) {
+      return std::numeric_limits<Type>::max();
     }
-    std::stable_sort(indices_begin, nulls_begin,
-                     [&values, this](uint64_t left, uint64_t right) {
-                       return compare_(values, left, right);
-                     });
+    Type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    constexpr Type kSignBit = Type(1) << (sizeof(Type) * 8 - 1);
+    return (bits & kSignBit) ? ~bits : (bits | kSignBit);
+  }
+};
+
+/// \brief Least significant digit radix sort on 8-bit digits
+///
+/// Keys are extracted once; each pass scatters keys and indices by one digit.
+/// Passes where every key shares the same digit are skipped, which makes
+/// small value ranges cheap. The sort is stable.
+template <typename ArrowType>
+class RadixSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using KeyType = typename RadixKey<CType>::Type;
+
+  static constexpr int kDigitBits = 8;
+  static constexpr int kNumBuckets = 1 << kDigitBits;
+  static constexpr int kNumPasses = sizeof(KeyType) * 8 / kDigitBits;
+  // Below this, the fixed cost of the histograms outweighs the gains
+  static constexpr int64_t kMinRadixSortLength = 1024;
+
+ public:
+  Status Sort(FunctionContext* ctx, int64_t* indices_begin, int64_t* indices_end,
+              const ArrayType& values) {
+    std::iota(indices_begin, indices_end, 0);
+    auto nulls_begin = PartitionNulls(indices_begin, indices_end, values);
+
+    // Compare keys rather than values, to order NaNs the same way as the radix
+    // passes do
+    auto less = [&values](uint64_t left, uint64_t right) {
+      return RadixKey<CType>::Get(values.Value(left)) <
+             RadixKey<CType>::Get(values.Value(right));
+    };
+    return ParallelSort(ctx, indices_begin, nulls_begin,
+                        [&](int64_t* begin, int64_t* end) {
+                          return RadixSort(ctx, begin, end, values, less);
+                        },
+                        less);
   }
 
  private:
-  Comparator compare_;
+  template <typename Less>
+  Status RadixSort(FunctionContext* ctx, int64_t* indices_begin, int64_t* indices_end,
+                   const ArrayType& values, Less&& less) {
+    const int64_t length = indices_end - indices_begin;
+    if (length < kMinRadixSortLength) {
+      std::stable_sort(indices_begin, indices_end, less);
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> keys_buf, indices_buf;
+    RETURN_NOT_OK(ctx->Allocate(2 * length * sizeof(KeyType), &keys_buf));
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(int64_t), &indices_buf));
+    KeyType* keys = reinterpret_cast<KeyType*>(keys_buf->mutable_data());
+    KeyType* keys_dest = keys + length;
+    int64_t* indices = indices_begin;
+    int64_t* indices_dest = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+
+    // Extract keys and compute the histograms of all digits in a single pass
+    std::vector<int64_t> counts(kNumPasses * kNumBuckets, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      const KeyType key = RadixKey<CType>::Get(values.Value(indices[i]));
+      keys[i] = key;
+      for (int pass = 0; pass < kNumPasses; ++pass) {
+        ++counts[pass * kNumBuckets + ((key >> (pass * kDigitBits)) & (kNumBuckets - 1))];
+      }
+    }
+
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+      int64_t* offsets = counts.data() + pass * kNumBuckets;
+      const KeyType first_digit = (keys[0] >> (pass * kDigitBits)) & (kNumBuckets - 1);
+      if (offsets[first_digit] == length) {
+        continue;
+      }
+      int64_t offset = 0;
+      for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+        const int64_t count = offsets[bucket];
+        offsets[bucket] = offset;
+        offset += count;
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        const KeyType key = keys[i];
+        const int64_t pos = offsets[(key >> (pass * kDigitBits)) & (kNumBuckets - 1)]++;
+        keys_dest[pos] = key;
+        indices_dest[pos] = indices[i];
+      }
+      std::swap(keys, keys_dest);
+      std::swap(indices, indices_dest);
+    }
+
+    if (indices != indices_begin) {
+      std::copy(indices, indices + length, indices_begin);
+    }
+    return Status::OK();
+  }
 };
 
 template <typename ArrowType>
@@ -103,13 +317,15 @@ class CountSorter {
  public:
   explicit CountSorter(int min, int max) : min_(min), max_(max) {}
 
-  void Sort(int64_t* indices_begin, int64_t* indices_end, const ArrayType& values) {
+  Status Sort(FunctionContext* ctx, int64_t* indices_begin, int64_t* indices_end,
+              const ArrayType& values) {
     // 32bit counter performs much better than 64bit one
     if (values.length() < (1LL << 32)) {
       SortInternal<uint32_t>(indices_begin, indices_end, values);
     } else {
       SortInternal<uint64_t>(indices_begin, indices_end, values);
     }
+    return Status::OK();
   }
 
  private:
@@ -176,7 +392,7 @@ class SortToIndicesKernelImpl : public SortToIndicesKernel {
     int64_t* indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
     int64_t* indices_end = indices_begin + values->length();
 
-    sorter_.Sort(indices_begin, indices_end, *values.get());
+    RETURN_NOT_OK(sorter_.Sort(ctx, indices_begin, indices_end, *values.get()));
     *offsets = std::make_shared<UInt64Array>(values->length(), indices_buf);
     return Status::OK();
   }
@@ -194,6 +410,11 @@ SortToIndicesKernelImpl<ArrowType, Sorter>* MakeSortToIndicesCounting(int min, i
   return new SortToIndicesKernelImpl<ArrowType, Sorter>(Sorter(min, max));
 }
 
+template <typename ArrowType, typename Sorter = RadixSorter<ArrowType>>
+SortToIndicesKernelImpl<ArrowType, Sorter>* MakeSortToIndicesRadix() {
+  return new SortToIndicesKernelImpl<ArrowType, Sorter>(Sorter());
+}
+
 Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
                                  std::unique_ptr<SortToIndicesKernel>* out) {
   SortToIndicesKernel* kernel;
@@ -211,22 +432,40 @@ Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
       kernel = MakeSortToIndicesWithComparator<Int16Type>(CompareValues<Int16Array>);
       break;
     case Type::UINT32:
-      kernel = MakeSortToIndicesWithComparator<UInt32Type>(CompareValues<UInt32Array>);
+      kernel = MakeSortToIndicesRadix<UInt32Type>();
       break;
     case Type::INT32:
-      kernel = MakeSortToIndicesWithComparator<Int32Type>(CompareValues<Int32Array>);
+      kernel = MakeSortToIndicesRadix<Int32Type>();
       break;
     case Type::UINT64:
-      kernel = MakeSortToIndicesWithComparator<UInt64Type>(CompareValues<UInt64Array>);
+      kernel = MakeSortToIndicesRadix<UInt64Type>();
       break;
     case Type::INT64:
-      kernel = MakeSortToIndicesWithComparator<Int64Type>(CompareValues<Int64Array>);
+      kernel = MakeSortToIndicesRadix<Int64Type>();
       break;
     case Type::FLOAT:
-      kernel = MakeSortToIndicesWithComparator<FloatType>(CompareValues<FloatArray>);
+      kernel = MakeSortToIndicesRadix<FloatType>();
       break;
     case Type::DOUBLE:
-      kernel = MakeSortToIndicesWithComparator<DoubleType>(CompareValues<DoubleArray>);
+      kernel = MakeSortToIndicesRadix<DoubleType>();
+      break;
+    case Type::DATE32:
+      kernel = MakeSortToIndicesRadix<Date32Type>();
+      break;
+    case Type::DATE64:
+      kernel = MakeSortToIndicesRadix<Date64Type>();
+      break;
+    case Type::TIMESTAMP:
+      kernel = MakeSortToIndicesRadix<TimestampType>();
+      break;
+    case Type::TIME32:
+      kernel = MakeSortToIndicesRadix<Time32Type>();
+      break;
+    case Type::TIME64:
+      kernel = MakeSortToIndicesRadix<Time64Type>();
+      break;
+    case Type::DURATION:
+      kernel = MakeSortToIndicesRadix<DurationType>();
       break;
     case Type::BINARY:
       kernel = MakeSortToIndicesWithComparator<BinaryType>(CompareViews<BinaryArray>);
@@ -255,5 +494,236 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Lexicographic sorting of chunked columns
+
+namespace {
+
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+
+bool IsNaN(float value) { return std::isnan(value); }
+
+bool IsNaN(double value) { return std::isnan(value); }
+
+/// \brief Compare two rows of a chunked column, honoring the sort order and
+/// null placement of its sort key
+class ColumnComparator {
+ public:
+  ColumnComparator(SortOrder order, NullPlacement null_placement)
+      : order_(order), null_placement_(null_placement) {}
+
+  virtual ~ColumnComparator() = default;
+
+  /// Return a negative value if row `left` sorts before row `right`, a
+  /// positive value if it sorts after, and zero if they are equivalent.
+  virtual int Compare(int64_t left, int64_t right) const = 0;
+
+ protected:
+  SortOrder order_;
+  NullPlacement null_placement_;
+};
+
+template <typename ArrayType>
+class ConcreteColumnComparator : public ColumnComparator {
+ public:
+  ConcreteColumnComparator(const ChunkedArray& column, SortOrder order,
+                           NullPlacement null_placement)
+      : ColumnComparator(order, null_placement) {
+    int64_t offset = 0;
+    for (const auto& chunk : column.chunks()) {
+      if (chunk->length() == 0) continue;
+      chunks_.push_back(checked_cast<const ArrayType*>(chunk.get()));
+      chunk_offsets_.push_back(offset);
+      offset += chunk->length();
+    }
+    chunk_offsets_.push_back(offset);
+  }
+
+  int Compare(int64_t left, int64_t right) const override {
+    int64_t left_index, right_index;
+    const ArrayType* left_chunk = Resolve(left, &left_index);
+    const ArrayType* right_chunk = Resolve(right, &right_index);
+
+    const bool left_null = left_chunk->IsNull(left_index);
+    const bool right_null = right_chunk->IsNull(right_index);
+    if (left_null || right_null) {
+      if (left_null && right_null) return 0;
+      const int nulls_last = left_null ? 1 : -1;
+      return null_placement_ == NullPlacement::AT_END ? nulls_last : -nulls_last;
+    }
+
+    const auto left_value = left_chunk->GetView(left_index);
+    const auto right_value = right_chunk->GetView(right_index);
+    // NaNs come after all other values, whatever the order, so that the
+    // comparison is a strict weak ordering
+    const bool left_nan = IsNaN(left_value);
+    const bool right_nan = IsNaN(right_value);
+    if (left_nan || right_nan) {
+      return static_cast<int>(left_nan) - static_cast<int>(right_nan);
+    }
+    const int compared = (left_value < right_value) ? -1 : (right_value < left_value);
+    return order_ == SortOrder::ASCENDING ? compared : -compared;
+  }
+
+ private:
+  const ArrayType* Resolve(int64_t index, int64_t* index_in_chunk) const {
+    if (chunks_.size() == 1) {
+      *index_in_chunk = index;
+      return chunks_[0];
+    }
+    auto it = std::upper_bound(chunk_offsets_.begin(), chunk_offsets_.end(), index);
+    const auto chunk = static_cast<size_t>(it - chunk_offsets_.begin()) - 1;
+    *index_in_chunk = index - chunk_offsets_[chunk];
+    return chunks_[chunk];
+  }
+
+  // Chunks are kept alive by the caller's ChunkedArray
+  std::vector<const ArrayType*> chunks_;
+  // Logical offset of each chunk, followed by the total length
+  std::vector<int64_t> chunk_offsets_;
+};
+
+Status MakeColumnComparator(const ChunkedArray& column, SortOrder order,
+                            NullPlacement null_placement,
+                            std::unique_ptr<ColumnComparator>* out) {
+  switch (column.type()->id()) {
+#define COMPARATOR_CASE(TYPE_CLASS)                                                \
+  case TYPE_CLASS##Type::type_id:                                                  \
+    out->reset(new ConcreteColumnComparator<TYPE_CLASS##Array>(column, order,      \
+                                                                null_placement)); \
+    return Status::OK();
+
+    COMPARATOR_CASE(Boolean)
+    COMPARATOR_CASE(UInt8)
+    COMPARATOR_CASE(Int8)
+    COMPARATOR_CASE(UInt16)
+    COMPARATOR_CASE(Int16)
+    COMPARATOR_CASE(UInt32)
+    COMPARATOR_CASE(Int32)
+    COMPARATOR_CASE(UInt64)
+    COMPARATOR_CASE(Int64)
+    COMPARATOR_CASE(Float)
+    COMPARATOR_CASE(Double)
+    COMPARATOR_CASE(Date32)
+    COMPARATOR_CASE(Date64)
+    COMPARATOR_CASE(Time32)
+    COMPARATOR_CASE(Time64)
+    COMPARATOR_CASE(Timestamp)
+    COMPARATOR_CASE(Duration)
+    COMPARATOR_CASE(Binary)
+    COMPARATOR_CASE(String)
+    COMPARATOR_CASE(FixedSizeBinary)
+#undef COMPARATOR_CASE
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting of ", *column.type(), " arrays");
+}
+
+struct ColumnSortKey {
+  std::shared_ptr<ChunkedArray> column;
+  SortOrder order;
+  NullPlacement null_placement;
+};
+
+Status SortColumnsToIndices(FunctionContext* ctx, const std::vector<ColumnSortKey>& keys,
+                            int64_t length, bool stable,
+                            std::shared_ptr<Array>* offsets) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+
+  // A single contiguous column in the default order can use the dedicated
+  // (and always stable) array sorters.
+  const auto& first = keys[0];
+  if (keys.size() == 1 && first.column->num_chunks() == 1 &&
+      first.order == SortOrder::ASCENDING &&
+      first.null_placement == NullPlacement::AT_END) {
+    std::unique_ptr<SortToIndicesKernel> kernel;
+    if (SortToIndicesKernel::Make(first.column->type(), &kernel).ok()) {
+      return kernel->SortToIndices(ctx, first.column->chunk(0), offsets);
+    }
+  }
+
+  std::vector<std::unique_ptr<ColumnComparator>> comparators(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    RETURN_NOT_OK(MakeColumnComparator(*keys[i].column, keys[i].order,
+                                       keys[i].null_placement, &comparators[i]));
+  }
+
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t),
+                               &indices_buf));
+  auto indices_begin = reinterpret_cast<int64_t*>(indices_buf->mutable_data());
+  auto indices_end = indices_begin + length;
+  std::iota(indices_begin, indices_end, 0);
+
+  auto less = [&comparators](int64_t left, int64_t right) {
+    for (const auto& comparator : comparators) {
+      const int compared = comparator->Compare(left, right);
+      if (compared != 0) return compared < 0;
+    }
+    return false;
+  };
+  RETURN_NOT_OK(ParallelSort(ctx, indices_begin, indices_end,
+                             [&](int64_t* begin, int64_t* end) {
+                               if (stable) {
+                                 std::stable_sort(begin, end, less);
+                               } else {
+                                 std::sort(begin, end, less);
+                               }
+                               return Status::OK();
+                             },
+                             less));
+
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values, SortOrder order,
+                     NullPlacement null_placement, std::shared_ptr<Array>* offsets) {
+  auto column = std::make_shared<ChunkedArray>(values.chunks(), values.type());
+  return SortColumnsToIndices(ctx, {{column, order, null_placement}}, values.length(),
+                              /*stable=*/true, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     std::shared_ptr<Array>* offsets) {
+  return SortToIndices(ctx, values, SortOrder::ASCENDING, NullPlacement::AT_END,
+                       offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets) {
+  std::vector<ColumnSortKey> keys;
+  for (const auto& sort_key : options.sort_keys) {
+    auto column = batch.GetColumnByName(sort_key.name);
+    if (column == nullptr) {
+      return Status::Invalid("Sort key column not found: ", sort_key.name);
+    }
+    keys.push_back({std::make_shared<ChunkedArray>(column), sort_key.order,
+                    sort_key.null_placement});
+  }
+  return SortColumnsToIndices(ctx, keys, batch.num_rows(), options.stable, offsets);
+}
+
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  std::vector<ColumnSortKey> keys;
+  for (const auto& sort_key : options.sort_keys) {
+    auto column = table.GetColumnByName(sort_key.name);
+    if (column == nullptr) {
+      return Status::Invalid("Sort key column not found: ", sort_key.name);
+    }
+    keys.push_back({column, sort_key.order, sort_key.null_placement});
+  }
+  return SortColumnsToIndices(ctx, keys, table.num_rows(), options.stable, offsets);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,11 +29,53 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
+class RecordBatch;
+class Table;
 
 namespace compute {
 
 class FunctionContext;
 
+/// \brief Sort order of a sort key
+enum class SortOrder {
+  ASCENDING,
+  DESCENDING,
+};
+
+/// \brief Placement of nulls relative to the non-null values of a sort key
+enum class NullPlacement {
+  AT_END,
+  AT_START,
+};
+
+/// \class SortKey
+///
+/// One column of a lexicographic sort, designated by name.
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(std::string name, SortOrder order = SortOrder::ASCENDING,
+                   NullPlacement null_placement = NullPlacement::AT_END)
+      : name(std::move(name)), order(order), null_placement(null_placement) {}
+
+  std::string name;
+  SortOrder order;
+  NullPlacement null_placement;
+};
+
+/// \class SortOptions
+///
+/// Sort keys of a RecordBatch or Table sort, in decreasing order of
+/// precedence: later keys only break ties of earlier ones.
+struct ARROW_EXPORT SortOptions {
+  explicit SortOptions(std::vector<SortKey> sort_keys = {}, bool stable = true)
+      : sort_keys(std::move(sort_keys)), stable(stable) {}
+
+  std::vector<SortKey> sort_keys;
+
+  /// Keep rows that compare equal on all sort keys in input order.
+  bool stable;
+};
+
 /// \brief Returns the indices that would sort an array.
 ///
 /// Perform an indirect sort of array. The output array will contain
@@ -47,5 +92,53 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \brief Returns the indices that would sort a chunked array.
+///
+/// The chunks are sorted in place of their concatenation, without copying
+/// the values. The sort is stable.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array to sort
+/// \param[in] order ascending or descending order
+/// \param[in] null_placement whether nulls go before or after other values
+/// \param[out] offsets indices that would sort the chunked array
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values, SortOrder order,
+                     NullPlacement null_placement, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a chunked array in ascending
+/// order, nulls at the end.
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const ChunkedArray& values,
+                     std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a record batch lexicographically
+/// along several columns.
+///
+/// For example given columns a = [1, 1, 0] and b = ["x", "z", "y"], sorting
+/// with keys {SortKey("a"), SortKey("b", SortOrder::DESCENDING)} results in
+/// [2, 1, 0]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch record batch to sort
+/// \param[in] options sort keys and stability, see SortOptions
+/// \param[out] offsets indices that would sort the record batch
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort a table lexicographically along
+/// several columns.
+///
+/// Chunked columns are sorted without being concatenated first.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] options sort keys and stability, see SortOptions
+/// \param[out] offsets indices that would sort the table
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include <limits>
+
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include "arrow/compute/benchmark_util.h"
@@ -60,6 +62,40 @@ static void SortToIndicesInt8(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+// Sort `state.range(0)` values spread over the whole domain of the type, on one
+// thread or on the CPU thread pool depending on `state.range(1)`.
+template <typename ArrowType>
+static void SortToIndicesLarge(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  const int64_t array_size = state.range(0);
+  const bool use_threads = state.range(1) != 0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  // Halve the bounds to keep the width of floating point ranges finite
+  auto values = rand.Numeric<ArrowType>(array_size,
+                                        std::numeric_limits<CType>::lowest() / 2,
+                                        std::numeric_limits<CType>::max() / 2, 0.01);
+
+  FunctionContext ctx;
+  ctx.set_use_threads(use_threads);
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(SortToIndices(&ctx, *values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void LargeSortArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"size", "threads"});
+  for (int64_t size : {10000000, 100000000}) {
+    for (int64_t use_threads : {0, 1}) {
+      bench->Args({size, use_threads});
+    }
+  }
+}
+
 BENCHMARK(SortToIndicesInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -76,5 +112,21 @@ BENCHMARK(SortToIndicesInt8)
     ->Args({1 << 23, 99})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK_TEMPLATE(SortToIndicesLarge, Int32Type)
+    ->Apply(LargeSortArgs)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(SortToIndicesLarge, Int64Type)
+    ->Apply(LargeSortArgs)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(SortToIndicesLarge, DoubleType)
+    ->Apply(LargeSortArgs)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -15,14 +15,22 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -30,6 +38,9 @@
 #include "arrow/type_traits.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 template <typename ArrowType>
@@ -76,6 +87,8 @@ TYPED_TEST(TestSortToIndicesKernelForReal, SortReal) {
   this->AssertSortToIndices("[10.4, 12, 4.2, 50, 50.3, 32, 11]", "[2,0,6,1,5,3,4]");
 
   this->AssertSortToIndices("[null, 1, 3.3, null, 2, 5.3]", "[1,4,2,5,0,3]");
+
+  this->AssertSortToIndices("[NaN, 2, null, -1, NaN]", "[3,1,0,4,2]");
 }
 
 TYPED_TEST(TestSortToIndicesKernelForIntegral, SortIntegral) {
@@ -209,5 +222,255 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+template <typename ArrowType>
+class TestSortToIndicesKernelLarge : public ComputeFixture, public TestBase {};
+TYPED_TEST_CASE(TestSortToIndicesKernelLarge, NumericArrowTypes);
+
+TYPED_TEST(TestSortToIndicesKernelLarge, SortLargeValues) {
+  // Large enough for the radix and parallel sorts to kick in
+  using CType = typename TypeTraits<TypeParam>::CType;
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  random::RandomArrayGenerator rand(0x1f2e3d);
+  const int64_t length = (1 << 17) + 7;
+  const CType min = std::is_signed<CType>::value ? static_cast<CType>(-100) : 0;
+  // Keep the width of the floating point range finite
+  const CType scale = std::is_floating_point<CType>::value ? 4 : 1;
+  for (auto null_probability : {0.0, 0.2}) {
+    for (const auto& array :
+         {rand.Numeric<TypeParam>(length, min, static_cast<CType>(100), null_probability),
+          rand.Numeric<TypeParam>(length, std::numeric_limits<CType>::lowest() / scale,
+                                  std::numeric_limits<CType>::max() / scale,
+                                  null_probability)}) {
+      for (bool use_threads : {false, true}) {
+        this->ctx_.set_use_threads(use_threads);
+        std::shared_ptr<Array> offsets;
+        ASSERT_OK(arrow::compute::SortToIndices(&this->ctx_, *array, &offsets));
+        ASSERT_EQ(offsets->length(), length);
+        ValidateSorted<ArrayType>(checked_cast<const ArrayType&>(*array),
+                                  checked_cast<UInt64Array&>(*offsets));
+      }
+    }
+  }
+}
+
+TEST(TestSortToIndicesKernelTemporal, SortTimestamp) {
+  FunctionContext ctx;
+  auto values = ArrayFromJSON(timestamp(TimeUnit::MILLI),
+                              "[5, -3, null, 0, -3, 1000000000000, 2]");
+  std::shared_ptr<Array> offsets;
+  ASSERT_OK(arrow::compute::SortToIndices(&ctx, *values, &offsets));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 3, 6, 0, 5, 2]"), *offsets);
+}
+
+class TestSortToIndicesKernelForChunkedArray : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const std::shared_ptr<ChunkedArray>& values, SortOrder order,
+                           NullPlacement null_placement, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, *values, order, null_placement, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestSortToIndicesKernelForChunkedArray, SortChunks) {
+  auto values = ChunkedArrayFromJSON(int32(), {"[3, null, 1]", "[]", "[2, 1, null]"});
+
+  this->AssertSortToIndices(values, SortOrder::ASCENDING, NullPlacement::AT_END,
+                            "[2, 4, 3, 0, 1, 5]");
+  this->AssertSortToIndices(values, SortOrder::DESCENDING, NullPlacement::AT_END,
+                            "[0, 3, 2, 4, 1, 5]");
+  this->AssertSortToIndices(values, SortOrder::ASCENDING, NullPlacement::AT_START,
+                            "[1, 5, 2, 4, 3, 0]");
+  this->AssertSortToIndices(values, SortOrder::DESCENDING, NullPlacement::AT_START,
+                            "[1, 5, 0, 3, 2, 4]");
+
+  auto strings = ChunkedArrayFromJSON(utf8(), {R"(["b", "a"])", R"(["c", "a"])"});
+  this->AssertSortToIndices(strings, SortOrder::DESCENDING, NullPlacement::AT_END,
+                            "[2, 0, 1, 3]");
+
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(
+      SortToIndices(&this->ctx_, *ChunkedArrayFromJSON(int8(), {"[4, 2]"}), &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 0]"), *actual);
+}
+
+TEST_F(TestSortToIndicesKernelForChunkedArray, SortNaN) {
+  // NaNs come after all other values, whatever the order, and nulls are
+  // placed around both
+  auto values =
+      ChunkedArrayFromJSON(float64(), {"[NaN, 1, null]", "[]", "[0.5, NaN, -1]"});
+
+  this->AssertSortToIndices(values, SortOrder::ASCENDING, NullPlacement::AT_END,
+                            "[5, 3, 1, 0, 4, 2]");
+  this->AssertSortToIndices(values, SortOrder::DESCENDING, NullPlacement::AT_END,
+                            "[1, 3, 5, 0, 4, 2]");
+  this->AssertSortToIndices(values, SortOrder::ASCENDING, NullPlacement::AT_START,
+                            "[2, 5, 3, 1, 0, 4]");
+  this->AssertSortToIndices(values, SortOrder::DESCENDING, NullPlacement::AT_START,
+                            "[2, 1, 3, 5, 0, 4]");
+}
+
+TEST_F(TestSortToIndicesKernelForChunkedArray, SortManyNaN) {
+  const int64_t length = 2000;
+  ArrayVector chunks;
+  for (int chunk = 0; chunk < 2; ++chunk) {
+    DoubleBuilder builder;
+    for (int64_t i = 0; i < length / 2; ++i) {
+      ASSERT_OK(builder.Append(i % 4 == chunk ? NAN
+                                              : static_cast<double>((i * 37) % 101)));
+    }
+    std::shared_ptr<Array> chunk_values;
+    ASSERT_OK(builder.Finish(&chunk_values));
+    chunks.push_back(chunk_values);
+  }
+  ChunkedArray values(chunks);
+  std::shared_ptr<Array> combined;
+  ASSERT_OK(Concatenate(chunks, default_memory_pool(), &combined));
+  const auto& typed_values = checked_cast<const DoubleArray&>(*combined);
+
+  for (auto order : {SortOrder::ASCENDING, SortOrder::DESCENDING}) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, values, order, NullPlacement::AT_END, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    const auto& indices = checked_cast<const UInt64Array&>(*actual);
+
+    // Numbers in order, then NaNs, each in input order
+    auto before = [&](uint64_t l, uint64_t r) {
+      const double left = typed_values.Value(l);
+      const double right = typed_values.Value(r);
+      if (std::isnan(left) || std::isnan(right)) {
+        return std::isnan(left) == std::isnan(right) ? l < r : std::isnan(right);
+      }
+      if (left != right) {
+        return order == SortOrder::ASCENDING ? left < right : left > right;
+      }
+      return l < r;
+    };
+    for (int64_t i = 1; i < length; ++i) {
+      ASSERT_TRUE(before(indices.Value(i - 1), indices.Value(i)));
+    }
+  }
+}
+
+class TestSortToIndicesKernelForTable : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortedColumn(const Table& table, const Array& indices, int column,
+                          const std::string& expected) {
+    ASSERT_OK(indices.ValidateFull());
+    std::shared_ptr<Array> combined;
+    ASSERT_OK(Concatenate(table.column(column)->chunks(), default_memory_pool(),
+                          &combined));
+    std::shared_ptr<Array> sorted;
+    ASSERT_OK(Take(&this->ctx_, *combined, indices, TakeOptions(), &sorted));
+    AssertArraysEqual(*ArrayFromJSON(combined->type(), expected), *sorted);
+  }
+};
+
+TEST_F(TestSortToIndicesKernelForTable, SortRecordBatch) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schema, R"([{"a": 1, "b": "x"},
+                                              {"a": null, "b": "y"},
+                                              {"a": 1, "b": null},
+                                              {"a": 0, "b": "z"},
+                                              {"a": 1, "b": "z"}])");
+  std::shared_ptr<Array> actual;
+
+  SortOptions options({SortKey("a"), SortKey("b", SortOrder::DESCENDING)});
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 4, 0, 2, 1]"), *actual);
+
+  options = SortOptions({SortKey("a", SortOrder::DESCENDING, NullPlacement::AT_START),
+                         SortKey("b", SortOrder::ASCENDING, NullPlacement::AT_START)});
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 2, 0, 4, 3]"), *actual);
+
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, SortOptions({SortKey("c")}),
+                                       &actual));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *batch, SortOptions(), &actual));
+}
+
+TEST_F(TestSortToIndicesKernelForTable, SortTable) {
+  auto schema = ::arrow::schema({field("a", uint8()), field("b", float64())});
+  auto table = Table::Make(
+      schema, {ChunkedArrayFromJSON(uint8(), {"[2, 1]", "[2, 1, 2]"}),
+               ChunkedArrayFromJSON(float64(), {"[0.5, 3]", "[1.5, 3]", "[-1]"})});
+  std::shared_ptr<Array> actual;
+
+  SortOptions options({SortKey("a"), SortKey("b")});
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 3, 4, 0, 2]"), *actual);
+
+  // Rows 1 and 3 are equal, stable sort keeps them in input order
+  options = SortOptions({SortKey("a", SortOrder::DESCENDING)});
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 2, 4, 1, 3]"), *actual);
+
+  // An unstable sort may swap them
+  options.stable = false;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  ASSERT_NO_FATAL_FAILURE(AssertSortedColumn(*table, *actual, 0, "[2, 2, 2, 1, 1]"));
+  const auto& indices = checked_cast<const UInt64Array&>(*actual);
+  std::vector<uint64_t> sorted_indices(indices.raw_values(),
+                                       indices.raw_values() + indices.length());
+  std::sort(sorted_indices.begin(), sorted_indices.end());
+  ASSERT_EQ(sorted_indices, std::vector<uint64_t>({0, 1, 2, 3, 4}));
+}
+
+TEST_F(TestSortToIndicesKernelForTable, SortTableNaN) {
+  auto schema = ::arrow::schema({field("a", float64()), field("b", int32())});
+  auto table = Table::Make(
+      schema, {ChunkedArrayFromJSON(float64(), {"[NaN, 1, null]", "[NaN, 1, -2]"}),
+               ChunkedArrayFromJSON(int32(), {"[1, 2, 3]", "[0, 1, 2]"})});
+  std::shared_ptr<Array> actual;
+
+  // Ties on NaN are broken by the next key
+  SortOptions options({SortKey("a"), SortKey("b")});
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 4, 1, 3, 0, 2]"), *actual);
+
+  options = SortOptions({SortKey("a", SortOrder::DESCENDING, NullPlacement::AT_START),
+                         SortKey("b", SortOrder::DESCENDING)});
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 1, 4, 5, 0, 3]"), *actual);
+
+  options.stable = false;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 1, 4, 5, 0, 3]"), *actual);
+}
+
+TEST_F(TestSortToIndicesKernelForTable, SortRandomTable) {
+  random::RandomArrayGenerator rand(0x61a3b5);
+  const int64_t length = 1000;
+  auto schema = ::arrow::schema({field("a", int8()), field("b", utf8())});
+  ArrayVector a_chunks = {rand.Int8(length / 2, 0, 5, 0.1),
+                          rand.Int8(length / 2, 0, 5, 0.1)};
+  ArrayVector b_chunks = {rand.String(length, 0, 2, 0.1)};
+  auto table = Table::Make(schema, {std::make_shared<ChunkedArray>(a_chunks),
+                                    std::make_shared<ChunkedArray>(b_chunks)});
+  std::shared_ptr<Table> combined;
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), &combined));
+  const auto& a = checked_cast<const Int8Array&>(*combined->column(0)->chunk(0));
+  const auto& b = checked_cast<const StringArray&>(*combined->column(1)->chunk(0));
+
+  SortOptions options({SortKey("a", SortOrder::DESCENDING), SortKey("b")});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  const auto& indices = checked_cast<const UInt64Array&>(*actual);
+
+  // a descending nulls last, then b ascending nulls last, then input order
+  auto before = [&](uint64_t l, uint64_t r) {
+    if (a.IsNull(l) != a.IsNull(r)) return a.IsNull(r);
+    if (!a.IsNull(l) && a.Value(l) != a.Value(r)) return a.Value(l) > a.Value(r);
+    if (b.IsNull(l) != b.IsNull(r)) return b.IsNull(r);
+    if (!b.IsNull(l) && b.GetView(l) != b.GetView(r)) return b.GetView(l) < b.GetView(r);
+    return l < r;
+  };
+  for (int64_t i = 1; i < length; ++i) {
+    ASSERT_TRUE(before(indices.Value(i - 1), indices.Value(i)));
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
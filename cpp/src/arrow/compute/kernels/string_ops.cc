@@ -0,0 +1,872 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string_ops.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/utf8.h"
+
+#ifdef ARROW_WITH_RE2
+#include <re2/re2.h>
+#else
+namespace re2 {
+class RE2;
+}  // namespace re2
+#endif
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Helpers
+
+// The offsets and data of an array of binary-like values
+template <typename Type>
+struct StringValues {
+  using offset_type = typename Type::offset_type;
+
+  explicit StringValues(const ArrayData& data)
+      : length(data.length),
+        offsets(data.GetValues<offset_type>(1)),
+        data(data.buffers[2] == NULLPTR ? NULLPTR : data.buffers[2]->data()) {}
+
+  offset_type first_offset() const { return offsets[0]; }
+  offset_type last_offset() const { return offsets[length]; }
+  int64_t data_size() const { return last_offset() - first_offset(); }
+
+  bool IsAscii() const {
+    return util::ValidateAscii(data + first_offset(), data_size());
+  }
+
+  int64_t length;
+  const offset_type* offsets;
+  const uint8_t* data;
+};
+
+template <typename Type>
+struct IsUtf8
+    : std::integral_constant<bool, std::is_same<Type, StringType>::value ||
+                                       std::is_same<Type, LargeStringType>::value> {};
+
+inline bool IsContinuationByte(uint8_t byte) { return (byte & 0xc0) == 0x80; }
+
+inline uint8_t AsciiToUpper(uint8_t c) {
+  return static_cast<uint8_t>(c - ((static_cast<uint8_t>(c - 'a') < 26) << 5));
+}
+
+inline uint8_t AsciiToLower(uint8_t c) {
+  return static_cast<uint8_t>(c + ((static_cast<uint8_t>(c - 'A') < 26) << 5));
+}
+
+// Write offsets starting at zero for values that keep their size
+template <typename offset_type>
+Status RebaseOffsets(FunctionContext* ctx, const offset_type* offsets, int64_t length,
+                     std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(offset_type), out));
+  auto out_offsets = reinterpret_cast<offset_type*>((*out)->mutable_data());
+  const offset_type first = offsets[0];
+  for (int64_t i = 0; i <= length; ++i) {
+    out_offsets[i] = offsets[i] - first;
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Case mapping tables
+
+// Characters up to this one have a case mapping table entry
+constexpr uint32_t kCaseMappingLimit = 0x500;
+
+// Simple case mappings for the Latin, Greek and Cyrillic blocks. No mapping
+// makes the UTF-8 encoding longer, so that case mapping never needs more
+// space than the input.
+struct CaseMappingTables {
+  CaseMappingTables() {
+    for (uint32_t c = 0; c < kCaseMappingLimit; ++c) {
+      upper[c] = lower[c] = static_cast<uint16_t>(c);
+    }
+    // Basic Latin and Latin-1, skipping the multiplication and division signs
+    Block('A', 'Z', 32);
+    Block(0xc0, 0xd6, 32);
+    Block(0xd8, 0xde, 32);
+    Pair(0xff, 0x178);
+    // Latin Extended-A
+    Alternating(0x100, 0x12f);
+    Alternating(0x132, 0x137);
+    Alternating(0x139, 0x148);
+    Alternating(0x14a, 0x177);
+    Alternating(0x179, 0x17e);
+    // Greek, skipping the reserved U+03A2
+    Block(0x391, 0x3a1, 32);
+    Block(0x3a3, 0x3a9, 32);
+    Block(0x388, 0x38a, 37);
+    Block(0x38e, 0x38f, 63);
+    Pair(0x3ac, 0x386);
+    Pair(0x3cc, 0x38c);
+    // Cyrillic
+    Block(0x400, 0x40f, 80);
+    Block(0x410, 0x42f, 32);
+    Alternating(0x460, 0x481);
+    Alternating(0x48a, 0x4bf);
+    Alternating(0x4c1, 0x4ce);
+    Alternating(0x4d0, 0x4ff);
+    Pair(0x4cf, 0x4c0);
+    // One way mappings
+    upper[0xb5] = 0x39c;  // micro sign
+    upper[0x131] = 'I';   // dotless i
+    upper[0x17f] = 'S';   // long s
+    upper[0x3c2] = 0x3a3;  // final sigma
+    lower[0x130] = 'i';   // capital I with dot above
+  }
+
+  void Pair(uint32_t lower_char, uint32_t upper_char) {
+    upper[lower_char] = static_cast<uint16_t>(upper_char);
+    lower[upper_char] = static_cast<uint16_t>(lower_char);
+  }
+
+  // Lower case characters follow upper case ones at a fixed distance
+  void Block(uint32_t first_upper, uint32_t last_upper, uint32_t distance) {
+    for (uint32_t c = first_upper; c <= last_upper; ++c) {
+      Pair(c + distance, c);
+    }
+  }
+
+  // Upper and lower case characters alternate
+  void Alternating(uint32_t first_upper, uint32_t last_lower) {
+    for (uint32_t c = first_upper; c < last_lower; c += 2) {
+      Pair(c + 1, c);
+    }
+  }
+
+  uint16_t upper[kCaseMappingLimit];
+  uint16_t lower[kCaseMappingLimit];
+};
+
+const CaseMappingTables& GetCaseMappingTables() {
+  static const CaseMappingTables tables;
+  return tables;
+}
+
+struct AsciiUpperTransform {
+  static constexpr bool kAsciiOnly = true;
+  static uint8_t MapAscii(uint8_t c) { return AsciiToUpper(c); }
+  uint32_t Map(uint32_t c) const { return c; }
+};
+
+struct AsciiLowerTransform {
+  static constexpr bool kAsciiOnly = true;
+  static uint8_t MapAscii(uint8_t c) { return AsciiToLower(c); }
+  uint32_t Map(uint32_t c) const { return c; }
+};
+
+struct Utf8UpperTransform {
+  static constexpr bool kAsciiOnly = false;
+  static uint8_t MapAscii(uint8_t c) { return AsciiToUpper(c); }
+  uint32_t Map(uint32_t c) const { return c < kCaseMappingLimit ? table[c] : c; }
+  const uint16_t* table = GetCaseMappingTables().upper;
+};
+
+struct Utf8LowerTransform {
+  static constexpr bool kAsciiOnly = false;
+  static uint8_t MapAscii(uint8_t c) { return AsciiToLower(c); }
+  uint32_t Map(uint32_t c) const { return c < kCaseMappingLimit ? table[c] : c; }
+  const uint16_t* table = GetCaseMappingTables().lower;
+};
+
+// ----------------------------------------------------------------------
+// Kernels
+
+class StringUnaryKernel : public UnaryKernel {
+ public:
+  explicit StringUnaryKernel(std::shared_ptr<DataType> out_type)
+      : out_type_(std::move(out_type)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ protected:
+  std::shared_ptr<DataType> out_type_;
+};
+
+template <typename Type, bool kCharacters>
+class LengthKernel : public StringUnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit LengthKernel(const std::shared_ptr<DataType>&)
+      : StringUnaryKernel(TypeTraits<typename CTypeTraits<offset_type>::ArrowType>::
+                              type_singleton()) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* out_data = out->array().get();
+    out_data->buffers.resize(2);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, out_data));
+    RETURN_NOT_OK(ctx->Allocate(in_data.length * sizeof(offset_type),
+                                &out_data->buffers[1]));
+
+    StringValues<Type> values(in_data);
+    auto lengths = out_data->GetMutableValues<offset_type>(1);
+    if (!kCharacters || values.IsAscii()) {
+      for (int64_t i = 0; i < values.length; ++i) {
+        lengths[i] = values.offsets[i + 1] - values.offsets[i];
+      }
+      return Status::OK();
+    }
+    for (int64_t i = 0; i < values.length; ++i) {
+      // Count the bytes starting a character
+      const uint8_t* data = values.data + values.offsets[i];
+      const offset_type size = values.offsets[i + 1] - values.offsets[i];
+      offset_type count = 0;
+      for (offset_type j = 0; j < size; ++j) {
+        count += !IsContinuationByte(data[j]);
+      }
+      lengths[i] = count;
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+using BinaryLengthKernel = LengthKernel<Type, false>;
+
+template <typename Type>
+using Utf8LengthKernel = LengthKernel<Type, true>;
+
+template <typename Type, typename Transform>
+class CaseMappingKernel : public StringUnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit CaseMappingKernel(const std::shared_ptr<DataType>& type)
+      : StringUnaryKernel(type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* out_data = out->array().get();
+    out_data->buffers.resize(3);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, out_data));
+
+    StringValues<Type> values(in_data);
+    const int64_t data_size = values.data_size();
+    RETURN_NOT_OK(ctx->Allocate(data_size, &out_data->buffers[2]));
+    uint8_t* out_values = out_data->buffers[2]->mutable_data();
+    const uint8_t* in_values = values.data + values.first_offset();
+
+    if (Transform::kAsciiOnly || values.IsAscii()) {
+      // Sizes are unchanged: transform the data buffer in one loop, and share
+      // the offsets if possible
+      for (int64_t i = 0; i < data_size; ++i) {
+        out_values[i] = Transform::MapAscii(in_values[i]);
+      }
+      if (in_data.offset == 0 && values.first_offset() == 0) {
+        out_data->buffers[1] = in_data.buffers[1];
+        return Status::OK();
+      }
+      return RebaseOffsets(ctx, values.offsets, values.length, &out_data->buffers[1]);
+    }
+
+    RETURN_NOT_OK(
+        ctx->Allocate((values.length + 1) * sizeof(offset_type), &out_data->buffers[1]));
+    auto out_offsets = out_data->GetMutableValues<offset_type>(1);
+    Transform transform;
+    uint8_t* dest = out_values;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < values.length; ++i) {
+      const uint8_t* str = values.data + values.offsets[i];
+      const uint8_t* end = values.data + values.offsets[i + 1];
+      while (str < end) {
+        if (*str < 0x80) {
+          *dest++ = Transform::MapAscii(*str++);
+          continue;
+        }
+        uint32_t codepoint;
+        if (util::UTF8Decode(&str, end, &codepoint)) {
+          dest = util::UTF8Encode(dest, transform.Map(codepoint));
+        } else {
+          // Invalid bytes are copied as is
+          *dest++ = static_cast<uint8_t>(codepoint);
+        }
+      }
+      out_offsets[i + 1] = static_cast<offset_type>(dest - out_values);
+    }
+    DCHECK_LE(dest - out_values, data_size);
+    out_data->buffers[2] = SliceBuffer(out_data->buffers[2], 0, dest - out_values);
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+using AsciiUpperKernel = CaseMappingKernel<Type, AsciiUpperTransform>;
+template <typename Type>
+using AsciiLowerKernel = CaseMappingKernel<Type, AsciiLowerTransform>;
+template <typename Type>
+using Utf8UpperKernel = CaseMappingKernel<Type, Utf8UpperTransform>;
+template <typename Type>
+using Utf8LowerKernel = CaseMappingKernel<Type, Utf8LowerTransform>;
+
+template <typename Type>
+class SubstringKernel : public StringUnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  SubstringKernel(const std::shared_ptr<DataType>& type, const SubstringOptions& options)
+      : StringUnaryKernel(type), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* out_data = out->array().get();
+    out_data->buffers.resize(3);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, out_data));
+
+    StringValues<Type> values(in_data);
+    RETURN_NOT_OK(ctx->Allocate(values.data_size(), &out_data->buffers[2]));
+    RETURN_NOT_OK(
+        ctx->Allocate((values.length + 1) * sizeof(offset_type), &out_data->buffers[1]));
+    uint8_t* out_values = out_data->buffers[2]->mutable_data();
+    auto out_offsets = out_data->GetMutableValues<offset_type>(1);
+
+    const bool by_character = IsUtf8<Type>::value && !values.IsAscii();
+    uint8_t* dest = out_values;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < values.length; ++i) {
+      const uint8_t* begin = values.data + values.offsets[i];
+      const uint8_t* end = values.data + values.offsets[i + 1];
+      std::pair<const uint8_t*, const uint8_t*> range =
+          by_character ? CharacterRange(begin, end) : ByteRange(begin, end);
+      const int64_t size = range.second - range.first;
+      if (size > 0) {
+        std::memcpy(dest, range.first, static_cast<size_t>(size));
+        dest += size;
+      }
+      out_offsets[i + 1] = static_cast<offset_type>(dest - out_values);
+    }
+    out_data->buffers[2] = SliceBuffer(out_data->buffers[2], 0, dest - out_values);
+    return Status::OK();
+  }
+
+ private:
+  std::pair<const uint8_t*, const uint8_t*> ByteRange(const uint8_t* begin,
+                                                      const uint8_t* end) const {
+    const int64_t size = end - begin;
+    int64_t start = options_.start, length = options_.length;
+    if (start < 0) {
+      start += size;
+      if (start < 0) {
+        // Characters before the beginning count towards the length
+        length = std::max(length + start, static_cast<int64_t>(0));
+        start = 0;
+      }
+    }
+    start = std::min(start, size);
+    length = std::min(length, size - start);
+    return {begin + start, begin + start + length};
+  }
+
+  std::pair<const uint8_t*, const uint8_t*> CharacterRange(const uint8_t* begin,
+                                                           const uint8_t* end) const {
+    const uint8_t* first = begin;
+    int64_t length = options_.length;
+    if (options_.start >= 0) {
+      for (int64_t n = 0; n < options_.start && first < end; ++n) {
+        first = NextCharacter(first, end);
+      }
+    } else {
+      first = end;
+      int64_t n = 0;
+      for (; n < -options_.start && first > begin; ++n) {
+        --first;
+        while (first > begin && IsContinuationByte(*first)) {
+          --first;
+        }
+      }
+      // Characters before the beginning count towards the length
+      length -= -options_.start - n;
+    }
+    const uint8_t* last = first;
+    for (int64_t n = 0; n < length && last < end; ++n) {
+      last = NextCharacter(last, end);
+    }
+    return {first, last};
+  }
+
+  static const uint8_t* NextCharacter(const uint8_t* str, const uint8_t* end) {
+    ++str;
+    while (str < end && IsContinuationByte(*str)) {
+      ++str;
+    }
+    return str;
+  }
+
+  SubstringOptions options_;
+};
+
+// Find the first occurrence of a non-empty pattern, scanning for its first
+// byte with memchr and comparing the rest with memcmp
+inline const uint8_t* FindSubstring(const uint8_t* data, int64_t size,
+                                    const uint8_t* pattern, int64_t pattern_size) {
+  if (size < pattern_size) {
+    return NULLPTR;
+  }
+  const uint8_t* str = data;
+  const uint8_t* last = data + size - pattern_size + 1;
+  const uint8_t first = pattern[0];
+  while (str < last) {
+    str = static_cast<const uint8_t*>(std::memchr(str, first, last - str));
+    if (str == NULLPTR) {
+      return NULLPTR;
+    }
+    if (std::memcmp(str + 1, pattern + 1, pattern_size - 1) == 0) {
+      return str;
+    }
+    ++str;
+  }
+  return NULLPTR;
+}
+
+enum class MatchKind { PREFIX, SUFFIX, SUBSTRING, EXACT, REGEX };
+
+template <typename Type>
+class MatchKernel : public StringUnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  MatchKernel(MatchKind kind, std::string pattern, const re2::RE2* regex = NULLPTR)
+      : StringUnaryKernel(boolean()),
+        kind_(kind),
+        pattern_(std::move(pattern)),
+        regex_(regex) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* out_data = out->array().get();
+    out_data->buffers.resize(2);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, out_data));
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(in_data.length),
+                                &out_data->buffers[1]));
+    uint8_t* bitmap = out_data->buffers[1]->mutable_data();
+
+    StringValues<Type> values(in_data);
+    const auto pattern = reinterpret_cast<const uint8_t*>(pattern_.data());
+    const auto pattern_size = static_cast<offset_type>(pattern_.size());
+    if (pattern_size == 0 && kind_ != MatchKind::EXACT && kind_ != MatchKind::REGEX) {
+      BitUtil::SetBitsTo(bitmap, 0, values.length, true);
+      return Status::OK();
+    }
+    int64_t i = 0;
+    switch (kind_) {
+      case MatchKind::PREFIX:
+        internal::GenerateBitsUnrolled(bitmap, 0, values.length, [&]() -> bool {
+          const offset_type begin = values.offsets[i];
+          const offset_type size = values.offsets[++i] - begin;
+          return size >= pattern_size &&
+                 std::memcmp(values.data + begin, pattern, pattern_size) == 0;
+        });
+        break;
+      case MatchKind::SUFFIX:
+        internal::GenerateBitsUnrolled(bitmap, 0, values.length, [&]() -> bool {
+          const offset_type end = values.offsets[++i];
+          const offset_type size = end - values.offsets[i - 1];
+          return size >= pattern_size &&
+                 std::memcmp(values.data + end - pattern_size, pattern, pattern_size) ==
+                     0;
+        });
+        break;
+      case MatchKind::SUBSTRING:
+        MatchSubstring(values, pattern, pattern_size, bitmap);
+        break;
+      case MatchKind::EXACT:
+        internal::GenerateBitsUnrolled(bitmap, 0, values.length, [&]() -> bool {
+          const offset_type begin = values.offsets[i];
+          const offset_type size = values.offsets[++i] - begin;
+          return size == pattern_size &&
+                 std::memcmp(values.data + begin, pattern, pattern_size) == 0;
+        });
+        break;
+      case MatchKind::REGEX:
+        return MatchRegex(values, bitmap);
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Search the data of all values at once, then map matches back to values
+  static void MatchSubstring(const StringValues<Type>& values, const uint8_t* pattern,
+                             offset_type pattern_size, uint8_t* bitmap) {
+    BitUtil::SetBitsTo(bitmap, 0, values.length, false);
+    const offset_type last = values.last_offset();
+    offset_type position = values.first_offset();
+    int64_t i = 0;
+    while (position < last) {
+      const uint8_t* found = FindSubstring(values.data + position, last - position,
+                                           pattern, pattern_size);
+      if (found == NULLPTR) {
+        break;
+      }
+      const auto match = static_cast<offset_type>(found - values.data);
+      while (values.offsets[i + 1] <= match) {
+        ++i;
+      }
+      if (match + pattern_size <= values.offsets[i + 1]) {
+        // Matched within value i, resume at the next one
+        BitUtil::SetBit(bitmap, i);
+        position = values.offsets[i + 1];
+      } else {
+        // The match straddles two values
+        position = match + 1;
+      }
+    }
+  }
+
+  Status MatchRegex(const StringValues<Type>& values, uint8_t* bitmap) const {
+#ifdef ARROW_WITH_RE2
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(bitmap, 0, values.length, [&]() -> bool {
+      const offset_type begin = values.offsets[i];
+      const offset_type size = values.offsets[++i] - begin;
+      const re2::StringPiece value(reinterpret_cast<const char*>(values.data) + begin,
+                                   size);
+      return re2::RE2::PartialMatch(value, *regex_);
+    });
+    return Status::OK();
+#else
+    return Status::NotImplemented("Regular expression matching requires RE2 support");
+#endif
+  }
+
+  MatchKind kind_;
+  std::string pattern_;
+  const re2::RE2* regex_;
+};
+
+template <typename Type>
+struct StartsWithKernel : public MatchKernel<Type> {
+  StartsWithKernel(const std::shared_ptr<DataType>&, const MatchSubstringOptions& options)
+      : MatchKernel<Type>(MatchKind::PREFIX, options.pattern) {}
+};
+
+template <typename Type>
+struct EndsWithKernel : public MatchKernel<Type> {
+  EndsWithKernel(const std::shared_ptr<DataType>&, const MatchSubstringOptions& options)
+      : MatchKernel<Type>(MatchKind::SUFFIX, options.pattern) {}
+};
+
+template <typename Type>
+struct MatchSubstringKernel : public MatchKernel<Type> {
+  MatchSubstringKernel(const std::shared_ptr<DataType>&,
+                       const MatchSubstringOptions& options)
+      : MatchKernel<Type>(MatchKind::SUBSTRING, options.pattern) {}
+};
+
+template <typename Type>
+struct PatternMatchKernel : public MatchKernel<Type> {
+  PatternMatchKernel(const std::shared_ptr<DataType>&, MatchKind kind,
+                     const std::string& literal, const re2::RE2* regex)
+      : MatchKernel<Type>(kind, literal, regex) {}
+};
+
+// ----------------------------------------------------------------------
+// Pattern analysis
+
+// A pattern reduced to a literal match where possible, or else to a
+// regular expression
+struct PatternPlan {
+  MatchKind kind;
+  std::string literal;
+  std::string regex;
+};
+
+// Escape every character with a special meaning in RE2 syntax
+void AppendQuotedRegex(const std::string& literal, std::string* out) {
+  for (const char c : literal) {
+    if (c == '\0') {
+      out->append("\\x00");
+      continue;
+    }
+    const auto byte = static_cast<uint8_t>(c);
+    if (!(std::isalnum(byte) || c == '_' || byte >= 0x80)) {
+      out->push_back('\\');
+    }
+    out->push_back(c);
+  }
+}
+
+Status PlanLikePattern(const std::string& pattern, char escape, PatternPlan* out) {
+  // Split the pattern into literal runs separated by wildcards, which are
+  // kept as their regex translation
+  std::vector<std::string> literals(1);
+  std::vector<char> wildcards;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    const char c = pattern[i];
+    if (c == escape) {
+      if (++i == pattern.size()) {
+        return Status::Invalid("LIKE pattern must not end with the escape character: '",
+                               pattern, "'");
+      }
+      literals.back().push_back(pattern[i]);
+    } else if (c == '%' || c == '_') {
+      wildcards.push_back(c);
+      literals.emplace_back();
+    } else {
+      literals.back().push_back(c);
+    }
+  }
+
+  // Literal fast paths: no '_' and no '%' between two non-empty literals
+  const bool has_underscore =
+      std::find(wildcards.begin(), wildcards.end(), '_') != wildcards.end();
+  size_t num_literals = 0;
+  for (const auto& literal : literals) {
+    num_literals += !literal.empty();
+  }
+  if (!has_underscore && num_literals <= 1) {
+    const bool leading = !wildcards.empty() && literals.front().empty();
+    const bool trailing = !wildcards.empty() && literals.back().empty();
+    out->literal.clear();
+    for (const auto& literal : literals) {
+      out->literal += literal;
+    }
+    if (wildcards.empty()) {
+      out->kind = MatchKind::EXACT;
+    } else if (out->literal.empty() || (leading && trailing)) {
+      out->kind = MatchKind::SUBSTRING;
+    } else {
+      out->kind = leading ? MatchKind::SUFFIX : MatchKind::PREFIX;
+    }
+    return Status::OK();
+  }
+
+  out->kind = MatchKind::REGEX;
+  out->regex = "^";
+  for (size_t i = 0; i < literals.size(); ++i) {
+    AppendQuotedRegex(literals[i], &out->regex);
+    if (i < wildcards.size()) {
+      out->regex += wildcards[i] == '%' ? ".*" : ".";
+    }
+  }
+  out->regex += "$";
+  return Status::OK();
+}
+
+Status PlanRegexPattern(const std::string& pattern, PatternPlan* out) {
+  std::string body = pattern;
+  const bool anchored_start = !body.empty() && body.front() == '^';
+  if (anchored_start) {
+    body.erase(0, 1);
+  }
+  const bool anchored_end = !body.empty() && body.back() == '$';
+  if (anchored_end) {
+    body.pop_back();
+  }
+  if (body.find_first_of("\\^$.|?*+()[]{}") == std::string::npos) {
+    // A plain literal, possibly anchored
+    out->literal = std::move(body);
+    if (anchored_start) {
+      out->kind = anchored_end ? MatchKind::EXACT : MatchKind::PREFIX;
+    } else {
+      out->kind = anchored_end ? MatchKind::SUFFIX : MatchKind::SUBSTRING;
+    }
+    return Status::OK();
+  }
+  out->kind = MatchKind::REGEX;
+  out->regex = pattern;
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Dispatch
+
+template <template <typename> class KernelType, typename... Args>
+Status ExecStringKernel(FunctionContext* ctx, const Datum& values, bool utf8_only,
+                        Datum* out, Args&&... args) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("String kernels expect an array or chunked array");
+  }
+  const auto& type = values.type();
+  std::unique_ptr<UnaryKernel> kernel;
+  switch (type->id()) {
+    case Type::STRING:
+      kernel.reset(new KernelType<StringType>(type, std::forward<Args>(args)...));
+      break;
+    case Type::LARGE_STRING:
+      kernel.reset(new KernelType<LargeStringType>(type, std::forward<Args>(args)...));
+      break;
+    case Type::BINARY:
+      if (!utf8_only) {
+        kernel.reset(new KernelType<BinaryType>(type, std::forward<Args>(args)...));
+      }
+      break;
+    case Type::LARGE_BINARY:
+      if (!utf8_only) {
+        kernel.reset(new KernelType<LargeBinaryType>(type, std::forward<Args>(args)...));
+      }
+      break;
+    default:
+      break;
+  }
+  if (kernel == NULLPTR) {
+    return Status::NotImplemented("String kernel not implemented for type ", *type);
+  }
+
+  std::vector<Datum> result;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel.get(), values, &result));
+  *out = detail::WrapDatumsLike(values, result);
+  return Status::OK();
+}
+
+}  // namespace
+
+class StringMatcher::Impl {
+ public:
+  MatchKind kind;
+  std::string literal;
+#ifdef ARROW_WITH_RE2
+  std::unique_ptr<re2::RE2> regex;
+#endif
+
+  const re2::RE2* regex_ptr() const {
+#ifdef ARROW_WITH_RE2
+    return regex.get();
+#else
+    return NULLPTR;
+#endif
+  }
+};
+
+StringMatcher::StringMatcher(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+StringMatcher::~StringMatcher() {}
+
+Status StringMatcher::Make(const MatchPatternOptions& options,
+                           std::unique_ptr<StringMatcher>* out) {
+  PatternPlan plan;
+  switch (options.syntax) {
+    case MatchPatternOptions::LIKE:
+      RETURN_NOT_OK(PlanLikePattern(options.pattern, options.escape, &plan));
+      break;
+    case MatchPatternOptions::REGEX:
+      RETURN_NOT_OK(PlanRegexPattern(options.pattern, &plan));
+      break;
+    default:
+      return Status::Invalid("Unknown pattern syntax");
+  }
+
+  std::unique_ptr<Impl> impl(new Impl);
+  impl->kind = plan.kind;
+  impl->literal = std::move(plan.literal);
+  if (plan.kind == MatchKind::REGEX) {
+#ifdef ARROW_WITH_RE2
+    re2::RE2::Options regex_options;
+    regex_options.set_log_errors(false);
+    // LIKE wildcards match any character, including newlines
+    regex_options.set_dot_nl(options.syntax == MatchPatternOptions::LIKE);
+    impl->regex.reset(new re2::RE2(plan.regex, regex_options));
+    if (!impl->regex->ok()) {
+      return Status::Invalid("Invalid regular expression '", options.pattern,
+                             "': ", impl->regex->error());
+    }
+#else
+    return Status::NotImplemented("Pattern '", options.pattern,
+                                  "' requires a regular expression engine, but Arrow ",
+                                  "was built without RE2 support");
+#endif
+  }
+  out->reset(new StringMatcher(std::move(impl)));
+  return Status::OK();
+}
+
+Status StringMatcher::Match(FunctionContext* ctx, const Datum& values,
+                            Datum* out) const {
+  return ExecStringKernel<PatternMatchKernel>(ctx, values, true, out, impl_->kind,
+                                              impl_->literal, impl_->regex_ptr());
+}
+
+bool StringMatcher::is_literal() const { return impl_->kind != MatchKind::REGEX; }
+
+Status BinaryLength(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStringKernel<BinaryLengthKernel>(ctx, values, false, out);
+}
+
+Status Utf8Length(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStringKernel<Utf8LengthKernel>(ctx, values, true, out);
+}
+
+Status AsciiUpper(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStringKernel<AsciiUpperKernel>(ctx, values, false, out);
+}
+
+Status AsciiLower(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStringKernel<AsciiLowerKernel>(ctx, values, false, out);
+}
+
+Status Utf8Upper(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStringKernel<Utf8UpperKernel>(ctx, values, true, out);
+}
+
+Status Utf8Lower(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStringKernel<Utf8LowerKernel>(ctx, values, true, out);
+}
+
+Status Substring(FunctionContext* ctx, const Datum& values,
+                 const SubstringOptions& options, Datum* out) {
+  if (options.length < 0) {
+    return Status::Invalid("Substring length must be non-negative, got ",
+                           options.length);
+  }
+  return ExecStringKernel<SubstringKernel>(ctx, values, false, out, options);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& values,
+                  const MatchSubstringOptions& options, Datum* out) {
+  return ExecStringKernel<StartsWithKernel>(ctx, values, false, out, options);
+}
+
+Status EndsWith(FunctionContext* ctx, const Datum& values,
+                const MatchSubstringOptions& options, Datum* out) {
+  return ExecStringKernel<EndsWithKernel>(ctx, values, false, out, options);
+}
+
+Status MatchSubstring(FunctionContext* ctx, const Datum& values,
+                      const MatchSubstringOptions& options, Datum* out) {
+  return ExecStringKernel<MatchSubstringKernel>(ctx, values, false, out, options);
+}
+
+Status MatchPattern(FunctionContext* ctx, const Datum& values,
+                    const MatchPatternOptions& options, Datum* out) {
+  std::unique_ptr<StringMatcher> matcher;
+  RETURN_NOT_OK(StringMatcher::Make(options, &matcher));
+  return matcher->Match(ctx, values, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
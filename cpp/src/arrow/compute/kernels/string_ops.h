@@ -0,0 +1,237 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+// The kernels below take an Array or ChunkedArray of binary, string, large
+// binary or large string type. They work directly on the offsets and data
+// buffers, and nulls in the input are nulls in the output. String values
+// are assumed to be valid UTF-8.
+
+/// \brief Number of bytes of each value
+///
+/// The output is int32, or int64 for large types.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status BinaryLength(FunctionContext* ctx, const Datum& values, Datum* out);
+
+/// \brief Number of characters of each string value
+///
+/// The output is int32, or int64 for large strings.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* ctx, const Datum& values, Datum* out);
+
+/// \brief Convert the ASCII letters of each value to upper case
+///
+/// Other bytes are left unchanged.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiUpper(FunctionContext* ctx, const Datum& values, Datum* out);
+
+/// \brief Convert the ASCII letters of each value to lower case
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiLower(FunctionContext* ctx, const Datum& values, Datum* out);
+
+/// \brief Convert each string value to upper case
+///
+/// Simple (one to one) case mapping is applied to the Basic Latin,
+/// Latin-1, Latin Extended-A, Greek and Cyrillic blocks; other characters
+/// are left unchanged. All-ASCII inputs take a faster path.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Upper(FunctionContext* ctx, const Datum& values, Datum* out);
+
+/// \brief Convert each string value to lower case
+///
+/// Case mapping covers the same characters as Utf8Upper().
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Lower(FunctionContext* ctx, const Datum& values, Datum* out);
+
+/// \class SubstringOptions
+///
+/// Positions are counted in characters for strings and in bytes for
+/// binary values. As with Python slices, the substring spans positions
+/// [start, start + length) of each value, clipped to the value.
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start,
+                            int64_t length = std::numeric_limits<int64_t>::max())
+      : start(start), length(length) {}
+
+  /// Index of the first character, counted from the end if negative
+  int64_t start;
+  /// Maximum number of characters, must be non-negative
+  int64_t length;
+};
+
+/// \brief Extract a substring of each value
+///
+/// For example given values = ["hello", "hi", null] and options
+/// start = 1, length = 3, the output will be ["ell", "i", null]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values strings to extract from
+/// \param[in] options start and length of the substrings
+/// \param[out] out substrings, with the type of values
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Substring(FunctionContext* ctx, const Datum& values,
+                 const SubstringOptions& options, Datum* out);
+
+/// \class MatchSubstringOptions
+///
+/// The pattern is compared bytewise, which for valid UTF-8 is the same as
+/// comparing characters.
+struct ARROW_EXPORT MatchSubstringOptions {
+  explicit MatchSubstringOptions(std::string pattern) : pattern(std::move(pattern)) {}
+
+  std::string pattern;
+};
+
+/// \brief Whether each value starts with the pattern
+///
+/// The output is a BooleanArray.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* ctx, const Datum& values,
+                  const MatchSubstringOptions& options, Datum* out);
+
+/// \brief Whether each value ends with the pattern
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EndsWith(FunctionContext* ctx, const Datum& values,
+                const MatchSubstringOptions& options, Datum* out);
+
+/// \brief Whether each value contains the pattern
+///
+/// The data buffer of each array is searched in a single pass rather than
+/// value by value, which keeps short values cheap.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchSubstring(FunctionContext* ctx, const Datum& values,
+                      const MatchSubstringOptions& options, Datum* out);
+
+/// \class MatchPatternOptions
+struct ARROW_EXPORT MatchPatternOptions {
+  enum Syntax {
+    /// SQL LIKE: '%' matches any sequence of characters, '_' matches a
+    /// single character and the whole value must match
+    LIKE,
+    /// RE2 regular expression, matching anywhere in the value unless
+    /// anchored
+    REGEX
+  };
+
+  explicit MatchPatternOptions(std::string pattern, Syntax syntax = LIKE,
+                               char escape = '\\')
+      : pattern(std::move(pattern)), syntax(syntax), escape(escape) {}
+
+  std::string pattern;
+  Syntax syntax;
+  /// Character quoting the next '%', '_' or escape character of a LIKE
+  /// pattern
+  char escape;
+};
+
+/// \class StringMatcher
+/// \brief A LIKE or regex pattern compiled once for matching many arrays
+///
+/// Patterns that reduce to a literal prefix, suffix, substring or exact
+/// match are evaluated with memcmp and memchr; others require Arrow to be
+/// built with RE2 (ARROW_WITH_RE2). A matcher may be used concurrently from
+/// several threads.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT StringMatcher {
+ public:
+  ~StringMatcher();
+
+  /// \brief Compile a pattern
+  ///
+  /// Return Invalid if the pattern is malformed, and NotImplemented if it
+  /// needs a regular expression engine and none is available.
+  static Status Make(const MatchPatternOptions& options,
+                     std::unique_ptr<StringMatcher>* out);
+
+  /// \brief Whether each value matches the pattern
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] values Array or ChunkedArray of string or large string type
+  /// \param[out] out a BooleanArray, null where values are null
+  Status Match(FunctionContext* ctx, const Datum& values, Datum* out) const;
+
+  /// Whether the pattern is evaluated without the regular expression engine
+  bool is_literal() const;
+
+  class Impl;
+
+ private:
+  explicit StringMatcher(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Whether each value matches a LIKE or regex pattern
+///
+/// Compiles the pattern with StringMatcher::Make() and applies it once.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchPattern(FunctionContext* ctx, const Datum& values,
+                    const MatchPatternOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
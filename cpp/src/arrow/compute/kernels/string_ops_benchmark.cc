@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string_ops.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+constexpr int64_t kStringsSize = 1 << 20;
+
+static std::shared_ptr<Array> MakeStrings(double null_probability) {
+  // Short values, as found in log lines and identifiers
+  random::RandomArrayGenerator rand(kSeed);
+  return rand.String(kStringsSize / 12, 4, 20, null_probability);
+}
+
+static void SetStringsProcessed(benchmark::State& state, const Array& array) {
+  const auto& strings = static_cast<const StringArray&>(array);
+  state.SetBytesProcessed(state.iterations() * strings.value_offset(strings.length()));
+  state.SetItemsProcessed(state.iterations() * strings.length());
+}
+
+static void Utf8UpperAscii(benchmark::State& state) {
+  auto values = MakeStrings(0.01);
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Utf8Upper(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetStringsProcessed(state, *values);
+}
+
+static void Utf8LengthAscii(benchmark::State& state) {
+  auto values = MakeStrings(0.01);
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Utf8Length(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetStringsProcessed(state, *values);
+}
+
+template <decltype(MatchSubstring)* Match>
+static void MatchKernel(benchmark::State& state) {
+  auto values = MakeStrings(0.01);
+  MatchSubstringOptions options("abc");
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Match(&ctx, values, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetStringsProcessed(state, *values);
+}
+
+static void MatchPatternBenchmark(benchmark::State& state,
+                                  const MatchPatternOptions& options) {
+  auto values = MakeStrings(0.01);
+  std::unique_ptr<StringMatcher> matcher;
+  ABORT_NOT_OK(StringMatcher::Make(options, &matcher));
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(matcher->Match(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetStringsProcessed(state, *values);
+}
+
+// Evaluated as a substring search
+static void MatchLikeLiteral(benchmark::State& state) {
+  MatchPatternBenchmark(state, MatchPatternOptions("%abc%"));
+}
+
+#ifdef ARROW_WITH_RE2
+// Evaluated by the regular expression engine
+static void MatchLikeRegex(benchmark::State& state) {
+  MatchPatternBenchmark(state, MatchPatternOptions("%a_c%"));
+}
+#endif
+
+static void SubstringAscii(benchmark::State& state) {
+  auto values = MakeStrings(0.01);
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Substring(&ctx, values, SubstringOptions(2, 5), &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetStringsProcessed(state, *values);
+}
+
+BENCHMARK(Utf8UpperAscii);
+BENCHMARK(Utf8LengthAscii);
+BENCHMARK_TEMPLATE(MatchKernel, MatchSubstring);
+BENCHMARK_TEMPLATE(MatchKernel, StartsWith);
+BENCHMARK_TEMPLATE(MatchKernel, EndsWith);
+BENCHMARK(MatchLikeLiteral);
+#ifdef ARROW_WITH_RE2
+BENCHMARK(MatchLikeRegex);
+#endif
+BENCHMARK(SubstringAscii);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,372 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string_ops.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+namespace arrow {
+namespace compute {
+
+using StringFunction = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+template <typename ArrowType>
+class TestStringKernels : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<DataType> offset_type() {
+    return is_large() ? int64() : int32();
+  }
+
+  bool is_large() const {
+    return ArrowType::type_id == Type::LARGE_STRING ||
+           ArrowType::type_id == Type::LARGE_BINARY;
+  }
+
+  void AssertOutput(const Datum& out, const std::shared_ptr<Array>& expected) {
+    ASSERT_TRUE(out.is_array());
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+  }
+
+  void Check(StringFunction func, const std::string& values,
+             const std::shared_ptr<DataType>& out_type, const std::string& expected) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, ArrayFromJSON(type(), values), &out));
+    AssertOutput(out, ArrayFromJSON(out_type, expected));
+  }
+
+  void CheckSubstring(const SubstringOptions& options, const std::string& values,
+                      const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Substring(&this->ctx_, ArrayFromJSON(type(), values), options, &out));
+    AssertOutput(out, ArrayFromJSON(type(), expected));
+  }
+
+  void CheckMatch(decltype(StartsWith)* func, const std::string& pattern,
+                  const std::shared_ptr<Array>& values, const std::string& expected) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, values, MatchSubstringOptions(pattern), &out));
+    AssertOutput(out, ArrayFromJSON(boolean(), expected));
+  }
+
+  void CheckMatch(decltype(StartsWith)* func, const std::string& pattern,
+                  const std::string& values, const std::string& expected) {
+    CheckMatch(func, pattern, ArrayFromJSON(type(), values), expected);
+  }
+
+  void CheckPattern(const MatchPatternOptions& options, bool is_literal,
+                    const std::string& values, const std::string& expected) {
+    std::unique_ptr<StringMatcher> matcher;
+    ASSERT_OK(StringMatcher::Make(options, &matcher));
+    ASSERT_EQ(is_literal, matcher->is_literal()) << options.pattern;
+    Datum out;
+    ASSERT_OK(matcher->Match(&this->ctx_, ArrayFromJSON(type(), values), &out));
+    AssertOutput(out, ArrayFromJSON(boolean(), expected));
+  }
+
+  void CheckLike(const std::string& pattern, bool is_literal, const std::string& values,
+                 const std::string& expected) {
+    CheckPattern(MatchPatternOptions(pattern), is_literal, values, expected);
+  }
+
+  void CheckRegex(const std::string& pattern, bool is_literal, const std::string& values,
+                  const std::string& expected) {
+    CheckPattern(MatchPatternOptions(pattern, MatchPatternOptions::REGEX), is_literal,
+                 values, expected);
+  }
+};
+
+typedef ::testing::Types<StringType, LargeStringType, BinaryType, LargeBinaryType>
+    BinaryLikeArrowTypes;
+
+typedef ::testing::Types<StringType, LargeStringType> StringArrowTypes;
+
+template <typename ArrowType>
+class TestBinaryLikeKernels : public TestStringKernels<ArrowType> {};
+TYPED_TEST_CASE(TestBinaryLikeKernels, BinaryLikeArrowTypes);
+
+template <typename ArrowType>
+class TestUtf8Kernels : public TestStringKernels<ArrowType> {};
+TYPED_TEST_CASE(TestUtf8Kernels, StringArrowTypes);
+
+TYPED_TEST(TestBinaryLikeKernels, BinaryLength) {
+  this->Check(BinaryLength, "[]", this->offset_type(), "[]");
+  this->Check(BinaryLength, R"(["abc", null, "", "héllo"])", this->offset_type(),
+              "[3, null, 0, 6]");
+}
+
+TYPED_TEST(TestBinaryLikeKernels, AsciiCase) {
+  this->Check(AsciiUpper, R"(["aBc", null, "", "héllo-world_09"])", this->type(),
+              R"(["ABC", null, "", "HéLLO-WORLD_09"])");
+  this->Check(AsciiLower, R"(["aBc", null, "", "HÉLLO-World_09"])", this->type(),
+              R"(["abc", null, "", "hÉllo-world_09"])");
+}
+
+TYPED_TEST(TestBinaryLikeKernels, SubstringBytes) {
+  this->CheckSubstring(SubstringOptions(1, 3), R"(["hello", "hi", "", null])",
+                       R"(["ell", "i", "", null])");
+  this->CheckSubstring(SubstringOptions(-3), R"(["hello", "hi", "", null])",
+                       R"(["llo", "hi", "", null])");
+  this->CheckSubstring(SubstringOptions(-4, 2), R"(["hello", "hi"])", R"(["el", ""])");
+  this->CheckSubstring(SubstringOptions(7), R"(["hello", "hi"])", R"(["", ""])");
+  this->CheckSubstring(SubstringOptions(0, 0), R"(["hello", "hi"])", R"(["", ""])");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Substring(&this->ctx_, ArrayFromJSON(this->type(), "[]"),
+                                   SubstringOptions(0, -1), &out));
+}
+
+TYPED_TEST(TestBinaryLikeKernels, Match) {
+  const std::string values = R"(["foobar", null, "", "barfoo", "fo", "xfoox"])";
+  this->CheckMatch(StartsWith, "foo", values, "[true, null, false, false, false, false]");
+  this->CheckMatch(EndsWith, "foo", values, "[false, null, false, true, false, false]");
+  this->CheckMatch(MatchSubstring, "foo", values,
+                   "[true, null, false, true, false, true]");
+  this->CheckMatch(MatchSubstring, "", values, "[true, null, true, true, true, true]");
+  this->CheckMatch(StartsWith, "", values, "[true, null, true, true, true, true]");
+}
+
+TYPED_TEST(TestBinaryLikeKernels, MatchSubstringAcrossValues) {
+  // Occurrences straddling two values must not match
+  this->CheckMatch(MatchSubstring, "ab", R"(["xa", "bx", "a", "b", "ab"])",
+                   "[false, false, false, false, true]");
+  this->CheckMatch(MatchSubstring, "aab", R"(["a", "aa", "aab", "a", "ab"])",
+                   "[false, false, true, false, false]");
+  // Repeated first bytes
+  this->CheckMatch(MatchSubstring, "aab", R"(["aaaab", "aaaa", "b", "abaab"])",
+                   "[true, false, false, true]");
+}
+
+TYPED_TEST(TestBinaryLikeKernels, Sliced) {
+  auto values = ArrayFromJSON(this->type(), R"(["xx", "abc", null, "defg", "hi"])");
+  auto sliced = values->Slice(1, 3);
+
+  Datum out;
+  ASSERT_OK(AsciiUpper(&this->ctx_, sliced, &out));
+  this->AssertOutput(out, ArrayFromJSON(this->type(), R"(["ABC", null, "DEFG"])"));
+  ASSERT_OK(Substring(&this->ctx_, sliced, SubstringOptions(1, 2), &out));
+  this->AssertOutput(out, ArrayFromJSON(this->type(), R"(["bc", null, "ef"])"));
+  ASSERT_OK(BinaryLength(&this->ctx_, sliced, &out));
+  this->AssertOutput(out, ArrayFromJSON(this->offset_type(), "[3, null, 4]"));
+
+  this->CheckMatch(MatchSubstring, "x", sliced, "[false, null, false]");
+  this->CheckMatch(MatchSubstring, "g", sliced, "[false, null, true]");
+  this->CheckMatch(EndsWith, "c", sliced, "[true, null, false]");
+}
+
+TYPED_TEST(TestBinaryLikeKernels, ChunkedArray) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(this->type(), R"(["ab", null])"),
+                  ArrayFromJSON(this->type(), "[]"),
+                  ArrayFromJSON(this->type(), R"(["cde"])")});
+  Datum out;
+  ASSERT_OK(BinaryLength(&this->ctx_, chunked, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto expected = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(this->offset_type(), "[2, null]"),
+                  ArrayFromJSON(this->offset_type(), "[]"),
+                  ArrayFromJSON(this->offset_type(), "[3]")});
+  AssertChunkedEqual(*expected, *out.chunked_array());
+}
+
+TYPED_TEST(TestUtf8Kernels, Utf8Length) {
+  this->Check(Utf8Length, R"(["abc", null, "", "héllo", "€", "😀!"])",
+              this->offset_type(), "[3, null, 0, 5, 1, 2]");
+}
+
+TYPED_TEST(TestUtf8Kernels, Utf8Case) {
+  this->Check(Utf8Upper, R"(["aBc", null, "", "héllo wörld", "ÿ", "straße"])",
+              this->type(), R"(["ABC", null, "", "HÉLLO WÖRLD", "Ÿ", "STRAßE"])");
+  this->Check(Utf8Lower, R"(["aBc", null, "", "HÉLLO WÖRLD", "Ÿ"])", this->type(),
+              R"(["abc", null, "", "héllo wörld", "ÿ"])");
+  this->Check(Utf8Upper, R"(["ąčę", "αβγ ς", "привет", "ёж", "日本"])", this->type(),
+              R"(["ĄČĘ", "ΑΒΓ Σ", "ПРИВЕТ", "ЁЖ", "日本"])");
+  this->Check(Utf8Lower, R"(["ĄČĘ", "ΑΒΓ Ά", "ПРИВЕТ", "ЁЖ", "日本"])", this->type(),
+              R"(["ąčę", "αβγ ά", "привет", "ёж", "日本"])");
+  // Mappings to shorter encodings
+  this->Check(Utf8Upper, R"(["ıſ", "µ"])", this->type(), R"(["IS", "Μ"])");
+  this->Check(Utf8Lower, R"(["İx"])", this->type(), R"(["ix"])");
+}
+
+TYPED_TEST(TestUtf8Kernels, SubstringCharacters) {
+  this->CheckSubstring(SubstringOptions(1, 3), R"(["héllo", "€uro", null])",
+                       R"(["éll", "uro", null])");
+  this->CheckSubstring(SubstringOptions(-2), R"(["héllo", "😀€", "x"])",
+                       R"(["lo", "😀€", "x"])");
+  this->CheckSubstring(SubstringOptions(-3, 1), R"(["héllo", "😀€"])", R"(["l", ""])");
+  this->CheckSubstring(SubstringOptions(-3, 2), R"(["héllo", "😀€"])", R"(["ll", "😀"])");
+}
+
+TYPED_TEST(TestUtf8Kernels, MatchUtf8) {
+  this->CheckMatch(MatchSubstring, "é", R"(["héllo", "hello", "é"])",
+                   "[true, false, true]");
+  this->CheckMatch(StartsWith, "日", R"(["日本", "本日"])", "[true, false]");
+}
+
+TYPED_TEST(TestUtf8Kernels, LikeLiteral) {
+  const char* values = R"(["foo", null, "foobar", "barfoo", "bar", "", "xfoox"])";
+  this->CheckLike("foo", true, values, "[true, null, false, false, false, false, false]");
+  this->CheckLike("foo%", true, values, "[true, null, true, false, false, false, false]");
+  this->CheckLike("%foo", true, values, "[true, null, false, true, false, false, false]");
+  this->CheckLike("%foo%", true, values, "[true, null, true, true, false, false, true]");
+  this->CheckLike("%%foo%%", true, values,
+                  "[true, null, true, true, false, false, true]");
+  this->CheckLike("%", true, values, "[true, null, true, true, true, true, true]");
+  this->CheckLike("", true, values, "[false, null, false, false, false, true, false]");
+  // Escaped wildcards are literals
+  this->CheckLike("100\\%", true, R"(["100%", "100", "1000"])", "[true, false, false]");
+  this->CheckLike("%\\_%", true, R"(["a_b", "ab"])", "[true, false]");
+  this->CheckPattern(MatchPatternOptions("%!%%", MatchPatternOptions::LIKE, '!'), true,
+                     R"(["50%", "50"])", "[true, false]");
+}
+
+TYPED_TEST(TestUtf8Kernels, RegexLiteral) {
+  const char* values = R"(["foo", null, "foobar", "barfoo", "bar", ""])";
+  this->CheckRegex("foo", true, values, "[true, null, true, true, false, false]");
+  this->CheckRegex("^foo", true, values, "[true, null, true, false, false, false]");
+  this->CheckRegex("foo$", true, values, "[true, null, false, true, false, false]");
+  this->CheckRegex("^foo$", true, values, "[true, null, false, false, false, false]");
+  this->CheckRegex("", true, values, "[true, null, true, true, true, true]");
+  this->CheckRegex("^$", true, values, "[false, null, false, false, false, true]");
+}
+
+#ifdef ARROW_WITH_RE2
+
+TYPED_TEST(TestUtf8Kernels, LikeRegex) {
+  const char* values = R"(["foo", null, "fxo", "fo", "f.o", "foo\nbar", "日本"])";
+  this->CheckLike("f_o", false, values, "[true, null, true, false, true, false, false]");
+  this->CheckLike("f%o", false, values, "[true, null, true, true, true, false, false]");
+  this->CheckLike("f%r", false, values,
+                  "[false, null, false, false, false, true, false]");
+  this->CheckLike("__", false, values, "[false, null, false, true, false, false, true]");
+  // Regex metacharacters in LIKE patterns are literals
+  this->CheckLike("f.%", true, values, "[false, null, false, false, true, false, false]");
+  this->CheckLike("%.o_", false, values,
+                  "[false, null, false, false, false, false, false]");
+  this->CheckLike("%(o|x)%", true, values,
+                  "[false, null, false, false, false, false, false]");
+}
+
+TYPED_TEST(TestUtf8Kernels, Regex) {
+  const char* values = R"(["foo", null, "fxo", "FOO", "abc123", ""])";
+  this->CheckRegex("f.o", false, values, "[true, null, true, false, false, false]");
+  this->CheckRegex("(?i)^foo$", false, values, "[true, null, false, true, false, false]");
+  this->CheckRegex("[0-9]+$", false, values, "[false, null, false, false, true, false]");
+  this->CheckRegex("^(abc|fxo)", false, values,
+                   "[false, null, true, false, true, false]");
+}
+
+TEST(TestStringMatcher, InvalidRegex) {
+  std::unique_ptr<StringMatcher> matcher;
+  ASSERT_RAISES(Invalid, StringMatcher::Make(
+                             MatchPatternOptions("(", MatchPatternOptions::REGEX),
+                             &matcher));
+}
+
+#else
+
+TEST(TestStringMatcher, RegexNotAvailable) {
+  std::unique_ptr<StringMatcher> matcher;
+  ASSERT_RAISES(NotImplemented,
+                StringMatcher::Make(MatchPatternOptions("f_o"), &matcher));
+  MatchPatternOptions regex_options("f.o", MatchPatternOptions::REGEX);
+  ASSERT_RAISES(NotImplemented, StringMatcher::Make(regex_options, &matcher));
+}
+
+#endif
+
+TEST(TestStringMatcher, Errors) {
+  FunctionContext ctx;
+  Datum out;
+  std::unique_ptr<StringMatcher> matcher;
+  ASSERT_RAISES(Invalid, StringMatcher::Make(MatchPatternOptions("foo\\"), &matcher));
+  ASSERT_OK(StringMatcher::Make(MatchPatternOptions("foo%"), &matcher));
+  ASSERT_RAISES(NotImplemented,
+                matcher->Match(&ctx, ArrayFromJSON(binary(), R"(["foo"])"), &out));
+}
+
+TEST(TestStringMatcher, ChunkedArray) {
+  FunctionContext ctx;
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["abc", "xabc"])"),
+                  ArrayFromJSON(utf8(), R"([null, "ab"])")});
+  Datum out;
+  ASSERT_OK(MatchPattern(&ctx, values, MatchPatternOptions("abc%"), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(*out.chunked_array(),
+                     {ArrayFromJSON(boolean(), "[true, false]"),
+                      ArrayFromJSON(boolean(), "[null, false]")});
+}
+
+TEST(TestStringKernelTypes, Errors) {
+  FunctionContext ctx;
+  Datum out;
+  auto binary_values = ArrayFromJSON(binary(), R"(["a"])");
+  ASSERT_RAISES(NotImplemented, Utf8Upper(&ctx, binary_values, &out));
+  ASSERT_RAISES(NotImplemented, Utf8Length(&ctx, binary_values, &out));
+  ASSERT_RAISES(NotImplemented, BinaryLength(&ctx, ArrayFromJSON(int32(), "[1]"), &out));
+  ASSERT_RAISES(Invalid, BinaryLength(&ctx, Datum(), &out));
+}
+
+TEST(TestStringKernelRandom, MatchesPerValue) {
+  FunctionContext ctx;
+  random::RandomArrayGenerator rand(0xdecaf);
+  auto values = std::static_pointer_cast<StringArray>(rand.String(1000, 0, 12, 0.1));
+  for (const std::string& pattern : std::vector<std::string>{"a", "ab", "aA", "zzz"}) {
+    Datum contains, prefix, suffix;
+    MatchSubstringOptions options(pattern);
+    ASSERT_OK(MatchSubstring(&ctx, values, options, &contains));
+    ASSERT_OK(StartsWith(&ctx, values, options, &prefix));
+    ASSERT_OK(EndsWith(&ctx, values, options, &suffix));
+    auto contains_array = std::static_pointer_cast<BooleanArray>(contains.make_array());
+    auto prefix_array = std::static_pointer_cast<BooleanArray>(prefix.make_array());
+    auto suffix_array = std::static_pointer_cast<BooleanArray>(suffix.make_array());
+    for (int64_t i = 0; i < values->length(); ++i) {
+      ASSERT_EQ(values->IsNull(i), contains_array->IsNull(i));
+      if (values->IsNull(i)) continue;
+      const std::string value = values->GetString(i);
+      ASSERT_EQ(value.find(pattern) != std::string::npos, contains_array->Value(i))
+          << value;
+      ASSERT_EQ(value.compare(0, pattern.size(), pattern) == 0, prefix_array->Value(i));
+      ASSERT_EQ(value.size() >= pattern.size() &&
+                    value.compare(value.size() - pattern.size(), pattern.size(),
+                                  pattern) == 0,
+                suffix_array->Value(i));
+    }
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -18,14 +18,25 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/grouper_internal.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 
 namespace arrow {
@@ -182,5 +193,281 @@ FragmentIterator FileSystemSource::GetFragmentsImpl(
   return MakeVectorIterator(std::move(fragments));
 }
 
+Result<std::unique_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  return Status::NotImplemented("Writing files of ", type_name(), " format");
+}
+
+/// \brief Split record batches by partition and append the rows of each
+/// partition to a file of its directory, keeping at most max_open_files files
+/// open.
+class PartitionedFileWriter {
+ public:
+  explicit PartitionedFileWriter(const FileSystemWriteOptions& options)
+      : options_(options), ctx_(options.pool) {}
+
+  Status Init(const std::shared_ptr<Schema>& schema) {
+    if (options_.format == nullptr || options_.filesystem == nullptr) {
+      return Status::Invalid("Writing a dataset requires a format and a filesystem");
+    }
+    if (options_.max_open_files <= 0 || options_.max_rows_per_file <= 0) {
+      return Status::Invalid("max_open_files and max_rows_per_file must be positive");
+    }
+
+    partitioning_ = options_.partitioning;
+    if (partitioning_ == nullptr) {
+      partitioning_ = Partitioning::Default();
+    }
+
+    std::vector<std::shared_ptr<DataType>> key_types;
+    std::vector<bool> is_key(schema->num_fields(), false);
+    for (const auto& field : partitioning_->schema()->fields()) {
+      auto i = schema->GetFieldIndex(field->name());
+      if (i == -1) {
+        return Status::Invalid("Partition field '", field->name(),
+                               "' is not a field of the written schema ",
+                               schema->ToString());
+      }
+      key_indices_.push_back(i);
+      key_types.push_back(schema->field(i)->type());
+      is_key[i] = true;
+    }
+
+    std::vector<std::shared_ptr<Field>> file_fields;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      if (!is_key[i]) {
+        file_fields.push_back(schema->field(i));
+        file_indices_.push_back(i);
+      }
+    }
+    file_schema_ = ::arrow::schema(std::move(file_fields), schema->metadata());
+
+    if (!key_indices_.empty()) {
+      RETURN_NOT_OK(grouper_.Init(key_types, options_.pool));
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (batch.num_rows() == 0) {
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i : file_indices_) {
+      columns.push_back(batch.column(i));
+    }
+    auto file_batch = RecordBatch::Make(file_schema_, batch.num_rows(), columns);
+
+    if (key_indices_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto dir, partitioning_->Format({}));
+      return WriteRows(dir, std::move(file_batch));
+    }
+
+    std::vector<std::shared_ptr<Array>> keys;
+    for (int i : key_indices_) {
+      keys.push_back(batch.column(i));
+    }
+    RETURN_NOT_OK(grouper_.Consume(keys, batch.num_rows(), &group_ids_));
+    RETURN_NOT_OK(UpdateGroupDirs());
+
+    // Counting sort of the rows by group, stable so that rows keep their order
+    // within a partition
+    std::vector<int32_t> offsets(grouper_.num_groups() + 1, 0);
+    for (int32_t group : group_ids_) {
+      ++offsets[group + 1];
+    }
+    for (size_t i = 1; i < offsets.size(); ++i) {
+      offsets[i] += offsets[i - 1];
+    }
+
+    if (offsets[group_ids_[0] + 1] - offsets[group_ids_[0]] == batch.num_rows()) {
+      // All rows are in the same partition
+      return WriteRows(group_dirs_[group_ids_[0]], std::move(file_batch));
+    }
+
+    std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(options_.pool, batch.num_rows() * sizeof(int32_t),
+                                 &indices_buffer));
+    auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+    std::vector<int32_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int32_t row = 0; row < static_cast<int32_t>(group_ids_.size()); ++row) {
+      indices[positions[group_ids_[row]]++] = row;
+    }
+    Int32Array sorted_indices(batch.num_rows(), indices_buffer);
+
+    for (int32_t group = 0; group < grouper_.num_groups(); ++group) {
+      auto length = offsets[group + 1] - offsets[group];
+      if (length == 0) {
+        continue;
+      }
+      std::shared_ptr<RecordBatch> rows;
+      RETURN_NOT_OK(compute::Take(&ctx_, *file_batch,
+                                  *sorted_indices.Slice(offsets[group], length),
+                                  compute::TakeOptions(), &rows));
+      RETURN_NOT_OK(WriteRows(group_dirs_[group], std::move(rows)));
+    }
+    return Status::OK();
+  }
+
+  Status Finish() {
+    while (!lru_.empty()) {
+      RETURN_NOT_OK(FinishFile(lru_.back()));
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct OpenFile {
+    std::unique_ptr<FileWriter> writer;
+    int64_t num_rows;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  // Format the directory of the groups created by the last batch
+  Status UpdateGroupDirs() {
+    auto num_groups = static_cast<size_t>(grouper_.num_groups());
+    if (group_dirs_.size() == num_groups) {
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<Array>> uniques;
+    RETURN_NOT_OK(grouper_.GetUniques(&ctx_, &uniques));
+
+    std::vector<std::shared_ptr<StringArray>> reprs;
+    for (const auto& values : uniques) {
+      std::shared_ptr<Array> repr = values;
+      if (values->type_id() != Type::STRING) {
+        RETURN_NOT_OK(
+            compute::Cast(&ctx_, *values, utf8(), compute::CastOptions(), &repr));
+      }
+      reprs.push_back(internal::checked_pointer_cast<StringArray>(repr));
+    }
+
+    for (auto group = group_dirs_.size(); group < num_groups; ++group) {
+      std::vector<std::string> values;
+      for (size_t k = 0; k < reprs.size(); ++k) {
+        if (reprs[k]->IsNull(group)) {
+          return Status::Invalid("Cannot write a null value of partition field '",
+                                 partitioning_->schema()->field(k)->name(), "'");
+        }
+        values.push_back(reprs[k]->GetString(group));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto dir, partitioning_->Format(values));
+      group_dirs_.push_back(std::move(dir));
+    }
+    return Status::OK();
+  }
+
+  Status WriteRows(const std::string& dir, std::shared_ptr<RecordBatch> rows) {
+    int64_t offset = 0;
+    while (offset < rows->num_rows()) {
+      ARROW_ASSIGN_OR_RAISE(auto file, GetFile(dir));
+      auto length = std::min(rows->num_rows() - offset,
+                             options_.max_rows_per_file - file->num_rows);
+      auto slice = length == rows->num_rows() ? rows : rows->Slice(offset, length);
+      RETURN_NOT_OK(file->writer->Write(slice));
+      file->num_rows += length;
+      offset += length;
+
+      if (file->num_rows == options_.max_rows_per_file) {
+        RETURN_NOT_OK(FinishFile(dir));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Return the open file of a partition, opening one if needed
+  Result<OpenFile*> GetFile(const std::string& dir) {
+    auto it = open_files_.find(dir);
+    if (it != open_files_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+      return &it->second;
+    }
+
+    if (open_files_.size() == static_cast<size_t>(options_.max_open_files)) {
+      RETURN_NOT_OK(FinishFile(lru_.back()));
+    }
+
+    const auto& base_dir = options_.base_dir;
+    auto dir_path =
+        dir.empty() ? base_dir : fs::internal::ConcatAbstractPath(base_dir, dir);
+    if (created_dirs_.insert(dir_path).second && !dir_path.empty()) {
+      RETURN_NOT_OK(options_.filesystem->CreateDir(dir_path));
+    }
+
+    auto basename = options_.basename_prefix + std::to_string(num_files_++) + "." +
+                    options_.format->type_name();
+    auto path = dir_path.empty() ? basename
+                                 : fs::internal::ConcatAbstractPath(dir_path, basename);
+    ARROW_ASSIGN_OR_RAISE(auto destination, options_.filesystem->OpenOutputStream(path));
+    ARROW_ASSIGN_OR_RAISE(
+        auto writer, options_.format->MakeWriter(std::move(destination), file_schema_));
+
+    lru_.push_front(dir);
+    auto& file = open_files_[dir];
+    file.writer = std::move(writer);
+    file.num_rows = 0;
+    file.lru_position = lru_.begin();
+    return &file;
+  }
+
+  Status FinishFile(const std::string& dir) {
+    auto it = open_files_.find(dir);
+    DCHECK(it != open_files_.end());
+    auto writer = std::move(it->second.writer);
+    lru_.erase(it->second.lru_position);
+    open_files_.erase(it);
+    return writer->Finish();
+  }
+
+  const FileSystemWriteOptions& options_;
+  compute::FunctionContext ctx_;
+  std::shared_ptr<Partitioning> partitioning_;
+
+  // Indices of the partition fields and of the written fields in the schema
+  std::vector<int> key_indices_;
+  std::vector<int> file_indices_;
+  std::shared_ptr<Schema> file_schema_;
+
+  compute::Grouper grouper_;
+  std::vector<int32_t> group_ids_;
+  // The directory of each group of grouper_
+  std::vector<std::string> group_dirs_;
+
+  // Open files by directory, most recently written first in lru_
+  std::unordered_map<std::string, OpenFile> open_files_;
+  std::list<std::string> lru_;
+  std::unordered_set<std::string> created_dirs_;
+  int64_t num_files_ = 0;
+};
+
+static Status WriteFileSystemDataset(const FileSystemWriteOptions& options,
+                                     const std::shared_ptr<Schema>& schema,
+                                     RecordBatchIterator batches) {
+  PartitionedFileWriter writer(options);
+  RETURN_NOT_OK(writer.Init(schema));
+  for (auto maybe_batch : batches) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+    RETURN_NOT_OK(writer.Write(*batch));
+  }
+  return writer.Finish();
+}
+
+Status WriteFileSystemDataset(const FileSystemWriteOptions& options, Scanner* scanner) {
+  ARROW_ASSIGN_OR_RAISE(auto batches, scanner->ScanBatches());
+  return WriteFileSystemDataset(options, scanner->schema(), std::move(batches));
+}
+
+Status WriteFileSystemDataset(const FileSystemWriteOptions& options,
+                              RecordBatchReader* reader) {
+  auto batches = MakeFunctionIterator([reader]() -> Result<std::shared_ptr<RecordBatch>> {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    return batch;
+  });
+  return WriteFileSystemDataset(options, reader->schema(), std::move(batches));
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -32,6 +34,8 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/io/file.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/variant.h"
 
@@ -109,6 +113,20 @@ class ARROW_DS_EXPORT FileSource {
   Compression::type compression_;
 };
 
+/// \brief Write record batches of a fixed schema to a file of a FileFormat
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a batch, whose schema must be the schema the writer was
+  /// made with
+  virtual Status Write(const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Write any buffered batches and the file footer, then close the
+  /// destination
+  virtual Status Finish() = 0;
+};
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat {
  public:
@@ -131,6 +149,13 @@ class ARROW_DS_EXPORT FileFormat {
   /// \brief Open a fragment
   virtual Result<std::shared_ptr<Fragment>> MakeFragment(
       const FileSource& location, std::shared_ptr<ScanOptions> options) = 0;
+
+  /// \brief Make a writer of a file of this format, which owns the destination
+  ///
+  /// Formats which cannot be written return NotImplemented.
+  virtual Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const;
 };
 
 /// \brief A Fragment that is stored in a file with a known format
@@ -231,5 +256,52 @@ class ARROW_DS_EXPORT FileSystemSource : public Source {
   ExpressionVector partitions_;
 };
 
+/// \brief Options for writing record batches to the files of a dataset
+struct ARROW_DS_EXPORT FileSystemWriteOptions {
+  /// The format of the written files
+  std::shared_ptr<FileFormat> format;
+
+  /// The filesystem and directory to write the files to
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+
+  /// The partitioning of the rows in directories under base_dir, as formatted
+  /// by Partitioning::Format(). The partition fields are not written to the
+  /// files since they are recovered from the paths when the dataset is read.
+  std::shared_ptr<Partitioning> partitioning = Partitioning::Default();
+
+  /// Files are named basename_prefix, a counter and the format's type_name()
+  /// as extension, e.g. "part-3.parquet"
+  std::string basename_prefix = "part-";
+
+  /// The maximum number of files open at once. When rows of a partition
+  /// without an open file arrive at the limit, the least recently written file
+  /// is finished, and rows of its partition which arrive later go to a new
+  /// file.
+  int32_t max_open_files = 256;
+
+  /// The maximum number of rows of a file, beyond which rows of its partition
+  /// go to a new file
+  int64_t max_rows_per_file = std::numeric_limits<int64_t>::max();
+
+  /// The pool to split batches by partition with
+  MemoryPool* pool = default_memory_pool();
+};
+
+/// \brief Write the record batches of a Scanner to the files of a dataset
+///
+/// The batches are consumed in order with Scanner::ScanBatches(). The rows of
+/// each batch are split by the values of the partition fields, and appended to
+/// a file of their partition's directory.
+ARROW_DS_EXPORT Status WriteFileSystemDataset(const FileSystemWriteOptions& options,
+                                              Scanner* scanner);
+
+/// \brief Write the record batches of a RecordBatchReader to the files of a
+/// dataset
+///
+/// \see WriteFileSystemDataset(const FileSystemWriteOptions&, Scanner*)
+ARROW_DS_EXPORT Status WriteFileSystemDataset(const FileSystemWriteOptions& options,
+                                              RecordBatchReader* reader);
+
 }  // namespace dataset
 }  // namespace arrow
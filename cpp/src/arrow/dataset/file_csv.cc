@@ -0,0 +1,399 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/chunker.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace dataset {
+
+static Compression::type GetCompression(const FileSource& source) {
+  if (source.compression() != Compression::UNCOMPRESSED ||
+      source.type() != FileSource::PATH) {
+    return source.compression();
+  }
+
+  auto extension = fs::internal::GetAbstractPathExtension(source.path());
+  if (extension == "gz") {
+    return Compression::GZIP;
+  }
+  if (extension == "bz2") {
+    return Compression::BZ2;
+  }
+  if (extension == "zst") {
+    return Compression::ZSTD;
+  }
+  return Compression::UNCOMPRESSED;
+}
+
+// The decompressed contents of a file, the codec must outlive the stream
+struct CsvInput {
+  std::unique_ptr<util::Codec> codec;
+  std::shared_ptr<io::InputStream> stream;
+};
+
+static Result<CsvInput> OpenInput(const FileSource& source,
+                                  std::shared_ptr<io::RandomAccessFile> file,
+                                  MemoryPool* pool) {
+  CsvInput input;
+  auto compression = GetCompression(source);
+  if (compression == Compression::UNCOMPRESSED) {
+    input.stream = std::move(file);
+    return std::move(input);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(input.codec, util::Codec::Create(compression));
+  ARROW_ASSIGN_OR_RAISE(input.stream, io::CompressedInputStream::Make(
+                                          input.codec.get(), std::move(file), pool));
+  return std::move(input);
+}
+
+// The column names of a file and the size of its header, made of the skipped
+// rows and of the row of column names
+struct CsvHeader {
+  std::vector<std::string> column_names;
+  int64_t size = 0;
+};
+
+// Read the header from the first block of a file, as csv::TableReader does
+static Result<CsvHeader> ReadHeader(io::InputStream* stream,
+                                    const CsvFileFormat& format) {
+  const auto& read_options = format.read_options;
+  ARROW_ASSIGN_OR_RAISE(auto block, stream->Read(read_options.block_size));
+  bool is_final = block->size() < read_options.block_size;
+
+  const uint8_t* begin = block->data();
+  const uint8_t* end = begin + block->size();
+  ARROW_ASSIGN_OR_RAISE(auto data, util::SkipUTF8BOM(begin, block->size()));
+
+  if (read_options.skip_rows > 0) {
+    auto num_skipped_rows = csv::SkipRows(data, static_cast<uint32_t>(end - data),
+                                          read_options.skip_rows, &data);
+    if (num_skipped_rows < read_options.skip_rows) {
+      return Status::Invalid("Could not skip initial ", read_options.skip_rows,
+                             " rows from CSV file, either file is too short or "
+                             "header is larger than block size");
+    }
+  }
+
+  CsvHeader header;
+  if (!read_options.column_names.empty()) {
+    header.column_names = read_options.column_names;
+  } else {
+    csv::BlockParser parser(format.parse_options, -1, 1);
+    util::string_view view(reinterpret_cast<const char*>(data), end - data);
+    uint32_t parsed_size = 0;
+    if (is_final) {
+      RETURN_NOT_OK(parser.ParseFinal(view, &parsed_size));
+    } else {
+      RETURN_NOT_OK(parser.Parse(view, &parsed_size));
+    }
+    if (parser.num_rows() != 1) {
+      return Status::Invalid(
+          "Could not read first row from CSV file, either file is too short or "
+          "header is larger than block size");
+    }
+
+    if (read_options.autogenerate_column_names) {
+      for (int32_t i = 0; i < parser.num_cols(); ++i) {
+        header.column_names.push_back("f" + std::to_string(i));
+      }
+    } else {
+      auto visit = [&](const uint8_t* value, uint32_t size, bool quoted) {
+        header.column_names.emplace_back(reinterpret_cast<const char*>(value), size);
+        return Status::OK();
+      };
+      RETURN_NOT_OK(parser.VisitLastRow(visit));
+      data += parsed_size;
+    }
+  }
+
+  header.size = data - begin;
+  return header;
+}
+
+// Convert the rows of a stream and yield them as RecordBatches
+static Result<RecordBatchIterator> ReadBatches(std::shared_ptr<io::InputStream> stream,
+                                               const csv::ReadOptions& read_options,
+                                               const csv::ParseOptions& parse_options,
+                                               const csv::ConvertOptions& convert_options,
+                                               MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        csv::TableReader::Make(pool, std::move(stream), read_options,
+                                               parse_options, convert_options));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> table, reader->Read());
+
+  auto batch_reader = std::make_shared<TableBatchReader>(*table);
+  return MakeFunctionIterator(
+      [table, batch_reader]() -> Result<std::shared_ptr<RecordBatch>> {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(batch_reader->ReadNext(&batch));
+        return batch;
+      });
+}
+
+// The offset of the first row starting at or after position. Since values
+// don't contain newlines, rows start after each '\n'.
+static Result<int64_t> NextRowStart(io::RandomAccessFile* file, int64_t position,
+                                    int64_t size) {
+  static constexpr int64_t kSearchSize = 64 << 10;
+
+  // Look for the newline which ends the row preceding position
+  --position;
+  while (position < size) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          file->ReadAt(position, std::min(kSearchSize, size - position)));
+    if (buffer->size() == 0) {
+      break;
+    }
+
+    auto newline = std::memchr(buffer->data(), '\n', buffer->size());
+    if (newline != nullptr) {
+      return position + (static_cast<const uint8_t*>(newline) - buffer->data()) + 1;
+    }
+    position += buffer->size();
+  }
+  return size;
+}
+
+// The options with which the ScanTasks of a file convert its rows
+struct CsvScanOptions {
+  csv::ReadOptions read_options;
+  csv::ParseOptions parse_options;
+  csv::ConvertOptions convert_options;
+};
+
+/// \brief A ScanTask converting all the rows of a CSV file.
+class CsvFileScanTask : public ScanTask {
+ public:
+  CsvFileScanTask(FileSource source, std::shared_ptr<CsvScanOptions> csv_options,
+                  std::shared_ptr<ScanOptions> options,
+                  std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        csv_options_(std::move(csv_options)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    ARROW_ASSIGN_OR_RAISE(auto file, source_.Open());
+    ARROW_ASSIGN_OR_RAISE(auto input,
+                          OpenInput(source_, std::move(file), context_->pool));
+    return ReadBatches(input.stream, csv_options_->read_options,
+                       csv_options_->parse_options, csv_options_->convert_options,
+                       context_->pool);
+  }
+
+ private:
+  FileSource source_;
+  std::shared_ptr<CsvScanOptions> csv_options_;
+};
+
+/// \brief A ScanTask converting the rows of an uncompressed CSV file which
+/// start within a byte range.
+///
+/// The range is extended to the end of its last row, and its first row is
+/// skipped unless it starts at the beginning of the range. The ScanTasks of
+/// contiguous ranges thus convert each row exactly once.
+class CsvRangeScanTask : public ScanTask {
+ public:
+  CsvRangeScanTask(std::shared_ptr<io::RandomAccessFile> file, int64_t data_begin,
+                   int64_t file_size, int64_t range_begin, int64_t range_end,
+                   std::shared_ptr<CsvScanOptions> csv_options,
+                   std::shared_ptr<ScanOptions> options,
+                   std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        file_(std::move(file)),
+        data_begin_(data_begin),
+        file_size_(file_size),
+        range_begin_(range_begin),
+        range_end_(range_end),
+        csv_options_(std::move(csv_options)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    int64_t begin = range_begin_, end = range_end_;
+    if (begin != data_begin_) {
+      ARROW_ASSIGN_OR_RAISE(begin, NextRowStart(file_.get(), begin, file_size_));
+    }
+    if (end != file_size_) {
+      ARROW_ASSIGN_OR_RAISE(end, NextRowStart(file_.get(), end, file_size_));
+    }
+    if (begin >= end) {
+      // No row starts within the range
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto data, file_->ReadAt(begin, end - begin));
+    return ReadBatches(std::make_shared<io::BufferReader>(std::move(data)),
+                       csv_options_->read_options, csv_options_->parse_options,
+                       csv_options_->convert_options, context_->pool);
+  }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> file_;
+  int64_t data_begin_, file_size_;
+  int64_t range_begin_, range_end_;
+  std::shared_ptr<CsvScanOptions> csv_options_;
+};
+
+static Result<std::shared_ptr<Schema>> InspectFile(
+    const FileSource& source, std::shared_ptr<io::RandomAccessFile> file,
+    const CsvFileFormat& format) {
+  ARROW_ASSIGN_OR_RAISE(auto input,
+                        OpenInput(source, std::move(file), default_memory_pool()));
+
+  const auto& read_options = format.read_options;
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> block,
+                        input.stream->Read(read_options.block_size));
+  if (block->size() == read_options.block_size) {
+    // Only infer the types from whole rows
+    std::shared_ptr<Buffer> whole, partial;
+    auto chunker = csv::MakeChunker(format.parse_options);
+    RETURN_NOT_OK(chunker->Process(block, &whole, &partial));
+    block = std::move(whole);
+  }
+
+  auto inspect_read_options = read_options;
+  inspect_read_options.use_threads = false;
+  auto inspect_convert_options = format.convert_options;
+  inspect_convert_options.include_columns.clear();
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto reader,
+      csv::TableReader::Make(default_memory_pool(),
+                             std::make_shared<io::BufferReader>(std::move(block)),
+                             inspect_read_options, format.parse_options,
+                             inspect_convert_options));
+  ARROW_ASSIGN_OR_RAISE(auto table, reader->Read());
+  return table->schema();
+}
+
+Result<bool> CsvFileFormat::IsSupported(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto file, source.Open());
+  return InspectFile(source, std::move(file), *this).ok();
+}
+
+Result<std::shared_ptr<Schema>> CsvFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto file, source.Open());
+  auto maybe_schema = InspectFile(source, std::move(file), *this);
+  if (!maybe_schema.ok()) {
+    const auto& status = maybe_schema.status();
+    return status.WithMessage("Could not open CSV input source '", source.path(),
+                              "': ", status.message());
+  }
+  return maybe_schema;
+}
+
+Result<ScanTaskIterator> CsvFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  ARROW_ASSIGN_OR_RAISE(auto file, source.Open());
+
+  CsvHeader header;
+  {
+    ARROW_ASSIGN_OR_RAISE(auto input, OpenInput(source, file, context->pool));
+    auto maybe_header = ReadHeader(input.stream.get(), *this);
+    if (!maybe_header.ok()) {
+      const auto& status = maybe_header.status();
+      return status.WithMessage("Could not open CSV input source '", source.path(),
+                                "': ", status.message());
+    }
+    header = maybe_header.MoveValueUnsafe();
+  }
+
+  auto csv_options = std::make_shared<CsvScanOptions>();
+  csv_options->read_options = read_options;
+  csv_options->read_options.use_threads = false;
+  csv_options->parse_options = parse_options;
+
+  // Only convert the materialized columns, to the types of the scanned schema
+  auto& scan_convert_options = csv_options->convert_options;
+  scan_convert_options = convert_options;
+  scan_convert_options.include_columns.clear();
+
+  auto fields = options->MaterializedFields();
+  std::unordered_set<std::string> materialized(fields.begin(), fields.end());
+  for (const auto& name : header.column_names) {
+    if (materialized.erase(name) == 0) {
+      continue;
+    }
+
+    // Pin the type of every converted column, null included, so that every
+    // range yields the same types instead of inferring them from its own rows
+    scan_convert_options.include_columns.push_back(name);
+    auto field = options->schema()->GetFieldByName(name);
+    if (field != nullptr) {
+      scan_convert_options.column_types[name] = field->type();
+    }
+  }
+  if (scan_convert_options.include_columns.empty()) {
+    // Convert a column regardless, for the RecordBatches to have rows
+    scan_convert_options.include_columns.push_back(header.column_names[0]);
+  }
+
+  std::vector<std::shared_ptr<ScanTask>> scan_tasks;
+  if (GetCompression(source) != Compression::UNCOMPRESSED ||
+      parse_options.newlines_in_values) {
+    // Rows can't be found from an arbitrary offset
+    scan_tasks.push_back(std::make_shared<CsvFileScanTask>(source, std::move(csv_options),
+                                                           options, context));
+    return MakeVectorIterator(std::move(scan_tasks));
+  }
+
+  // The header was read, the ranges only hold rows
+  csv_options->read_options.skip_rows = 0;
+  csv_options->read_options.column_names = header.column_names;
+  csv_options->read_options.autogenerate_column_names = false;
+
+  ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+  auto range_size = std::max<int64_t>(scan_range_size, 1);
+  for (int64_t begin = header.size; begin < size; begin += range_size) {
+    auto end = std::min(begin + range_size, size);
+    scan_tasks.push_back(std::make_shared<CsvRangeScanTask>(
+        file, header.size, size, begin, end, csv_options, options, context));
+  }
+  return MakeVectorIterator(std::move(scan_tasks));
+}
+
+Result<std::shared_ptr<Fragment>> CsvFileFormat::MakeFragment(
+    const FileSource& source, std::shared_ptr<ScanOptions> options) {
+  return std::make_shared<CsvFragment>(source, std::make_shared<CsvFileFormat>(*this),
+                                       std::move(options));
+}
+
+}  // namespace dataset
+}  // namespace arrow
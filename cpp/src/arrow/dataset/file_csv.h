@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/csv/options.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A FileFormat implementation that reads from CSV files
+///
+/// Files are decompressed according to FileSource::compression() or, if
+/// uncompressed, to their extension (".gz", ".bz2" or ".zst").
+///
+/// The types of the columns of a file are inferred from its first
+/// read_options.block_size bytes, unless given in convert_options.column_types.
+/// When scanning, the columns are converted to the types of the scanned schema
+/// and only the materialized columns are converted.
+class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return "csv"; }
+
+  /// Options affecting how rows are delimited and values are parsed
+  csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+  /// Options affecting how values are converted. include_columns is ignored,
+  /// the columns to convert are selected from the ScanOptions.
+  csv::ConvertOptions convert_options = csv::ConvertOptions::Defaults();
+  /// Options affecting how the header is read. use_threads is ignored, the
+  /// ScanTasks of a file are executed concurrently by the Scanner instead.
+  csv::ReadOptions read_options = csv::ReadOptions::Defaults();
+
+  /// The rows of an uncompressed file are split into ScanTasks of about this
+  /// many bytes, which are scanned independently. Compressed files, and files
+  /// whose values may contain newlines, are scanned as a single ScanTask.
+  int64_t scan_range_size = 32 << 20;
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file if possible.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const override;
+
+  Result<std::shared_ptr<Fragment>> MakeFragment(
+      const FileSource& source, std::shared_ptr<ScanOptions> options) override;
+};
+
+class ARROW_DS_EXPORT CsvFragment : public FileFragment {
+ public:
+  CsvFragment(const FileSource& source, std::shared_ptr<CsvFileFormat> format,
+              std::shared_ptr<ScanOptions> options)
+      : FileFragment(source, std::move(format), options) {}
+
+  bool splittable() const override { return true; }
+};
+
+}  // namespace dataset
+}  // namespace arrow
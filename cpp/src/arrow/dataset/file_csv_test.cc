@@ -0,0 +1,326 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+class TestCsvFileFormat : public ::testing::Test {
+ public:
+  // A CSV file of `num_rows` rows: i is the row number and s its string
+  static std::string MakeCsv(int num_rows) {
+    std::string csv = "i,s\n";
+    for (int i = 0; i < num_rows; ++i) {
+      csv += std::to_string(i) + ",x" + std::to_string(i) + "\n";
+    }
+    return csv;
+  }
+
+  static FileSource GetFileSource(std::string csv) {
+    return FileSource(Buffer::FromString(std::move(csv)));
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> Scan(const FileSource& source,
+                                                 int* num_scan_tasks = nullptr) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    EXPECT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    int count = 0;
+    for (auto maybe_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      EXPECT_OK_AND_ASSIGN(auto batch_it, task->Execute());
+      for (auto maybe_batch : batch_it) {
+        EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        batches.push_back(std::move(batch));
+      }
+      ++count;
+    }
+    if (num_scan_tasks != nullptr) {
+      *num_scan_tasks = count;
+    }
+    return batches;
+  }
+
+  // Check that the column "i" of the batches holds 0, 1, ... num_rows - 1
+  static void AssertRowNumbers(const std::vector<std::shared_ptr<RecordBatch>>& batches,
+                               int64_t num_rows) {
+    int64_t expected = 0;
+    for (const auto& batch : batches) {
+      auto column = batch->GetColumnByName("i");
+      ASSERT_NE(column, nullptr);
+      ASSERT_EQ(column->type_id(), Type::INT64);
+      const auto& values = checked_cast<const Int64Array&>(*column);
+      for (int64_t i = 0; i < values.length(); ++i) {
+        ASSERT_EQ(values.Value(i), expected++);
+      }
+    }
+    ASSERT_EQ(expected, num_rows);
+  }
+
+ protected:
+  std::shared_ptr<CsvFileFormat> format_ = std::make_shared<CsvFileFormat>();
+  std::shared_ptr<ScanOptions> opts_ =
+      ScanOptions::Make(schema({field("i", int64()), field("s", utf8())}));
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestCsvFileFormat, Inspect) {
+  auto source = GetFileSource("f64,str,i64\n1.5,foo,1\n,bar,2\n");
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, *schema({field("f64", float64()), field("str", utf8()),
+                                      field("i64", int64())}));
+}
+
+TEST_F(TestCsvFileFormat, IsSupported) {
+  bool supported = false;
+
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(GetFileSource("")));
+  ASSERT_FALSE(supported);
+
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(GetFileSource(MakeCsv(3))));
+  ASSERT_TRUE(supported);
+}
+
+TEST_F(TestCsvFileFormat, ScanRanges) {
+  auto source = GetFileSource(MakeCsv(1000));
+
+  // A single ScanTask by default
+  int num_scan_tasks = 0;
+  auto batches = Scan(source, &num_scan_tasks);
+  ASSERT_EQ(num_scan_tasks, 1);
+  AssertRowNumbers(batches, 1000);
+
+  // Ranges are smaller than some rows and don't align with rows, each row is
+  // converted once
+  for (int64_t scan_range_size : {1, 5, 37, 1000}) {
+    format_->scan_range_size = scan_range_size;
+    batches = Scan(source, &num_scan_tasks);
+    ASSERT_GT(num_scan_tasks, 1);
+    AssertRowNumbers(batches, 1000);
+  }
+}
+
+TEST_F(TestCsvFileFormat, ScanRangesSkippedRows) {
+  format_->read_options.skip_rows = 2;
+  format_->scan_range_size = 16;
+
+  auto source = GetFileSource("\xef\xbb\xbfskipped\nskipped,too\n" + MakeCsv(100));
+  AssertRowNumbers(Scan(source), 100);
+}
+
+TEST_F(TestCsvFileFormat, ScanNewlinesInValues) {
+  format_->parse_options.newlines_in_values = true;
+  format_->scan_range_size = 4;
+
+  int num_scan_tasks = 0;
+  auto batches = Scan(GetFileSource("i,s\n0,\"a\nb\"\n1,c\n"), &num_scan_tasks);
+  ASSERT_EQ(num_scan_tasks, 1);
+  AssertRowNumbers(batches, 2);
+}
+
+#ifdef ARROW_WITH_ZLIB
+TEST_F(TestCsvFileFormat, ScanCompressed) {
+  auto csv = MakeCsv(1000);
+  ASSERT_OK_AND_ASSIGN(auto codec, util::Codec::Create(Compression::GZIP));
+  const auto input = reinterpret_cast<const uint8_t*>(csv.data());
+  const auto input_len = static_cast<int64_t>(csv.size());
+  std::string compressed(codec->MaxCompressedLen(input_len, input), '\0');
+  ASSERT_OK_AND_ASSIGN(
+      auto compressed_len,
+      codec->Compress(input_len, input, static_cast<int64_t>(compressed.size()),
+                      reinterpret_cast<uint8_t*>(&compressed[0])));
+  compressed.resize(compressed_len);
+
+  // Compressed files are converted by a single ScanTask, whatever the range
+  // size
+  format_->scan_range_size = 37;
+  int num_scan_tasks = 0;
+  auto batches = Scan(FileSource(std::make_shared<Buffer>(compressed), Compression::GZIP),
+                      &num_scan_tasks);
+  ASSERT_EQ(num_scan_tasks, 1);
+  AssertRowNumbers(batches, 1000);
+
+  // The compression of a file is found from its extension
+  fs::internal::MockFileSystem fs(fs::kNoTime);
+  ASSERT_OK(fs.CreateFile("data.csv.gz", compressed));
+  FileSource source("data.csv.gz", &fs);
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(source));
+  AssertSchemaEqual(*actual, *schema({field("i", int64()), field("s", utf8())}));
+  batches = Scan(source, &num_scan_tasks);
+  ASSERT_EQ(num_scan_tasks, 1);
+  AssertRowNumbers(batches, 1000);
+}
+#endif
+
+TEST_F(TestCsvFileFormat, ScanProjected) {
+  format_->scan_range_size = 100;
+  auto source = GetFileSource(MakeCsv(100));
+
+  // Only the projected columns are converted, to the type of the scanned schema
+  opts_ = ScanOptions::Make(schema({field("s", utf8()), field("i", int32())}));
+  int64_t num_rows = 0;
+  for (const auto& batch : Scan(source)) {
+    AssertSchemaEqual(*batch->schema(),
+                      *schema({field("i", int32()), field("s", utf8())}));
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 100);
+
+  opts_ = ScanOptions::Make(schema({field("s", utf8())}));
+  num_rows = 0;
+  for (const auto& batch : Scan(source)) {
+    AssertSchemaEqual(*batch->schema(), *schema({field("s", utf8())}));
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 100);
+
+  // The fields referenced by the filter are converted too
+  opts_->filter = ("i"_ > int64_t(50)).Copy();
+  AssertRowNumbers(Scan(source), 100);
+
+  // No column of the file is projected, a column is converted regardless to
+  // yield the rows
+  opts_ = ScanOptions::Make(schema({field("part", int32())}));
+  AssertRowNumbers(Scan(source), 100);
+}
+
+TEST_F(TestCsvFileFormat, ScanRangesPinnedTypes) {
+  // The column "s" is empty in the first rows only
+  std::string csv = "i,s\n";
+  for (int i = 0; i < 100; ++i) {
+    csv += std::to_string(i) + (i < 50 ? "," : ",x") + "\n";
+  }
+  auto source = GetFileSource(csv);
+  format_->read_options.block_size = 64;
+  format_->scan_range_size = 64;
+
+  ASSERT_OK_AND_ASSIGN(auto inspected, format_->Inspect(source));
+  AssertSchemaEqual(*inspected, *schema({field("i", int64()), field("s", null())}));
+
+  // The ranges holding values of "s" fail to convert them to null, rather
+  // than yielding another type than the first ranges
+  opts_ = ScanOptions::Make(inspected);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t num_null_rows = 0;
+  Status status;
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    auto maybe_batch_it = task->Execute();
+    if (!maybe_batch_it.ok()) {
+      status = maybe_batch_it.status();
+      continue;
+    }
+    for (auto maybe_batch : maybe_batch_it.ValueOrDie()) {
+      if (!maybe_batch.ok()) {
+        status = maybe_batch.status();
+        break;
+      }
+      auto batch = maybe_batch.ValueOrDie();
+      ASSERT_EQ(batch->GetColumnByName("s")->type_id(), Type::NA);
+      num_null_rows += batch->num_rows();
+    }
+  }
+  ASSERT_RAISES(Invalid, status);
+  ASSERT_GT(num_null_rows, 0);
+  ASSERT_LE(num_null_rows, 50);
+
+  // Once the type of "s" is known, every range yields strings
+  opts_ = ScanOptions::Make(schema({field("i", int64()), field("s", utf8())}));
+  auto batches = Scan(source);
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->GetColumnByName("s")->type_id(), Type::STRING);
+  }
+  AssertRowNumbers(batches, 100);
+}
+
+TEST_F(TestCsvFileFormat, ScanError) {
+  format_->scan_range_size = 8;
+  auto source = GetFileSource("i,s\n0,a\n1,b\n2,c,d\n3,d\n");
+
+  EXPECT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source, opts_));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+
+  Status status;
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    auto maybe_batches = task->Execute();
+    if (!maybe_batches.ok()) {
+      status = maybe_batches.status();
+    }
+  }
+  ASSERT_RAISES(Invalid, status);
+
+  ASSERT_RAISES(Invalid, format_->ScanFile(GetFileSource(""), opts_, ctx_));
+}
+
+TEST_F(TestCsvFileFormat, Dataset) {
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(fs->CreateFile("csv/1.csv", MakeCsv(300)));
+
+  // The columns of the second file are inferred as null, in another order
+  std::string csv = "s,i\n";
+  for (int i = 300; i < 500; ++i) {
+    csv += ",\n";
+  }
+  ASSERT_OK(fs->CreateFile("csv/2.csv", csv));
+
+  fs::FileSelector selector;
+  selector.base_dir = "csv";
+  format_->scan_range_size = 256;
+  ASSERT_OK_AND_ASSIGN(auto factory, FileSystemSourceFactory::Make(fs, selector, format_,
+                                                                   {}));
+  ASSERT_OK_AND_ASSIGN(auto dataset_schema, factory->Inspect());
+  AssertSchemaEqual(*dataset_schema, *schema({field("i", int64()), field("s", utf8())}));
+
+  ASSERT_OK_AND_ASSIGN(auto source, factory->Finish(dataset_schema));
+  ASSERT_OK_AND_ASSIGN(auto dataset, Dataset::Make({source}, dataset_schema));
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK(builder->UseThreads(true));
+  ASSERT_OK(builder->Project({"i"}));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+
+  ASSERT_EQ(table->num_columns(), 1);
+  ASSERT_EQ(table->num_rows(), 500);
+  ASSERT_EQ(table->column(0)->null_count(), 200);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -26,6 +26,7 @@
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
@@ -113,6 +114,35 @@ class IpcScanTaskIterator {
   FileSource source_;
 };
 
+/// \brief A FileWriter of an IPC file
+class IpcFileWriter : public FileWriter {
+ public:
+  static Result<std::unique_ptr<FileWriter>> Make(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) {
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          ipc::RecordBatchFileWriter::Open(destination.get(), schema));
+    return std::unique_ptr<FileWriter>(
+        new IpcFileWriter(std::move(destination), std::move(writer)));
+  }
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    return writer_->WriteRecordBatch(*batch);
+  }
+
+  Status Finish() override {
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  IpcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<ipc::RecordBatchWriter> writer)
+      : destination_(std::move(destination)), writer_(std::move(writer)) {}
+
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   return OpenReader(source, input).ok();
@@ -134,5 +164,10 @@ Result<std::shared_ptr<Fragment>> IpcFileFormat::MakeFragment(
   return std::make_shared<IpcFragment>(source, options);
 }
 
+Result<std::unique_ptr<FileWriter>> IpcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  return IpcFileWriter::Make(std::move(destination), std::move(schema));
+}
+
 }  // namespace dataset
 }  // namespace arrow
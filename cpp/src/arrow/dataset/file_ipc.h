@@ -27,7 +27,7 @@
 namespace arrow {
 namespace dataset {
 
-/// \brief A FileFormat implementation that reads from Ipc files
+/// \brief A FileFormat implementation that reads from and writes to Ipc files
 class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
  public:
   std::string type_name() const override { return "ipc"; }
@@ -44,6 +44,11 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
 
   Result<std::shared_ptr<Fragment>> MakeFragment(
       const FileSource& source, std::shared_ptr<ScanOptions> options) override;
+
+  /// \brief Make a writer of an Ipc file, each batch written as a record batch
+  Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
 };
 
 class ARROW_DS_EXPORT IpcFragment : public FileFragment {
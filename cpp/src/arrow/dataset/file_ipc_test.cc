@@ -18,13 +18,18 @@
 #include "arrow/dataset/file_ipc.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/discovery.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
@@ -183,5 +188,175 @@ TEST_F(TestIpcFileFormat, IsSupported) {
   EXPECT_EQ(supported, true);
 }
 
+class TestIpcFileSystemWrite : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+
+    options_.format = std::make_shared<IpcFileFormat>();
+    options_.filesystem = fs_;
+    options_.base_dir = "dataset";
+    options_.partitioning = std::make_shared<HivePartitioning>(
+        schema({field("year", int32()), field("country", utf8())}));
+  }
+
+  // Write two batches whose rows are not grouped by partition
+  void Write() {
+    auto make_batch = [&](const std::string& years, const std::string& countries,
+                          const std::string& values) {
+      auto year = ArrayFromJSON(int32(), years);
+      return RecordBatch::Make(schema_, year->length(),
+                               {year, ArrayFromJSON(utf8(), countries),
+                                ArrayFromJSON(float64(), values)});
+    };
+    std::vector<std::shared_ptr<RecordBatch>> batches{
+        make_batch("[2019, 2020, 2019, 2020]", R"(["US", "FR", "FR", "US"])",
+                   "[1, 2, 3, 4]"),
+        make_batch("[2020, 2019]", R"(["US", "US"])", "[5, 6]")};
+
+    size_t i = 0;
+    auto reader = MakeGeneratedRecordBatch(
+        schema_, [&](std::shared_ptr<RecordBatch>* out) {
+          *out = i < batches.size() ? batches[i++] : nullptr;
+          return Status::OK();
+        });
+    ASSERT_OK(WriteFileSystemDataset(options_, reader.get()));
+  }
+
+  // Assert the values of the written file, which only has the "value" field
+  void AssertFile(const std::string& path, const std::string& expected_values) {
+    ASSERT_OK_AND_ASSIGN(auto input, fs_->OpenInputFile("dataset/" + path));
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    ASSERT_OK(ipc::RecordBatchFileReader::Open(input, &reader));
+    AssertSchemaEqual(*reader->schema(), *schema({field("value", float64())}));
+
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(reader->ReadRecordBatch(i, &batch));
+      batches.push_back(batch);
+    }
+    std::shared_ptr<Table> table;
+    ASSERT_OK(Table::FromRecordBatches(reader->schema(), batches, &table));
+    ASSERT_OK(table->CombineChunks(default_memory_pool(), &table));
+    AssertArraysEqual(*ArrayFromJSON(float64(), expected_values),
+                      *table->column(0)->chunk(0));
+  }
+
+  std::unique_ptr<RecordBatchReader> MakeEmptyReader() {
+    return MakeGeneratedRecordBatch(schema_, [](std::shared_ptr<RecordBatch>* out) {
+      *out = nullptr;
+      return Status::OK();
+    });
+  }
+
+  void AssertNumFiles(size_t expected) {
+    fs::FileSelector selector;
+    selector.base_dir = "dataset";
+    selector.recursive = true;
+    ASSERT_OK_AND_ASSIGN(auto stats, fs_->GetTargetStats(selector));
+    size_t num_files = 0;
+    for (const auto& stat : stats) {
+      num_files += stat.IsFile();
+    }
+    ASSERT_EQ(num_files, expected);
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ = schema(
+      {field("year", int32()), field("country", utf8()), field("value", float64())});
+  std::shared_ptr<fs::FileSystem> fs_;
+  FileSystemWriteOptions options_;
+};
+
+TEST_F(TestIpcFileSystemWrite, Partitioned) {
+  Write();
+
+  // Files are numbered in the order their partition is first seen
+  AssertNumFiles(4);
+  AssertFile("year=2019/country=US/part-0.ipc", "[1, 6]");
+  AssertFile("year=2020/country=FR/part-1.ipc", "[2]");
+  AssertFile("year=2019/country=FR/part-2.ipc", "[3]");
+  AssertFile("year=2020/country=US/part-3.ipc", "[4, 5]");
+
+  // The partition fields are recovered when reading the dataset back
+  fs::FileSelector selector;
+  selector.base_dir = "dataset";
+  selector.recursive = true;
+  FileSystemFactoryOptions factory_options;
+  factory_options.partitioning = options_.partitioning;
+  ASSERT_OK_AND_ASSIGN(auto factory,
+                       FileSystemSourceFactory::Make(fs_, selector, options_.format,
+                                                     factory_options));
+  ASSERT_OK_AND_ASSIGN(auto source, factory->Finish(schema_));
+  ASSERT_OK_AND_ASSIGN(auto dataset, Dataset::Make({source}, schema_));
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK(builder->Filter("country"_ == "US"));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+
+  auto expected = Table::Make(
+      schema_, {ArrayFromJSON(int32(), "[2019, 2019, 2020, 2020]"),
+                ArrayFromJSON(utf8(), R"(["US", "US", "US", "US"])"),
+                ArrayFromJSON(float64(), "[1, 6, 4, 5]")});
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestIpcFileSystemWrite, MaxOpenFiles) {
+  options_.max_open_files = 2;
+  Write();
+
+  // Opening the files of 2019/FR and 2020/US finished those of 2019/US and
+  // 2020/FR, 2019/US is written to a new file when it is seen again
+  AssertNumFiles(5);
+  AssertFile("year=2019/country=US/part-0.ipc", "[1]");
+  AssertFile("year=2019/country=US/part-4.ipc", "[6]");
+  AssertFile("year=2020/country=FR/part-1.ipc", "[2]");
+  AssertFile("year=2019/country=FR/part-2.ipc", "[3]");
+  AssertFile("year=2020/country=US/part-3.ipc", "[4, 5]");
+}
+
+TEST_F(TestIpcFileSystemWrite, MaxRowsPerFile) {
+  options_.max_rows_per_file = 1;
+  Write();
+
+  AssertNumFiles(6);
+  AssertFile("year=2020/country=US/part-3.ipc", "[4]");
+  AssertFile("year=2019/country=US/part-4.ipc", "[6]");
+  AssertFile("year=2020/country=US/part-5.ipc", "[5]");
+}
+
+TEST_F(TestIpcFileSystemWrite, Unpartitioned) {
+  options_.partitioning = Partitioning::Default();
+  options_.max_rows_per_file = 4;
+  Write();
+
+  AssertNumFiles(2);
+  ASSERT_OK_AND_ASSIGN(auto stats, fs_->GetTargetStats("dataset/part-1.ipc"));
+  ASSERT_TRUE(stats.IsFile());
+}
+
+TEST_F(TestIpcFileSystemWrite, NullPartitioning) {
+  // Same as the default partitioning
+  options_.partitioning = nullptr;
+  Write();
+
+  AssertNumFiles(1);
+  ASSERT_OK_AND_ASSIGN(auto input, fs_->OpenInputFile("dataset/part-0.ipc"));
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  ASSERT_OK(ipc::RecordBatchFileReader::Open(input, &reader));
+  AssertSchemaEqual(*reader->schema(), *schema_);
+}
+
+TEST_F(TestIpcFileSystemWrite, Errors) {
+  options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({field("month", int32())}));
+  ASSERT_RAISES(Invalid, WriteFileSystemDataset(options_, MakeEmptyReader().get()));
+
+  options_.partitioning = Partitioning::Default();
+  options_.max_open_files = 0;
+  ASSERT_RAISES(Invalid, WriteFileSystemDataset(options_, MakeEmptyReader().get()));
+}
+
 }  // namespace dataset
 }  // namespace arrow
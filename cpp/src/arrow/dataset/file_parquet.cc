@@ -17,40 +17,80 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
+#include "parquet/properties.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
 using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+template <typename M>
+static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
+  SchemaManifest manifest;
+  RETURN_NOT_OK(SchemaManifest::Make(
+      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
+  return manifest;
+}
+
+// Failure to extract/parse statistics is ignored by returning the `true`
+// scalar: an optimization must not break the computation.
+static std::shared_ptr<Expression> StatisticsAsExpression(
+    const Field& field, const parquet::Statistics& statistics) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values() == statistics.null_count()) {
+    return equal(field_expr, scalar(MakeNullScalar(field.type())));
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
+    return scalar(true);
+  }
+
+  return and_(greater_equal(field_expr, scalar(min)),
+              less_equal(field_expr, scalar(max)));
+}
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
-                  std::shared_ptr<ScanOptions> options,
+                  bool use_page_index, std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        use_page_index_(use_page_index) {}
 
   Result<RecordBatchIterator> Execute() override {
     // The construction of parquet's RecordBatchReader is deferred here to
@@ -59,6 +99,14 @@ class ParquetScanTask : public ScanTask {
     //
     // Thus the memory incurred by the RecordBatchReader is allocated when
     // Scan is called.
+    if (use_page_index_ && !column_projection_.empty()) {
+      try {
+        SelectPages();
+      } catch (const ::parquet::ParquetException& e) {
+        return Status::IOError("Could not read parquet page index: ", e.what());
+      }
+    }
+
     std::unique_ptr<RecordBatchReader> record_batch_reader;
     RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
                                                 &record_batch_reader));
@@ -68,23 +116,203 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // Only read the pages which may contain rows satisfying the filter, by
+  // checking the filter against the ColumnIndex of the filtered columns.
+  void SelectPages() {
+    parquet::ParquetFileReader* parquet_reader = reader_->parquet_reader();
+    auto metadata = parquet_reader->metadata();
+    auto maybe_manifest = GetSchemaManifest(*metadata);
+    if (!maybe_manifest.ok()) {
+      return;
+    }
+    auto filter_fields = FieldsInExpression(*options_->filter);
+    std::unordered_set<std::string> filtered_fields(filter_fields.begin(),
+                                                    filter_fields.end());
+
+    auto row_group = parquet_reader->RowGroup(row_group_);
+    const int64_t num_rows = row_group->metadata()->num_rows();
+    parquet::RowRanges rows{{0, num_rows}};
+    for (const auto& schema_field : maybe_manifest.ValueOrDie().schema_fields) {
+      if (!schema_field.is_leaf() ||
+          filtered_fields.count(schema_field.field->name()) == 0) {
+        continue;
+      }
+      const int column = schema_field.column_index;
+      auto column_index = row_group->GetColumnIndex(column);
+      auto offset_index = row_group->GetOffsetIndex(column);
+      if (column_index == nullptr || offset_index == nullptr) {
+        continue;
+      }
+      const auto& pages = offset_index->page_locations();
+      std::vector<bool> selected_pages(pages.size(), true);
+      for (size_t i = 0; i < pages.size(); ++i) {
+        const int64_t page_rows =
+            (i + 1 < pages.size() ? pages[i + 1].first_row_index : num_rows) -
+            pages[i].first_row_index;
+        const bool null_page = column_index->null_pages()[i];
+        const int64_t null_count =
+            null_page ? page_rows
+                      : (column_index->has_null_counts() ? column_index->null_counts()[i]
+                                                         : 0);
+        auto statistics = parquet::Statistics::Make(
+            metadata->schema()->Column(column), column_index->encoded_min_values()[i],
+            column_index->encoded_max_values()[i], page_rows - null_count, null_count,
+            /*distinct_count=*/0, /*has_min_max=*/!null_page);
+        auto expr = options_->filter->Assume(
+            StatisticsAsExpression(*schema_field.field, *statistics));
+        selected_pages[i] = !(expr->IsNull() || expr->Equals(false));
+      }
+      rows = parquet::IntersectRowRanges(
+          rows, parquet::PageRowRanges(*offset_index, selected_pages, num_rows));
+    }
+    parquet_reader->SelectRows(row_group_, rows, column_projection_);
+  }
+
   int row_group_;
   std::vector<int> column_projection_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  bool use_page_index_;
 };
 
-// Skip RowGroups with a filter and metadata
+// Collect the values a field is compared for equality with, in the
+// conjunction of the filter. Return false if no field is constrained this way.
+static bool GetEqualityConstraint(const Expression& filter,
+                                  std::shared_ptr<Array>* values,
+                                  std::string* field_name) {
+  switch (filter.type()) {
+    case ExpressionType::AND: {
+      // Pruning by either side of a conjunction is sound
+      const auto& and_expr = checked_cast<const AndExpression&>(filter);
+      return GetEqualityConstraint(*and_expr.left_operand(), values, field_name) ||
+             GetEqualityConstraint(*and_expr.right_operand(), values, field_name);
+    }
+    case ExpressionType::COMPARISON: {
+      const auto& comparison = checked_cast<const ComparisonExpression&>(filter);
+      if (comparison.op() != compute::CompareOperator::EQUAL) {
+        return false;
+      }
+      const Expression* field = comparison.left_operand().get();
+      const Expression* value = comparison.right_operand().get();
+      if (field->type() != ExpressionType::FIELD) {
+        std::swap(field, value);
+      }
+      if (field->type() != ExpressionType::FIELD ||
+          value->type() != ExpressionType::SCALAR) {
+        return false;
+      }
+      const auto& scalar = *checked_cast<const ScalarExpression&>(*value).value();
+      if (!MakeArrayFromScalar(scalar, 1, values).ok()) {
+        return false;
+      }
+      *field_name = checked_cast<const FieldExpression&>(*field).name();
+      return true;
+    }
+    case ExpressionType::IN: {
+      const auto& in_expr = checked_cast<const InExpression&>(filter);
+      if (in_expr.operand()->type() != ExpressionType::FIELD) {
+        return false;
+      }
+      *field_name = checked_cast<const FieldExpression&>(*in_expr.operand()).name();
+      *values = in_expr.set();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+template <typename ArrayType>
+static int64_t IntegerValue(const Array& values, int64_t i) {
+  return static_cast<int64_t>(checked_cast<const ArrayType&>(values).Value(i));
+}
+
+// Compute the hash of a value as written in the Bloom filter of a column
+// with the given physical type. Return false for unsupported types.
+//
+// Floating point values are not supported: their bit patterns are hashed,
+// so equal values such as -0.0 and 0.0 would have different hashes.
+static bool HashValue(const Array& values, int64_t i, parquet::Type::type physical_type,
+                      const parquet::BloomFilter& bloom_filter, uint64_t* hash) {
+  if (values.IsNull(i)) {
+    return false;
+  }
+  int64_t integer_value;
+  switch (values.type_id()) {
+    case Type::INT8:
+      integer_value = IntegerValue<Int8Array>(values, i);
+      break;
+    case Type::INT16:
+      integer_value = IntegerValue<Int16Array>(values, i);
+      break;
+    case Type::INT32:
+      integer_value = IntegerValue<Int32Array>(values, i);
+      break;
+    case Type::INT64:
+      integer_value = IntegerValue<Int64Array>(values, i);
+      break;
+    case Type::UINT8:
+      integer_value = IntegerValue<UInt8Array>(values, i);
+      break;
+    case Type::UINT16:
+      integer_value = IntegerValue<UInt16Array>(values, i);
+      break;
+    case Type::UINT32:
+      integer_value = IntegerValue<UInt32Array>(values, i);
+      break;
+    case Type::UINT64:
+      integer_value = IntegerValue<UInt64Array>(values, i);
+      break;
+    case Type::DATE32:
+      integer_value = IntegerValue<Date32Array>(values, i);
+      break;
+    case Type::STRING:
+    case Type::BINARY: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) return false;
+      parquet::ByteArray value(checked_cast<const BinaryArray&>(values).GetView(i));
+      *hash = bloom_filter.Hash(&value);
+      return true;
+    }
+    default:
+      return false;
+  }
+  // Integers are written as the (possibly wrapped around) physical integer
+  switch (physical_type) {
+    case parquet::Type::INT32:
+      *hash = bloom_filter.Hash(static_cast<int32_t>(integer_value));
+      return true;
+    case parquet::Type::INT64:
+      *hash = bloom_filter.Hash(integer_value);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Skip RowGroups with a filter and metadata. If a reader is given, Bloom
+// filters of the column chunks are also used to skip RowGroups not
+// containing the values required by an equality or IN predicate. If cached
+// metadata is given, its statistics expressions are used instead of being
+// extracted from the metadata again.
 class RowGroupSkipper {
  public:
   static constexpr int kIterationDone = -1;
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
-                  std::shared_ptr<Expression> filter)
-      : metadata_(std::move(metadata)), filter_(std::move(filter)), row_group_idx_(0) {
+                  std::shared_ptr<Expression> filter,
+                  parquet::ParquetFileReader* reader = NULLPTR,
+                  std::shared_ptr<CachedParquetMetadata> cached = NULLPTR)
+      : metadata_(std::move(metadata)),
+        filter_(std::move(filter)),
+        reader_(reader),
+        cached_(std::move(cached)),
+        row_group_idx_(0) {
     num_row_groups_ = metadata_->num_row_groups();
+    if (reader_ != NULLPTR) {
+      InitBloomFilterPredicate();
+    }
   }
 
   int Next() {
@@ -93,7 +321,7 @@ class RowGroupSkipper {
       const auto row_group = metadata_->RowGroup(row_group_idx);
 
       const auto num_rows = row_group->num_rows();
-      if (CanSkip(*row_group)) {
+      if (CanSkip(row_group_idx, *row_group) || BloomFilterExcludes(row_group_idx)) {
         rows_skipped_ += num_rows;
         continue;
       }
@@ -105,49 +333,118 @@ class RowGroupSkipper {
   }
 
  private:
-  bool CanSkip(const parquet::RowGroupMetaData& metadata) const {
-    auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata);
+  bool CanSkip(int row_group_idx, const parquet::RowGroupMetaData& metadata) const {
+    std::shared_ptr<Expression> stats_expr;
+    if (cached_ != nullptr) {
+      stats_expr = cached_->row_group_statistics[row_group_idx];
+    } else {
+      auto maybe_stats_expr = RowGroupStatisticsAsExpression(metadata);
+      if (maybe_stats_expr.ok()) {
+        stats_expr = maybe_stats_expr.MoveValueUnsafe();
+      }
+    }
     // Errors with statistics are ignored and post-filtering will apply.
-    if (!maybe_stats_expr.ok()) {
+    if (stats_expr == nullptr) {
       return false;
     }
 
-    auto stats_expr = maybe_stats_expr.ValueOrDie();
     auto expr = filter_->Assume(stats_expr);
     return (expr->IsNull() || expr->Equals(false));
   }
 
+  // Find the leaf column the filter requires to be equal to some values
+  void InitBloomFilterPredicate() {
+    std::string field_name;
+    if (!GetEqualityConstraint(*filter_, &bloom_filter_values_, &field_name)) {
+      return;
+    }
+    auto maybe_manifest = GetSchemaManifest(*metadata_);
+    if (!maybe_manifest.ok()) {
+      return;
+    }
+    for (const auto& schema_field : maybe_manifest.ValueOrDie().schema_fields) {
+      if (schema_field.field->name() == field_name && schema_field.is_leaf()) {
+        bloom_filter_column_ = schema_field.column_index;
+      }
+    }
+  }
+
+  bool BloomFilterExcludes(int row_group_idx) const {
+    if (bloom_filter_column_ < 0) {
+      return false;
+    }
+    const auto physical_type =
+        metadata_->schema()->Column(bloom_filter_column_)->physical_type();
+    try {
+      auto bloom_filter =
+          reader_->RowGroup(row_group_idx)->GetColumnBloomFilter(bloom_filter_column_);
+      if (bloom_filter == nullptr) {
+        return false;
+      }
+      for (int64_t i = 0; i < bloom_filter_values_->length(); ++i) {
+        uint64_t hash;
+        if (!HashValue(*bloom_filter_values_, i, physical_type, *bloom_filter, &hash) ||
+            bloom_filter->FindHash(hash)) {
+          return false;
+        }
+      }
+      return true;
+    } catch (const ::parquet::ParquetException&) {
+      // Errors with Bloom filters are ignored and post-filtering will apply.
+      return false;
+    }
+  }
+
   std::shared_ptr<parquet::FileMetaData> metadata_;
   std::shared_ptr<Expression> filter_;
+  parquet::ParquetFileReader* reader_;
+  std::shared_ptr<CachedParquetMetadata> cached_;
+  // The leaf column constrained by the filter to bloom_filter_values_, if any
+  int bloom_filter_column_ = -1;
+  std::shared_ptr<Array> bloom_filter_values_;
   int row_group_idx_;
   int num_row_groups_;
   int64_t rows_skipped_;
 };
 
-template <typename M>
-static Result<SchemaManifest> GetSchemaManifest(const M& metadata) {
-  SchemaManifest manifest;
-  RETURN_NOT_OK(SchemaManifest::Make(
-      metadata.schema(), nullptr, parquet::default_arrow_reader_properties(), &manifest));
-  return manifest;
-}
-
 class ParquetScanTaskIterator {
  public:
   static Result<ScanTaskIterator> Make(
       std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context,
-      std::unique_ptr<parquet::ParquetFileReader> reader) {
+      std::unique_ptr<parquet::ParquetFileReader> reader,
+      const ParquetFileFormat::ReaderOptions& reader_options,
+      std::shared_ptr<CachedParquetMetadata> cached = NULLPTR) {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, options);
 
+    if (reader_options.pre_buffer) {
+      // Buffer the row groups which will not be skipped
+      std::vector<int> row_groups;
+      RowGroupSkipper skipper(metadata, options->filter, reader.get(), cached);
+      for (int i = skipper.Next(); i != RowGroupSkipper::kIterationDone;
+           i = skipper.Next()) {
+        row_groups.push_back(i);
+      }
+      try {
+        reader->PreBuffer(row_groups, column_projection, reader_options.cache_options);
+      } catch (const ::parquet::ParquetException& e) {
+        return Status::IOError("Could not pre-buffer parquet file: ", e.what());
+      }
+    }
+
+    parquet::ArrowReaderProperties arrow_properties =
+        parquet::default_arrow_reader_properties();
+    arrow_properties.set_use_threads(reader_options.use_threads);
+    arrow_properties.set_readahead(reader_options.readahead);
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
-                                                   &arrow_reader));
+                                                   arrow_properties, &arrow_reader));
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(metadata), std::move(arrow_reader)));
+        std::move(metadata), std::move(cached), std::move(arrow_reader),
+        reader_options.use_page_index));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -158,8 +455,8 @@ class ParquetScanTaskIterator {
       return nullptr;
     }
 
-    return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+    return std::shared_ptr<ScanTask>(new ParquetScanTask(
+        row_group, column_projection_, reader_, use_page_index_, options_, context_));
   }
 
  private:
@@ -212,20 +509,108 @@ class ParquetScanTaskIterator {
                           std::shared_ptr<ScanContext> context,
                           std::vector<int> column_projection,
                           std::shared_ptr<parquet::FileMetaData> metadata,
-                          std::unique_ptr<parquet::arrow::FileReader> reader)
+                          std::shared_ptr<CachedParquetMetadata> cached,
+                          std::unique_ptr<parquet::arrow::FileReader> reader,
+                          bool use_page_index)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
-        skipper_(std::move(metadata), options_->filter),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        skipper_(std::move(metadata), options_->filter, reader_->parquet_reader(),
+                 std::move(cached)),
+        use_page_index_(use_page_index) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
-  RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  RowGroupSkipper skipper_;
+  bool use_page_index_;
+};
+
+class ParquetMetadataCache::Impl {
+ public:
+  explicit Impl(size_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<CachedParquetMetadata> Get(const fs::FileStats& stats) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(stats.path());
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    if (it->second.size != stats.size() || it->second.mtime != stats.mtime()) {
+      // The file was modified since it was cached
+      Erase(it);
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    return it->second.value;
+  }
+
+  void Put(const fs::FileStats& stats, std::shared_ptr<CachedParquetMetadata> value) {
+    if (stats.size() == fs::kNoSize || capacity_ == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(stats.path());
+    if (it != entries_.end()) {
+      Erase(it);
+    }
+    while (entries_.size() >= capacity_) {
+      Erase(entries_.find(lru_.back()));
+    }
+    lru_.push_front(stats.path());
+    entries_.emplace(stats.path(),
+                     Entry{stats.size(), stats.mtime(), std::move(value), lru_.begin()});
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Entry {
+    int64_t size;
+    fs::TimePoint mtime;
+    std::shared_ptr<CachedParquetMetadata> value;
+    std::list<std::string>::iterator lru_position;
+  };
+  using EntryMap = std::unordered_map<std::string, Entry>;
+
+  void Erase(EntryMap::iterator it) {
+    lru_.erase(it->second.lru_position);
+    entries_.erase(it);
+  }
+
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  // The paths of the cached files, most recently used first
+  std::list<std::string> lru_;
+  EntryMap entries_;
 };
 
+ParquetMetadataCache::ParquetMetadataCache(size_t capacity)
+    : impl_(new Impl(capacity)) {}
+
+ParquetMetadataCache::~ParquetMetadataCache() = default;
+
+std::shared_ptr<CachedParquetMetadata> ParquetMetadataCache::Get(
+    const fs::FileStats& stats) {
+  return impl_->Get(stats);
+}
+
+void ParquetMetadataCache::Put(const fs::FileStats& stats,
+                               std::shared_ptr<CachedParquetMetadata> value) {
+  impl_->Put(stats, std::move(value));
+}
+
+size_t ParquetMetadataCache::size() const { return impl_->size(); }
+
+size_t ParquetMetadataCache::capacity() const { return impl_->capacity(); }
+
 Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
   try {
     ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
@@ -259,20 +644,153 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context) const {
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
-  return ParquetScanTaskIterator::Make(options, context, std::move(reader));
+  const auto& cache = reader_options.metadata_cache;
+  if (cache == nullptr || source.type() != FileSource::PATH) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
+    return ParquetScanTaskIterator::Make(options, context, std::move(reader),
+                                         reader_options);
+  }
+
+  // Stat the file at each scan, the cached metadata is stale if it was rewritten
+  ARROW_ASSIGN_OR_RAISE(auto stats, source.filesystem()->GetTargetStats(source.path()));
+
+  auto cached = cache->Get(stats);
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  if (cached != nullptr) {
+    // Don't open the file if the cached statistics exclude all RowGroups
+    RowGroupSkipper skipper(cached->metadata, options->filter, NULLPTR, cached);
+    if (skipper.Next() == RowGroupSkipper::kIterationDone) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+    metadata = cached->metadata;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool, metadata));
+  if (cached == nullptr) {
+    cached = std::make_shared<CachedParquetMetadata>();
+    cached->metadata = reader->metadata();
+    for (int i = 0; i < cached->metadata->num_row_groups(); ++i) {
+      auto row_group = cached->metadata->RowGroup(i);
+      auto maybe_stats_expr = RowGroupStatisticsAsExpression(*row_group);
+      cached->row_group_statistics.push_back(
+          maybe_stats_expr.ok() ? maybe_stats_expr.MoveValueUnsafe() : nullptr);
+    }
+    cache->Put(stats, cached);
+  }
+  return ParquetScanTaskIterator::Make(options, context, std::move(reader),
+                                       reader_options, std::move(cached));
 }
 
 Result<std::shared_ptr<Fragment>> ParquetFileFormat::MakeFragment(
     const FileSource& source, std::shared_ptr<ScanOptions> options) {
-  return std::make_shared<ParquetFragment>(source, options);
+  return std::make_shared<ParquetFragment>(
+      source, std::make_shared<ParquetFileFormat>(*this), options);
+}
+
+/// \brief A FileWriter of a Parquet file, buffering batches into row groups
+class ParquetFileWriter : public FileWriter {
+ public:
+  static Result<std::unique_ptr<FileWriter>> Make(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      const ParquetFileFormat::WriterOptions& options) {
+    auto properties = options.writer_properties;
+    if (properties == nullptr) {
+      properties = parquet::default_writer_properties();
+    }
+    auto arrow_properties = options.arrow_writer_properties;
+    if (arrow_properties == nullptr) {
+      arrow_properties = parquet::default_arrow_writer_properties();
+    }
+    if (options.row_group_size <= 0) {
+      return Status::Invalid("Row group size must be positive, got ",
+                             options.row_group_size);
+    }
+
+    std::unique_ptr<parquet::arrow::FileWriter> writer;
+    RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, default_memory_pool(),
+                                                   destination, std::move(properties),
+                                                   std::move(arrow_properties), &writer));
+    return std::unique_ptr<FileWriter>(new ParquetFileWriter(
+        std::move(destination), std::move(schema), std::move(writer),
+        options.row_group_size));
+  }
+
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    batches_.push_back(batch);
+    num_buffered_rows_ += batch->num_rows();
+    while (num_buffered_rows_ >= row_group_size_) {
+      RETURN_NOT_OK(WriteRowGroup(row_group_size_));
+    }
+    return Status::OK();
+  }
+
+  Status Finish() override {
+    // Only the last row group may be shorter
+    RETURN_NOT_OK(WriteRowGroup(num_buffered_rows_));
+    RETURN_NOT_OK(writer_->Close());
+    return destination_->Close();
+  }
+
+ private:
+  ParquetFileWriter(std::shared_ptr<io::OutputStream> destination,
+                    std::shared_ptr<Schema> schema,
+                    std::unique_ptr<parquet::arrow::FileWriter> writer,
+                    int64_t row_group_size)
+      : destination_(std::move(destination)),
+        schema_(std::move(schema)),
+        writer_(std::move(writer)),
+        row_group_size_(row_group_size) {}
+
+  // Write the first num_rows buffered rows as a row group, the rest of the
+  // last batch they span stays buffered
+  Status WriteRowGroup(int64_t num_rows) {
+    if (num_rows == 0) {
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<RecordBatch>> row_group;
+    auto it = batches_.begin();
+    for (int64_t remaining = num_rows; remaining > 0;) {
+      auto& batch = *it;
+      if (batch->num_rows() <= remaining) {
+        remaining -= batch->num_rows();
+        row_group.push_back(std::move(batch));
+        ++it;
+      } else {
+        row_group.push_back(batch->Slice(0, remaining));
+        batch = batch->Slice(remaining);
+        remaining = 0;
+      }
+    }
+    batches_.erase(batches_.begin(), it);
+    num_buffered_rows_ -= num_rows;
+
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(Table::FromRecordBatches(schema_, row_group, &table));
+    return writer_->WriteTable(*table, num_rows);
+  }
+
+  std::shared_ptr<io::OutputStream> destination_;
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+  int64_t row_group_size_;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  int64_t num_buffered_rows_ = 0;
+};
+
+Result<std::unique_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema) const {
+  return ParquetFileWriter::Make(std::move(destination), std::move(schema),
+                                 writer_options);
 }
 
 Result<std::unique_ptr<parquet::ParquetFileReader>> ParquetFileFormat::OpenReader(
-    const FileSource& source, MemoryPool* pool) const {
+    const FileSource& source, MemoryPool* pool,
+    std::shared_ptr<parquet::FileMetaData> metadata) const {
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   try {
-    return parquet::ParquetFileReader::Open(input);
+    return parquet::ParquetFileReader::Open(input, parquet::default_reader_properties(),
+                                            std::move(metadata));
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -294,8 +812,6 @@ static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
   }
 
   auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
-  auto field = schema_field.field;
-  auto field_expr = field_ref(field->name());
 
   // In case of missing statistics, return nothing.
   if (!column_metadata->is_stats_set()) {
@@ -307,18 +823,7 @@ static std::shared_ptr<Expression> ColumnChunkStatisticsAsExpression(
     return scalar(true);
   }
 
-  // Optimize for corner case where all values are nulls
-  if (statistics->num_values() == statistics->null_count()) {
-    return equal(field_expr, scalar(MakeNullScalar(field->type())));
-  }
-
-  std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
-    return scalar(true);
-  }
-
-  return and_(greater_equal(field_expr, scalar(min)),
-              less_equal(field_expr, scalar(max)));
+  return StatisticsAsExpression(*schema_field.field, *statistics);
 }
 
 Result<std::shared_ptr<Expression>> RowGroupStatisticsAsExpression(
@@ -17,27 +17,127 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/caching.h"
 
 namespace parquet {
 class ParquetFileReader;
 class RowGroupMetaData;
 class FileMetaData;
+class WriterProperties;
+class ArrowWriterProperties;
 }  // namespace parquet
 
 namespace arrow {
 namespace dataset {
 
-/// \brief A FileFormat implementation that reads from Parquet files
+/// \brief The metadata of a Parquet file which is kept across scans
+struct ARROW_DS_EXPORT CachedParquetMetadata {
+  /// The parsed footer of the file
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  /// The statistics of each row group, as returned by
+  /// RowGroupStatisticsAsExpression(), or null where they could not be read
+  ExpressionVector row_group_statistics;
+};
+
+/// \brief A bounded, least recently used cache of the metadata of Parquet files
+///
+/// Entries are keyed by the path of the file and are only returned while the
+/// size and modification time of the file match those recorded when the
+/// entry was inserted. Rewriting a file with the same size within the
+/// resolution of the modification times of the filesystem goes unnoticed.
+/// This class is thread-safe.
+class ARROW_DS_EXPORT ParquetMetadataCache {
+ public:
+  /// \brief Create a cache holding the metadata of up to `capacity` files
+  explicit ParquetMetadataCache(size_t capacity = 4096);
+  ~ParquetMetadataCache();
+
+  /// \brief Return the metadata cached for a file, or null if there is none
+  /// or the file changed since it was cached
+  std::shared_ptr<CachedParquetMetadata> Get(const fs::FileStats& stats);
+
+  /// \brief Cache the metadata of a file, evicting the least recently used
+  /// entry if the cache is full
+  ///
+  /// Files of unknown size are not cached.
+  void Put(const fs::FileStats& stats, std::shared_ptr<CachedParquetMetadata> value);
+
+  /// \brief The number of files currently cached
+  size_t size() const;
+
+  size_t capacity() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A FileFormat implementation that reads from and writes to Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
   std::string type_name() const override { return "parquet"; }
 
+  /// \brief Options affecting how files are read
+  struct ReaderOptions {
+    /// Read the projected column chunks of all row groups to scan when a
+    /// file is opened, coalescing nearby ranges and issuing the reads
+    /// concurrently. This hides the latency of high latency filesystems
+    /// such as S3, at the cost of buffering the compressed column chunks
+    /// of a file until they are scanned.
+    bool pre_buffer = false;
+    /// How to coalesce reads when pre-buffering
+    ::arrow::io::CacheOptions cache_options = ::arrow::io::CacheOptions::Defaults();
+    /// Skip the data pages of the filtered columns whose statistics, as
+    /// recorded in the page index of the file, do not satisfy the filter.
+    /// Pages of the other projected columns which only hold skipped rows
+    /// are skipped too. Files without page index are read in full.
+    bool use_page_index = false;
+    /// Decode the columns of each record batch concurrently on the CPU
+    /// thread pool, decoding up to `readahead` batches ahead of the
+    /// consumer. This speeds up serial scans (ScanOptions::use_threads
+    /// disabled) of wide files with few row groups.
+    ///
+    /// This has no effect in threaded scans: their scan tasks already run on
+    /// the CPU thread pool, where batches are decoded serially as waiting for
+    /// other tasks of the pool could deadlock.
+    bool use_threads = false;
+    /// See parquet::ArrowReaderProperties::set_readahead(). Like use_threads,
+    /// this has no effect in threaded scans.
+    int32_t readahead = 1;
+    /// If set, the footers and row group statistics of the files scanned from
+    /// a filesystem are cached, so that repeated scans need not read and
+    /// parse them again. Files whose row groups are all excluded by the
+    /// filter according to the cached statistics are not opened at all.
+    /// Scanned files are stat'ed to check that they were not modified since
+    /// they were cached.
+    std::shared_ptr<ParquetMetadataCache> metadata_cache;
+  };
+
+  ReaderOptions reader_options;
+
+  /// \brief Options affecting how files are written
+  struct WriterOptions {
+    /// Properties of the written files, the defaults if null
+    std::shared_ptr<::parquet::WriterProperties> writer_properties;
+    /// How Arrow types are stored, the defaults if null
+    std::shared_ptr<::parquet::ArrowWriterProperties> arrow_writer_properties;
+    /// Written batches are buffered until they hold this many rows, which are
+    /// then written as a row group. This avoids writing a row group for each
+    /// of the small batches that partitioning a dataset yields. Only the last
+    /// row group of a file may hold fewer rows.
+    int64_t row_group_size = 64 * 1024;
+  };
+
+  WriterOptions writer_options;
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -51,9 +151,14 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   Result<std::shared_ptr<Fragment>> MakeFragment(
       const FileSource& source, std::shared_ptr<ScanOptions> options) override;
 
+  Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination,
+      std::shared_ptr<Schema> schema) const override;
+
  private:
   Result<std::unique_ptr<::parquet::ParquetFileReader>> OpenReader(
-      const FileSource& source, MemoryPool* pool) const;
+      const FileSource& source, MemoryPool* pool,
+      std::shared_ptr<::parquet::FileMetaData> metadata = NULLPTR) const;
 };
 
 class ARROW_DS_EXPORT ParquetFragment : public FileFragment {
@@ -61,6 +166,10 @@ class ARROW_DS_EXPORT ParquetFragment : public FileFragment {
   ParquetFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
       : FileFragment(source, std::make_shared<ParquetFileFormat>(), options) {}
 
+  ParquetFragment(const FileSource& source, std::shared_ptr<ParquetFileFormat> format,
+                  std::shared_ptr<ScanOptions> options)
+      : FileFragment(source, std::move(format), std::move(options)) {}
+
   bool splittable() const override { return true; }
 };
 
@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <future>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -24,13 +25,18 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/thread_pool.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 
 namespace arrow {
 namespace dataset {
@@ -46,12 +52,12 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
+using ParquetFileWriter = parquet::arrow::FileWriter;
 
 using testing::Pointee;
 
-Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+Status WriteRecordBatch(const RecordBatch& batch, ParquetFileWriter* writer) {
   auto schema = batch.schema();
   auto size = batch.num_rows();
 
@@ -69,7 +75,7 @@ Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
   return Status::OK();
 }
 
-Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+Status WriteRecordBatchReader(RecordBatchReader* reader, ParquetFileWriter* writer) {
   auto schema = reader->schema();
 
   if (!schema->Equals(*writer->schema(), false)) {
@@ -90,8 +96,8 @@ Status WriteRecordBatchReader(
     const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
     const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
         default_arrow_writer_properties()) {
-  std::unique_ptr<FileWriter> writer;
-  RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
+  std::unique_ptr<ParquetFileWriter> writer;
+  RETURN_NOT_OK(ParquetFileWriter::Open(*reader->schema(), pool, sink, properties,
                                  arrow_properties, &writer));
   RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
   return writer->Close();
@@ -185,6 +191,67 @@ TEST_F(TestParquetFileFormat, ScanRecordBatchReader) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestParquetFileFormat, ScanRecordBatchReaderWithThreads) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ParquetFileFormat format;
+  format.reader_options.use_threads = true;
+  format.reader_options.readahead = 4;
+
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, format.ScanFile(*source, opts_, ctx_));
+  int64_t row_count = 0;
+
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ASSERT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+    for (auto maybe_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestParquetFileFormat, ScanRecordBatchReaderWithThreadsOnPool) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ParquetFileFormat format;
+  format.reader_options.use_threads = true;
+  format.reader_options.readahead = 4;
+
+  // Execute the scan tasks on the CPU thread pool, as a threaded scan does
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, format.ScanFile(*source, opts_, ctx_));
+  std::vector<std::future<Result<int64_t>>> futures;
+
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ASSERT_OK_AND_ASSIGN(auto future, pool->Submit([task]() -> Result<int64_t> {
+      int64_t row_count = 0;
+      ARROW_ASSIGN_OR_RAISE(auto rb_it, task->Execute());
+      for (auto maybe_batch : rb_it) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+        row_count += batch->num_rows();
+      }
+      return row_count;
+    }));
+    futures.push_back(std::move(future));
+  }
+
+  int64_t row_count = 0;
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(auto task_row_count, future.get());
+    row_count += task_row_count;
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
 TEST_F(TestParquetFileFormat, OpenFailureWithRelevantError) {
   auto format = ParquetFileFormat();
 
@@ -302,6 +369,45 @@ TEST_F(TestParquetFileFormat, IsSupported) {
   EXPECT_EQ(supported, true);
 }
 
+TEST_F(TestParquetFileFormat, WriteRowGroups) {
+  ParquetFileFormat format;
+  // Row groups end in the middle of batches
+  const int64_t row_group_size = 3 * kBatchSize + 100;
+  format.writer_options.row_group_size = row_group_size;
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, format.MakeWriter(sink, schema_));
+  auto reader = GetRecordBatchReader();
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->Write(batch));
+  }
+  ASSERT_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Batches are buffered into row groups of row_group_size rows, but for the
+  // last one
+  auto metadata =
+      parquet::ParquetFileReader::Open(std::make_shared<io::BufferReader>(buffer))
+          ->metadata();
+  ASSERT_EQ(metadata->num_rows(), kNumRows);
+  const int num_row_groups = metadata->num_row_groups();
+  ASSERT_EQ(num_row_groups, (kNumRows + row_group_size - 1) / row_group_size);
+  for (int i = 0; i < num_row_groups - 1; ++i) {
+    ASSERT_EQ(metadata->RowGroup(i)->num_rows(), row_group_size);
+  }
+  ASSERT_EQ(metadata->RowGroup(num_row_groups - 1)->num_rows(),
+            kNumRows % row_group_size);
+
+  format.writer_options.row_group_size = 0;
+  ASSERT_RAISES(Invalid, format.MakeWriter(sink, schema_));
+
+  FileSource source(buffer);
+  ASSERT_OK_AND_ASSIGN(auto actual, format.Inspect(source));
+  AssertSchemaEqual(*actual, *schema_, /*check_metadata=*/false);
+}
+
 void CountRowsInScan(ScanTaskIterator& it, int64_t expected_rows,
                      int64_t expected_batches) {
   int64_t actual_rows = 0;
@@ -396,5 +502,165 @@ TEST_F(TestParquetFileFormatPushDown, Basic) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormatPushDown, BloomFilter) {
+  // The statistics of both row groups cover "b", only the Bloom filters
+  // tell which row group contains it
+  auto table = TableFromJSON(schema({field("str", utf8())}), {R"([
+    {"str": "a"}, {"str": "c"}, {"str": "b"}, {"str": "d"}
+  ])"});
+  auto properties = WriterProperties::Builder().enable_bloom_filter("str")->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/2,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table->schema());
+  auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+  opts_->filter = ("str"_ == std::string("b")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2, 1);
+  opts_->filter = ("str"_ == std::string("bb")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 0, 0);
+  opts_->filter = ("str"_ == std::string("b") and "str"_ != std::string("c")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2, 1);
+  opts_->filter = "str"_.In(ArrayFromJSON(utf8(), R"(["bb", "c"])")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2, 1);
+  opts_->filter = "str"_.In(ArrayFromJSON(utf8(), R"(["b", "c"])")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 4, 2);
+  // Inequalities are left to the statistics
+  opts_->filter = ("str"_ != std::string("b")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 4, 2);
+}
+
+TEST_F(TestParquetFileFormatPushDown, BloomFilterFloatingPoint) {
+  DoubleBuilder builder;
+  ASSERT_OK(builder.AppendValues({-0.0, 1.0, 2.0, 3.0}));
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto table = Table::Make(schema({field("f64", float64())}), {values});
+  auto properties = WriterProperties::Builder().enable_bloom_filter("f64")->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/2,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(table->schema());
+  auto fragment = std::make_shared<ParquetFragment>(source, opts_);
+
+  // -0.0 equals 0.0 but their bit patterns, as hashed in the Bloom filter,
+  // differ. Only the statistics may skip the row group.
+  opts_->filter = ("f64"_ == 0.0).Copy();
+  CountRowsAndBatchesInScan(*fragment, 2, 1);
+  // The statistics do not skip row groups for IN predicates
+  opts_->filter = "f64"_.In(ArrayFromJSON(float64(), "[0.0, 5.0]")).Copy();
+  CountRowsAndBatchesInScan(*fragment, 4, 2);
+}
+
+TEST_F(TestParquetFileFormatPushDown, PageIndex) {
+  constexpr int64_t kNumRows = 100;
+  Int64Builder builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(builder.Append(i));
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto table = Table::Make(schema({field("i64", int64())}), {values});
+  // Data pages of 10 rows in a single row group
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->write_batch_size(10)
+                        ->data_pagesize(1)
+                        ->enable_write_page_index()
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kNumRows, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  auto count_rows = [&](const ParquetFileFormat& format, int64_t expected_rows) {
+    int64_t actual_rows = 0;
+    ASSERT_OK_AND_ASSIGN(auto it, format.ScanFile(source, opts_, ctx_));
+    for (auto maybe_scan_task : it) {
+      ASSERT_OK_AND_ASSIGN(auto scan_task, std::move(maybe_scan_task));
+      ASSERT_OK_AND_ASSIGN(auto rb_it, scan_task->Execute());
+      for (auto maybe_record_batch : rb_it) {
+        ASSERT_OK_AND_ASSIGN(auto record_batch, std::move(maybe_record_batch));
+        actual_rows += record_batch->num_rows();
+      }
+    }
+    EXPECT_EQ(expected_rows, actual_rows);
+  };
+
+  opts_ = ScanOptions::Make(table->schema());
+  ParquetFileFormat format;
+  ParquetFileFormat page_index_format;
+  page_index_format.reader_options.use_page_index = true;
+
+  opts_->filter = ("i64"_ >= int64_t(42) and "i64"_ < int64_t(47)).Copy();
+  count_rows(format, kNumRows);
+  count_rows(page_index_format, 10);
+  opts_->filter = ("i64"_ < int64_t(5) or "i64"_ == int64_t(95)).Copy();
+  count_rows(page_index_format, 20);
+  opts_->filter = ("i64"_ == int64_t(19) or "i64"_ == int64_t(20)).Copy();
+  count_rows(page_index_format, 20);
+  opts_->filter = scalar(true);
+  count_rows(page_index_format, kNumRows);
+}
+
+TEST_F(TestParquetFileFormatPushDown, MetadataCache) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto buffer = Write(reader.get());
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(fs->CreateFile("a.parquet", buffer->ToString()));
+  ASSERT_OK(fs->CreateFile("b.parquet", buffer->ToString()));
+
+  ParquetFileFormat format;
+  auto cache = std::make_shared<ParquetMetadataCache>(/*capacity=*/1);
+  format.reader_options.metadata_cache = cache;
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto a, format.MakeFragment({"a.parquet", fs.get()}, opts_));
+  ASSERT_OK_AND_ASSIGN(auto b, format.MakeFragment({"b.parquet", fs.get()}, opts_));
+
+  opts_->filter = ("i64"_ == int64_t(3)).Copy();
+  CountRowsAndBatchesInScan(*a, 3, 1);
+  ASSERT_EQ(cache->size(), 1U);
+  ASSERT_OK_AND_ASSIGN(auto a_stats, fs->GetTargetStats("a.parquet"));
+  ASSERT_NE(cache->Get(a_stats), nullptr);
+  CountRowsAndBatchesInScan(*a, 3, 1);
+
+  // A file whose RowGroups are all excluded by the cached statistics is not
+  // read: overwriting it with garbage of the same size and modification time
+  // goes unnoticed
+  ASSERT_OK(fs->CreateFile("a.parquet", std::string(buffer->size(), 'x')));
+  opts_->filter = ("i64"_ == int64_t(kNumRowGroups + 1)).Copy();
+  CountRowsAndBatchesInScan(*a, 0, 0);
+
+  // A file rewritten with other contents is read again
+  auto other_reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups + 1);
+  ASSERT_OK(fs->CreateFile("a.parquet", Write(other_reader.get())->ToString()));
+  CountRowsAndBatchesInScan(*a, kNumRowGroups + 1, 1);
+  ASSERT_OK_AND_ASSIGN(a_stats, fs->GetTargetStats("a.parquet"));
+  ASSERT_NE(cache->Get(a_stats), nullptr);
+
+  // The least recently used file is evicted
+  opts_->filter = ("i64"_ == int64_t(3)).Copy();
+  CountRowsAndBatchesInScan(*b, 3, 1);
+  ASSERT_EQ(cache->size(), 1U);
+  ASSERT_EQ(cache->Get(a_stats), nullptr);
+  ASSERT_OK_AND_ASSIGN(auto b_stats, fs->GetTargetStats("b.parquet"));
+  ASSERT_NE(cache->Get(b_stats), nullptr);
+
+  // Entries of modified files are dropped
+  fs::FileStats modified_stats = b_stats;
+  modified_stats.set_size(b_stats.size() + 1);
+  ASSERT_EQ(cache->Get(modified_stats), nullptr);
+  ASSERT_EQ(cache->size(), 0U);
+}
+
 }  // namespace dataset
 }  // namespace arrow
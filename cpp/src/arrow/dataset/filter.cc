@@ -23,6 +23,7 @@
 #include <numeric>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -34,11 +35,13 @@
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
 #include "arrow/compute/kernels/isin.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -1243,5 +1246,223 @@ Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
   return batch->Slice(0, 0);
 }
 
+// Collect the operands of nested AndExpressions, from left to right
+static void FlattenConjunction(const Expression& expr,
+                               std::vector<const Expression*>* conjuncts) {
+  if (expr.type() != ExpressionType::AND) {
+    conjuncts->push_back(&expr);
+    return;
+  }
+  const auto& and_expr = checked_cast<const AndExpression&>(expr);
+  FlattenConjunction(*and_expr.left_operand(), conjuncts);
+  FlattenConjunction(*and_expr.right_operand(), conjuncts);
+}
+
+// Whether FieldsInExpression() yields every field referenced by expr, which is not
+// the case for custom expressions
+static bool AreFieldsKnown(const Expression& expr) {
+  switch (expr.type()) {
+    case ExpressionType::FIELD:
+    case ExpressionType::SCALAR:
+      return true;
+    case ExpressionType::NOT:
+    case ExpressionType::CAST:
+    case ExpressionType::IS_VALID:
+    case ExpressionType::IN:
+      return AreFieldsKnown(*checked_cast<const UnaryExpression&>(expr).operand());
+    case ExpressionType::AND:
+    case ExpressionType::OR:
+    case ExpressionType::COMPARISON: {
+      const auto& binary = checked_cast<const BinaryExpression&>(expr);
+      return AreFieldsKnown(*binary.left_operand()) &&
+             AreFieldsKnown(*binary.right_operand());
+    }
+    default:
+      return false;
+  }
+}
+
+double SelectionEvaluator::EstimateSelectivity(const Expression& expr) {
+  switch (expr.type()) {
+    case ExpressionType::SCALAR: {
+      const auto& value = checked_cast<const ScalarExpression&>(expr).value();
+      if (value->is_valid && value->type->id() == Type::BOOL) {
+        return checked_cast<const BooleanScalar&>(*value).value ? 1.0 : 0.0;
+      }
+      // null selects no row
+      return 0.0;
+    }
+    case ExpressionType::COMPARISON:
+      switch (checked_cast<const ComparisonExpression&>(expr).op()) {
+        case compute::CompareOperator::EQUAL:
+          return 0.1;
+        case compute::CompareOperator::NOT_EQUAL:
+          return 0.9;
+        default:
+          return 1.0 / 3;
+      }
+    case ExpressionType::IN: {
+      const auto& set = checked_cast<const InExpression&>(expr).set();
+      return std::min(1.0, 0.1 * set->length());
+    }
+    case ExpressionType::IS_VALID:
+      return 0.9;
+    case ExpressionType::NOT: {
+      const auto& not_expr = checked_cast<const NotExpression&>(expr);
+      return 1.0 - EstimateSelectivity(*not_expr.operand());
+    }
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      return EstimateSelectivity(*and_expr.left_operand()) *
+             EstimateSelectivity(*and_expr.right_operand());
+    }
+    case ExpressionType::OR: {
+      const auto& or_expr = checked_cast<const OrExpression&>(expr);
+      auto left = EstimateSelectivity(*or_expr.left_operand());
+      auto right = EstimateSelectivity(*or_expr.right_operand());
+      return left + right - left * right;
+    }
+    default:
+      return 1.0;
+  }
+}
+
+Result<Datum> SelectionEvaluator::Evaluate(const Expression& expr,
+                                           const RecordBatch& batch,
+                                           MemoryPool* pool) const {
+  if (expr.type() != ExpressionType::AND || batch.num_rows() == 0) {
+    return TreeEvaluator::Evaluate(expr, batch, pool);
+  }
+
+  // Evaluate the most selective conjuncts first, in their original order otherwise
+  std::vector<const Expression*> conjuncts;
+  FlattenConjunction(expr, &conjuncts);
+  std::vector<double> selectivities;
+  for (auto conjunct : conjuncts) {
+    selectivities.push_back(EstimateSelectivity(*conjunct));
+  }
+  std::vector<size_t> order(conjuncts.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+    return selectivities[l] < selectivities[r];
+  });
+
+  // The conjuncts are evaluated against a view of the batch, which holds the rows of
+  // the batch given by view_rows once compacted. The rows of the view which no
+  // conjunct evaluated to false so far are selected, and flagged if a conjunct
+  // evaluated to null for them.
+  const RecordBatch* view = &batch;
+  std::shared_ptr<RecordBatch> compacted;
+  std::vector<int64_t> view_rows;
+  std::vector<int64_t> selected(static_cast<size_t>(batch.num_rows()));
+  std::iota(selected.begin(), selected.end(), 0);
+  std::vector<bool> selected_null(selected.size(), false);
+
+  compute::FunctionContext ctx{pool};
+  for (size_t i = 0; i < order.size(); ++i) {
+    const auto& conjunct = *conjuncts[order[i]];
+    ARROW_ASSIGN_OR_RAISE(auto mask, Evaluate(conjunct, *view, pool));
+
+    if (IsNullDatum(mask) || (mask.is_scalar() && !mask.scalar()->is_valid)) {
+      std::fill(selected_null.begin(), selected_null.end(), true);
+    } else if (mask.is_scalar() && mask.type()->id() == Type::BOOL) {
+      if (!checked_cast<const BooleanScalar&>(*mask.scalar()).value) {
+        return Datum(false);
+      }
+    } else if (mask.is_array() && mask.type()->id() == Type::BOOL) {
+      BooleanArray mask_array(mask.array());
+      size_t num_selected = 0;
+      for (size_t j = 0; j < selected.size(); ++j) {
+        auto row = selected[j];
+        if (mask_array.IsNull(row)) {
+          selected_null[num_selected] = true;
+        } else if (mask_array.Value(row)) {
+          selected_null[num_selected] = selected_null[j];
+        } else {
+          continue;
+        }
+        selected[num_selected++] = row;
+      }
+      selected.resize(num_selected);
+      selected_null.resize(num_selected);
+    } else {
+      return Status::NotImplemented("Filtering batches against DatumKind::", mask.kind(),
+                                    " of type ", *mask.type());
+    }
+
+    if (selected.empty()) {
+      return Datum(false);
+    }
+
+    if (i + 1 == order.size() ||
+        static_cast<int64_t>(selected.size()) > view->num_rows() / 2) {
+      continue;
+    }
+
+    // Compact the columns referenced by the remaining conjuncts
+    std::vector<std::string> names;
+    bool fields_known = true;
+    for (size_t k = i + 1; k < order.size(); ++k) {
+      const auto& remaining = *conjuncts[order[k]];
+      fields_known = fields_known && AreFieldsKnown(remaining);
+      auto remaining_names = FieldsInExpression(remaining);
+      names.insert(names.end(), remaining_names.begin(), remaining_names.end());
+    }
+    if (!fields_known) {
+      continue;
+    }
+
+    Int64Array indices(static_cast<int64_t>(selected.size()), Buffer::Wrap(selected));
+    std::unordered_set<std::string> compacted_names;
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (const auto& name : names) {
+      auto column = view->GetColumnByName(name);
+      if (column == nullptr || !compacted_names.insert(name).second) {
+        continue;
+      }
+      std::shared_ptr<Array> taken;
+      RETURN_NOT_OK(
+          compute::Take(&ctx, *column, indices, compute::TakeOptions(), &taken));
+      fields.push_back(view->schema()->GetFieldByName(name));
+      columns.push_back(std::move(taken));
+    }
+    compacted = RecordBatch::Make(schema(std::move(fields)), indices.length(),
+                                  std::move(columns));
+    view = compacted.get();
+
+    for (auto& row : selected) {
+      row = view_rows.empty() ? row : view_rows[row];
+    }
+    view_rows = std::move(selected);
+    selected.resize(view_rows.size());
+    std::iota(selected.begin(), selected.end(), 0);
+  }
+
+  // Kleene conjunction: false if any conjunct is false, otherwise null if any is null
+  int64_t num_rows = batch.num_rows();
+  int64_t null_count = std::count(selected_null.begin(), selected_null.end(), true);
+  if (static_cast<int64_t>(selected.size()) == num_rows && null_count == 0) {
+    return Datum(true);
+  }
+
+  std::shared_ptr<Buffer> values, validity;
+  RETURN_NOT_OK(AllocateEmptyBitmap(pool, num_rows, &values));
+  if (null_count != 0) {
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool, num_rows, &validity));
+    std::memset(validity->mutable_data(), 0xff, validity->size());
+  }
+  for (size_t j = 0; j < selected.size(); ++j) {
+    auto row = view_rows.empty() ? selected[j] : view_rows[selected[j]];
+    if (selected_null[j]) {
+      BitUtil::ClearBit(validity->mutable_data(), row);
+    } else {
+      BitUtil::SetBit(values->mutable_data(), row);
+    }
+  }
+  return Datum(std::make_shared<BooleanArray>(num_rows, std::move(values),
+                                              std::move(validity), null_count));
+}
+
 }  // namespace dataset
 }  // namespace arrow
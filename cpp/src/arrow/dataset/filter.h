@@ -608,5 +608,27 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
   struct Impl;
 };
 
+/// construct an Evaluator which evaluates a conjunction of expressions one conjunct
+/// at a time, in order of estimated selectivity, each against the rows which the
+/// previous conjuncts did not reject. Once half of the rows are rejected, the columns
+/// referenced by the remaining conjuncts are compacted to the rows left. Other
+/// expressions are evaluated as by TreeEvaluator.
+///
+/// \note Errors which a conjunct would raise for rows rejected by a preceding conjunct,
+/// such as a failing cast, are not raised.
+class ARROW_DS_EXPORT SelectionEvaluator : public TreeEvaluator {
+ public:
+  using TreeEvaluator::Evaluate;
+
+  Result<compute::Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                                  MemoryPool* pool) const override;
+
+  /// \brief Estimate the fraction of rows for which a boolean expression is true.
+  ///
+  /// Equality selects a tenth of the rows, other comparisons a third, and IN a tenth
+  /// per element of its set.
+  static double EstimateSelectivity(const Expression& expr);
+};
+
 }  // namespace dataset
 }  // namespace arrow
@@ -411,6 +411,120 @@ TEST_F(FilterTest, KleeneTruthTables) {
   ])");
 }
 
+class SelectionEvaluatorTest : public FilterTest {
+ public:
+  SelectionEvaluatorTest() { evaluator_ = std::make_shared<SelectionEvaluator>(); }
+};
+
+TEST_F(SelectionEvaluatorTest, EstimateSelectivity) {
+  auto hello_world = ArrayFromJSON(utf8(), R"(["hello", "world"])");
+
+  ASSERT_EQ(SelectionEvaluator::EstimateSelectivity(*scalar(false)), 0.0);
+  ASSERT_EQ(SelectionEvaluator::EstimateSelectivity(*scalar(true)), 1.0);
+  ASSERT_LT(SelectionEvaluator::EstimateSelectivity("a"_ == 0),
+            SelectionEvaluator::EstimateSelectivity("a"_ > 0));
+  ASSERT_LT(SelectionEvaluator::EstimateSelectivity("a"_ > 0),
+            SelectionEvaluator::EstimateSelectivity("a"_ != 0));
+  ASSERT_LT(SelectionEvaluator::EstimateSelectivity("s"_.In(hello_world)),
+            SelectionEvaluator::EstimateSelectivity("a"_ > 0));
+  ASSERT_LT(SelectionEvaluator::EstimateSelectivity("a"_ == 0 and "b"_ == 0),
+            SelectionEvaluator::EstimateSelectivity("a"_ == 0));
+  ASSERT_GT(SelectionEvaluator::EstimateSelectivity("a"_ == 0 or "b"_ == 0),
+            SelectionEvaluator::EstimateSelectivity("a"_ == 0));
+  ASSERT_GT(SelectionEvaluator::EstimateSelectivity(!("a"_ == 0)),
+            SelectionEvaluator::EstimateSelectivity("a"_ == 0));
+}
+
+TEST_F(SelectionEvaluatorTest, Basics) {
+  AssertFilter("b"_ > 0.0 and "b"_ < 1.0 and "a"_ == 0,
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.3, "in": 1},
+      {"a": 1, "b":  0.2, "in": 0},
+      {"a": 2, "b": -0.1, "in": 0},
+      {"a": 0, "b":  0.1, "in": 1},
+      {"a": 0, "b": null, "in": null},
+      {"a": 0, "b":  1.0, "in": 0}
+  ])");
+
+  AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0 and "c"_,
+               {field("a", int32()), field("b", float64()), field("c", boolean())}, R"([
+      {"a": 0, "b":  0.3, "c": true,  "in": 1},
+      {"a": 0, "b":  0.3, "c": false, "in": 0},
+      {"a": 1, "b":  0.2, "c": true,  "in": 0}
+  ])");
+
+  // A conjunct which is false for every row
+  AssertFilter("a"_ == 0 and "b"_ > 2.0, {field("a", int32()), field("b", float64())},
+               R"([
+      {"a": 0, "b": 0.3, "in": 0},
+      {"a": 1, "b": 0.2, "in": 0}
+  ])");
+}
+
+TEST_F(SelectionEvaluatorTest, KleeneTruthTables) {
+  AssertFilter("a"_ and "b"_, {field("a", boolean()), field("b", boolean())}, R"([
+    {"a":null,  "b":null,  "in":null},
+    {"a":null,  "b":true,  "in":null},
+    {"a":null,  "b":false, "in":false},
+
+    {"a":true,  "b":true,  "in":true},
+    {"a":true,  "b":false, "in":false},
+
+    {"a":false,  "b":false,  "in":false}
+  ])");
+
+  AssertFilter("a"_ and "b"_ and "c"_ == 0,
+               {field("a", boolean()), field("b", boolean()), field("c", int32())}, R"([
+    {"a":null,  "b":null,  "c":0,    "in":null},
+    {"a":null,  "b":true,  "c":null, "in":null},
+    {"a":null,  "b":true,  "c":1,    "in":false},
+    {"a":true,  "b":true,  "c":0,    "in":true},
+    {"a":false, "b":null,  "c":0,    "in":false}
+  ])");
+}
+
+TEST_F(SelectionEvaluatorTest, Compaction) {
+  // Most rows are rejected by "a"_ == 0, which is evaluated first. The columns
+  // referenced by the following conjuncts are then compacted to the rows left.
+  AssertFilter("c"_ != int32_t(3) and "b"_ > 0.0 and "a"_ == 0,
+               {field("a", int32()), field("b", float64()), field("c", int32())}, R"([
+      {"a": 1, "b":  0.3, "c": 0,    "in": 0},
+      {"a": 0, "b":  0.3, "c": 0,    "in": 1},
+      {"a": 1, "b":  0.2, "c": 0,    "in": 0},
+      {"a": 0, "b": -0.1, "c": 0,    "in": 0},
+      {"a": 2, "b":  0.1, "c": 0,    "in": 0},
+      {"a": 0, "b": null, "c": 0,    "in": null},
+      {"a": 3, "b":  1.0, "c": 0,    "in": 0},
+      {"a": 0, "b":  1.0, "c": 3,    "in": 0},
+      {"a": 0, "b":  1.0, "c": null, "in": null},
+      {"a": 0, "b":  0.5, "c": 1,    "in": 1},
+      {"a": 4, "b":  1.0, "c": 0,    "in": 0},
+      {"a": 5, "b":  1.0, "c": 0,    "in": 0},
+      {"a": 6, "b":  1.0, "c": 0,    "in": 0},
+      {"a": 7, "b":  1.0, "c": 0,    "in": 0},
+      {"a": 8, "b":  1.0, "c": 0,    "in": 0},
+      {"a": 9, "b":  1.0, "c": 0,    "in": 0}
+  ])");
+}
+
+TEST_F(SelectionEvaluatorTest, RejectedRowsAreNotEvaluated) {
+  // The cast of "s" fails for the rows which "a"_ == 0 rejects
+  auto expr = "a"_ == 0 and "s"_.CastTo(int32()) > int32_t(1);
+  std::vector<std::shared_ptr<Field>> fields = {field("a", int32()), field("s", utf8())};
+  auto batch_json = R"([
+      {"a": 0, "s": "2",   "in": 1},
+      {"a": 1, "s": "foo", "in": 0},
+      {"a": 0, "s": "1",   "in": 0},
+      {"a": 1, "s": "bar", "in": 0},
+      {"a": 1, "s": "baz", "in": 0}
+  ])";
+  AssertFilter(expr, fields, batch_json);
+
+  evaluator_ = std::make_shared<TreeEvaluator>();
+  ASSERT_RAISES(Invalid, DoFilter(expr, fields, batch_json));
+}
+
 class TakeExpression : public CustomExpression {
  public:
   TakeExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> dictionary)
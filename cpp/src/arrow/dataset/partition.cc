@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -53,6 +54,10 @@ Result<std::shared_ptr<Expression>> Partitioning::Parse(const std::string& path)
   return and_(std::move(expressions));
 }
 
+Result<std::string> Partitioning::Format(const std::vector<std::string>& values) const {
+  return Status::NotImplemented("Formatting paths from ", type_name(), " partitioning");
+}
+
 std::shared_ptr<Partitioning> Partitioning::Default() {
   return std::make_shared<DefaultPartitioning>();
 }
@@ -89,6 +94,27 @@ Result<std::shared_ptr<Expression>> KeyValuePartitioning::Parse(
   return scalar(true);
 }
 
+Result<std::string> KeyValuePartitioning::Format(
+    const std::vector<std::string>& values) const {
+  if (values.size() != static_cast<size_t>(schema_->num_fields())) {
+    return Status::Invalid("Expected ", schema_->num_fields(),
+                           " partition values to format a path, got ", values.size());
+  }
+
+  std::string path;
+  for (int i = 0; i < schema_->num_fields(); ++i) {
+    const auto& value = values[i];
+    if (value.empty() || value == "." || value == ".." ||
+        value.find_first_of('/') != std::string::npos) {
+      return Status::Invalid("Partition value '", value, "' of field '",
+                             schema_->field(i)->name(), "' is not a valid path segment");
+    }
+    path = fs::internal::ConcatAbstractPath(
+        path, FormatKey(Key{schema_->field(i)->name(), value}));
+  }
+  return path;
+}
+
 util::optional<KeyValuePartitioning::Key> DirectoryPartitioning::ParseKey(
     const std::string& segment, int i) const {
   if (i >= schema_->num_fields()) {
@@ -73,6 +73,14 @@ class ARROW_DS_EXPORT Partitioning {
   /// \brief Parse a path into a partition expression
   Result<std::shared_ptr<Expression>> Parse(const std::string& path) const;
 
+  /// \brief Format the path of the directory holding rows whose partition
+  /// fields have the given values, the inverse of Parse(path)
+  ///
+  /// \param[in] values the string representation of the value of each field
+  ///            of schema(), in order
+  /// \return the relative directory path, empty if schema() has no field
+  virtual Result<std::string> Format(const std::vector<std::string>& values) const;
+
   /// \brief A default Partitioning which always yields scalar(true)
   static std::shared_ptr<Partitioning> Default();
 
@@ -112,6 +120,10 @@ class DefaultPartitioning : public Partitioning {
                                             int i) const override {
     return scalar(true);
   }
+
+  Result<std::string> Format(const std::vector<std::string>& values) const override {
+    return "";
+  }
 };
 
 /// \brief Subclass for looking up partition information from a dictionary
@@ -155,6 +167,12 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
   Result<std::shared_ptr<Expression>> Parse(const std::string& segment,
                                             int i) const override;
 
+  /// Check the values and format a path segment for each with FormatKey()
+  Result<std::string> Format(const std::vector<std::string>& values) const override;
+
+  /// Format the path segment of a partition key, the inverse of ParseKey()
+  virtual std::string FormatKey(const Key& key) const = 0;
+
  protected:
   using Partitioning::Partitioning;
 };
@@ -174,6 +192,8 @@ class ARROW_DS_EXPORT DirectoryPartitioning : public KeyValuePartitioning {
 
   util::optional<Key> ParseKey(const std::string& segment, int i) const override;
 
+  std::string FormatKey(const Key& key) const override { return key.value; }
+
   static std::shared_ptr<PartitioningFactory> MakeFactory(
       std::vector<std::string> field_names);
 };
@@ -200,6 +220,10 @@ class ARROW_DS_EXPORT HivePartitioning : public KeyValuePartitioning {
 
   static util::optional<Key> ParseKey(const std::string& segment);
 
+  std::string FormatKey(const Key& key) const override {
+    return key.name + "=" + key.value;
+  }
+
   static std::shared_ptr<PartitioningFactory> MakeFactory();
 };
 
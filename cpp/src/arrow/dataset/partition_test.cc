@@ -161,6 +161,33 @@ TEST_F(TestPartitioning, HivePartitioning) {
   AssertParseError("/alpha=0.0/beta=3.25");  // conversion of "0.0" to int32 fails
 }
 
+TEST_F(TestPartitioning, Format) {
+  auto fields = schema({field("alpha", int32()), field("beta", utf8())});
+
+  partitioning_ = std::make_shared<DirectoryPartitioning>(fields);
+  ASSERT_OK_AND_ASSIGN(auto path, partitioning_->Format({"0", "hello"}));
+  ASSERT_EQ(path, "0/hello");
+  AssertParse(path, "alpha"_ == int32_t(0) and "beta"_ == "hello");
+
+  partitioning_ = std::make_shared<HivePartitioning>(fields);
+  ASSERT_OK_AND_ASSIGN(path, partitioning_->Format({"3", "world"}));
+  ASSERT_EQ(path, "alpha=3/beta=world");
+  AssertParse(path, "alpha"_ == int32_t(3) and "beta"_ == "world");
+
+  ASSERT_RAISES(Invalid, partitioning_->Format({"3"}));         // missing beta
+  ASSERT_RAISES(Invalid, partitioning_->Format({"3", ""}));     // empty segment
+  ASSERT_RAISES(Invalid, partitioning_->Format({"3", "a/b"}));  // several segments
+  ASSERT_RAISES(Invalid, partitioning_->Format({"..", "b"}));
+
+  ASSERT_OK_AND_ASSIGN(path, Partitioning::Default()->Format({}));
+  ASSERT_EQ(path, "");
+
+  using Dict = std::unordered_map<std::string, std::shared_ptr<Expression>>;
+  partitioning_ =
+      std::make_shared<SegmentDictionaryPartitioning>(fields, std::vector<Dict>{});
+  ASSERT_RAISES(NotImplemented, partitioning_->Format({"0", "hello"}));
+}
+
 TEST_F(TestPartitioning, DiscoverHiveSchema) {
   factory_ = HivePartitioning::MakeFactory();
 
@@ -18,6 +18,8 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 
@@ -27,7 +29,6 @@
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
-#include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -42,6 +43,8 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
     std::shared_ptr<Schema> schema) const {
   auto copy = ScanOptions::Make(std::move(schema));
   copy->use_threads = use_threads;
+  copy->readahead_tasks = readahead_tasks;
+  copy->readahead_bytes = readahead_bytes;
   copy->filter = filter;
   copy->evaluator = evaluator;
   return copy;
@@ -133,6 +136,16 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::Readahead(int32_t readahead_tasks, int64_t readahead_bytes) {
+  if (readahead_tasks <= 0 || readahead_bytes <= 0) {
+    return Status::Invalid("Readahead limits must be positive, got ", readahead_tasks,
+                           " tasks and ", readahead_bytes, " bytes");
+  }
+  options_->readahead_tasks = readahead_tasks;
+  options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -142,64 +155,285 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!options->filter->Equals(true)) {
-    options->evaluator = std::make_shared<TreeEvaluator>();
+    options->evaluator = std::make_shared<SelectionEvaluator>();
   }
 
   return std::make_shared<Scanner>(dataset_->sources(), std::move(options), context_);
 }
 
-using arrow::internal::TaskGroup;
-
-std::shared_ptr<TaskGroup> Scanner::TaskGroup() const {
-  return options_->use_threads ? TaskGroup::MakeThreaded(context_->thread_pool)
-                               : TaskGroup::MakeSerial();
+// The size of the buffers referenced by an array, some of which may be shared
+static int64_t ArrayDataSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += ArrayDataSize(*data.dictionary->data());
+  }
+  return size;
 }
 
-struct TableAggregator {
-  void Append(std::shared_ptr<RecordBatch> batch) {
-    std::lock_guard<std::mutex> lock(m);
-    batches.emplace_back(std::move(batch));
+static int64_t RecordBatchSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += ArrayDataSize(*batch.column_data(i));
   }
+  return size;
+}
 
-  Result<std::shared_ptr<Table>> Finish(const std::shared_ptr<Schema>& schema) {
-    std::shared_ptr<Table> out;
-    RETURN_NOT_OK(Table::FromRecordBatches(schema, batches, &out));
-    return out;
+/// \brief Run ScanTasks on a thread pool ahead of the consumer and yield their
+/// RecordBatches in order.
+///
+/// Up to readahead_tasks ScanTasks are started, in order. A ScanTask pauses,
+/// releasing its thread, once the buffered batches exceed readahead_bytes, and
+/// is resumed by the consumer when enough batches are consumed. The ScanTask
+/// being consumed always runs while it has no buffered batch, so that the
+/// consumer makes progress.
+class ReadaheadScanIterator {
+ public:
+  ReadaheadScanIterator(ScanTaskIterator scan_tasks, internal::ThreadPool* pool,
+                        int32_t readahead_tasks, int64_t readahead_bytes)
+      : state_(std::make_shared<State>(std::move(scan_tasks), pool, readahead_tasks,
+                                       readahead_bytes)) {}
+
+  ReadaheadScanIterator(ReadaheadScanIterator&&) = default;
+  ReadaheadScanIterator& operator=(ReadaheadScanIterator&&) = default;
+
+  ~ReadaheadScanIterator() {
+    if (state_ != nullptr) {
+      state_->Stop();
+    }
   }
 
-  std::mutex m;
-  std::vector<std::shared_ptr<RecordBatch>> batches;
-};
+  Result<std::shared_ptr<RecordBatch>> Next() { return state_->Next(); }
+
+ private:
+  struct Task {
+    explicit Task(std::shared_ptr<ScanTask> scan_task)
+        : scan_task(std::move(scan_task)) {}
+
+    std::shared_ptr<ScanTask> scan_task;
+    // Only accessed by the running producer of this Task
+    RecordBatchIterator batch_it;
+    bool started = false;
 
-struct ScanTaskPromise {
-  Status operator()() {
-    ARROW_ASSIGN_OR_RAISE(auto it, task->Execute());
-    for (auto maybe_batch : it) {
-      ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
-      aggregator.Append(std::move(batch));
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool running = false;
+    bool done = false;
+    Status status;
+  };
+
+  struct State : std::enable_shared_from_this<State> {
+    State(ScanTaskIterator scan_tasks, internal::ThreadPool* pool,
+          int32_t readahead_tasks, int64_t readahead_bytes)
+        : scan_tasks(std::move(scan_tasks)),
+          pool(pool),
+          readahead_tasks(readahead_tasks),
+          readahead_bytes(readahead_bytes) {}
+
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!finished) {
+        ScheduleTasks(&lock);
+        if (tasks.empty()) {
+          finished = true;
+          break;
+        }
+
+        auto head = tasks.front();
+        if (!head->batches.empty()) {
+          auto batch = std::move(head->batches.front());
+          head->batches.pop_front();
+          buffered_bytes -= RecordBatchSize(*batch);
+          ScheduleTasks(&lock);
+          return batch;
+        }
+
+        if (head->done) {
+          tasks.pop_front();
+          if (!head->status.ok()) {
+            finished = stopped = true;
+            cv.notify_all();
+            return head->status;
+          }
+          continue;
+        }
+
+        cv.wait(lock, [&] {
+          return !head->batches.empty() || head->done || !head->running;
+        });
+      }
+      return nullptr;
     }
 
-    return Status::OK();
-  }
+    void Stop() {
+      std::unique_lock<std::mutex> lock(mutex);
+      stopped = true;
+      cv.wait(lock, [&] { return num_running == 0; });
+    }
+
+    // Start ScanTasks up to the readahead limits and resume the paused ones.
+    // Called with the lock held by the consumer.
+    void ScheduleTasks(std::unique_lock<std::mutex>* lock) {
+      for (auto& task : tasks) {
+        if (!stopped && !task->running && !task->done && CanProduce(*task)) {
+          Spawn(task);
+        }
+      }
+
+      while (!stopped && !scan_tasks_exhausted &&
+             static_cast<int32_t>(tasks.size()) < readahead_tasks &&
+             buffered_bytes < readahead_bytes) {
+        // Only the consumer touches the ScanTask iterator and the Task queue,
+        // release the lock while fragments are discovered.
+        lock->unlock();
+        auto maybe_scan_task = scan_tasks.Next();
+        lock->lock();
+
+        std::shared_ptr<Task> task;
+        if (!maybe_scan_task.ok()) {
+          // Yield the error in order, once the batches of the preceding
+          // ScanTasks are consumed
+          task = std::make_shared<Task>(nullptr);
+          task->done = true;
+          task->status = maybe_scan_task.status();
+          scan_tasks_exhausted = true;
+        } else if (*maybe_scan_task == nullptr) {
+          scan_tasks_exhausted = true;
+          break;
+        } else {
+          task = std::make_shared<Task>(maybe_scan_task.MoveValueUnsafe());
+        }
+
+        tasks.push_back(task);
+        if (!task->done) {
+          Spawn(task);
+        }
+      }
+    }
+
+    bool CanProduce(const Task& task) const {
+      return buffered_bytes < readahead_bytes ||
+             (&task == tasks.front().get() && task.batches.empty());
+    }
+
+    void Spawn(const std::shared_ptr<Task>& task) {
+      task->running = true;
+      ++num_running;
+      auto self = shared_from_this();
+      auto status = pool->Spawn([self, task] { self->Produce(task); });
+      if (!status.ok()) {
+        task->running = false;
+        task->done = true;
+        task->status = std::move(status);
+        --num_running;
+      }
+    }
+
+    // Read the batches of a Task until it is done or must pause. Run on the
+    // thread pool.
+    void Produce(const std::shared_ptr<Task>& task) {
+      Status status = ProduceBatches(task.get());
+      if (!status.ok()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        task->done = true;
+        task->status = std::move(status);
+        Release(task.get());
+      }
+    }
+
+    Status ProduceBatches(Task* task) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopped) {
+          Release(task);
+          return Status::OK();
+        }
+      }
+
+      if (!task->started) {
+        ARROW_ASSIGN_OR_RAISE(task->batch_it, task->scan_task->Execute());
+        task->started = true;
+      }
+
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, task->batch_it.Next());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (batch == nullptr) {
+          task->done = true;
+          Release(task);
+          return Status::OK();
+        }
+
+        buffered_bytes += RecordBatchSize(*batch);
+        task->batches.push_back(std::move(batch));
+        // Pausing must be decided in the same critical section as the consumer
+        // checks whether to resume the Task.
+        if (stopped || !CanProduce(*task)) {
+          Release(task);
+          return Status::OK();
+        }
+        cv.notify_all();
+      }
+    }
+
+    // Called with the lock held by the producer of a Task when it returns
+    void Release(Task* task) {
+      task->running = false;
+      --num_running;
+      cv.notify_all();
+    }
+
+    ScanTaskIterator scan_tasks;
+    internal::ThreadPool* pool;
+    const int32_t readahead_tasks;
+    const int64_t readahead_bytes;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    // The Tasks started and not yet consumed, in order
+    std::deque<std::shared_ptr<Task>> tasks;
+    int64_t buffered_bytes = 0;
+    int num_running = 0;
+    bool scan_tasks_exhausted = false;
+    bool stopped = false;
+    bool finished = false;
+  };
 
-  TableAggregator& aggregator;
-  std::shared_ptr<ScanTask> task;
+  std::shared_ptr<State> state_;
 };
 
-Result<std::shared_ptr<Table>> Scanner::ToTable() {
-  auto task_group = TaskGroup();
+Result<RecordBatchIterator> Scanner::ScanBatches() {
+  ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
 
-  TableAggregator aggregator;
-  ARROW_ASSIGN_OR_RAISE(auto it, Scan());
-  for (auto maybe_scan_task : it) {
-    ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
-    task_group->Append(ScanTaskPromise{aggregator, std::move(scan_task)});
+  if (!options_->use_threads) {
+    auto execute = [](std::shared_ptr<ScanTask> task) { return task->Execute(); };
+    return MakeFlattenIterator(MakeMaybeMapIterator(execute, std::move(scan_task_it)));
   }
 
-  // Wait for all tasks to complete, or the first error.
-  RETURN_NOT_OK(task_group->Finish());
+  return RecordBatchIterator(ReadaheadScanIterator(
+      std::move(scan_task_it), context_->thread_pool, options_->readahead_tasks,
+      options_->readahead_bytes));
+}
+
+Result<std::shared_ptr<Table>> Scanner::ToTable() {
+  ARROW_ASSIGN_OR_RAISE(auto batch_it, ScanBatches());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (auto maybe_batch : batch_it) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+    batches.push_back(std::move(batch));
+  }
 
-  return aggregator.Finish(options_->schema());
+  std::shared_ptr<Table> out;
+  RETURN_NOT_OK(Table::FromRecordBatches(options_->schema(), batches, &out));
+  return out;
 }
 
 }  // namespace dataset
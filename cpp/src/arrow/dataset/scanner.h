@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -35,12 +36,16 @@ namespace arrow {
 
 class Table;
 
-namespace internal {
-class TaskGroup;
-}
-
 namespace dataset {
 
+/// \brief Default number of scan tasks run ahead of the consumer of
+/// Scanner::ScanBatches
+constexpr int32_t kDefaultScanReadaheadTasks = 8;
+
+/// \brief Default number of bytes of record batches buffered ahead of the
+/// consumer of Scanner::ScanBatches
+constexpr int64_t kDefaultScanReadaheadBytes = 64 << 20;
+
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
   MemoryPool* pool = arrow::default_memory_pool();
@@ -62,6 +67,15 @@ class ARROW_DS_EXPORT ScanOptions {
   // ScanContext.
   bool use_threads = false;
 
+  // Maximum number of scan tasks run at once by Scanner::ScanBatches when
+  // use_threads is set. The batches of tasks which are not yet consumed are
+  // buffered.
+  int32_t readahead_tasks = kDefaultScanReadaheadTasks;
+
+  // Size of the buffered record batches beyond which Scanner::ScanBatches
+  // pauses its scan tasks until the consumer catches up.
+  int64_t readahead_bytes = kDefaultScanReadaheadBytes;
+
   // Filter
   std::shared_ptr<Expression> filter;
 
@@ -158,18 +172,32 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Stream the record batches of the Scan in order.
+  ///
+  /// Batches are yielded in the order of the ScanTasks returned by Scan(), and
+  /// in the order of each ScanTask, i.e. by fragment then by row group.
+  ///
+  /// If ScanOptions::use_threads is set, up to ScanOptions::readahead_tasks
+  /// ScanTasks run on the ScanContext's thread pool ahead of the consumer.
+  /// Once more than ScanOptions::readahead_bytes of batches are buffered, the
+  /// ScanTasks pause until the consumer catches up, so that memory use is
+  /// bounded regardless of the size of the dataset. Otherwise ScanTasks are
+  /// executed serially as batches are consumed.
+  ///
+  /// The first error of a ScanTask is returned once the batches of the
+  /// ScanTasks preceding it are consumed, and ends the stream. Destroying the
+  /// iterator stops the running ScanTasks.
+  Result<RecordBatchIterator> ScanBatches();
+
   /// \brief Convert a Scanner into a Table.
   ///
-  /// Use this convenience utility with care. This will serially materialize the
-  /// Scan result in memory before creating the Table.
+  /// Use this convenience utility with care. This will materialize the whole
+  /// Scan result in memory, in the order of ScanBatches().
   Result<std::shared_ptr<Table>> ToTable();
 
   std::shared_ptr<Schema> schema() const { return options_->schema(); }
 
  protected:
-  /// \brief Return a TaskGroup according to ScanContext thread rules.
-  std::shared_ptr<internal::TaskGroup> TaskGroup() const;
-
   SourceVector sources_;
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
@@ -212,6 +240,16 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Set how far ahead of the consumer a threaded Scanner::ScanBatches
+  ///        may run.
+  ///
+  /// \param[in] readahead_tasks maximum number of ScanTasks run at once
+  /// \param[in] readahead_bytes size of the buffered record batches beyond
+  ///            which ScanTasks pause
+  ///
+  /// \return Failure if either limit is not positive.
+  Status Readahead(int32_t readahead_tasks, int64_t readahead_bytes);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
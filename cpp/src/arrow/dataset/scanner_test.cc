@@ -17,17 +17,24 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <string>
+#include <thread>
 
 #include "arrow/compute/context.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
 class TestScanner : public DatasetFixtureMixin {
  protected:
   static constexpr int64_t kNumberSources = 2;
@@ -135,13 +142,224 @@ TEST_F(TestScanner, ToTable) {
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
 
-  // There is no guarantee on the ordering when using multiple threads, but
-  // since the RecordBatch is always the same it will pass.
   options_->use_threads = true;
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
 }
 
+// A ScanTask yielding the batches [first, first + num_batches) of a sequence,
+// where batch i holds the value i. Earlier batches take longer to produce, so
+// that threaded scans complete their ScanTasks out of order.
+class SequenceScanTask : public ScanTask {
+ public:
+  SequenceScanTask(int64_t first, int64_t num_batches, bool fail,
+                   std::shared_ptr<std::atomic<int64_t>> num_produced,
+                   std::shared_ptr<ScanOptions> options,
+                   std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        first_(first),
+        num_batches_(num_batches),
+        fail_(fail),
+        num_produced_(std::move(num_produced)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    auto schema = options_->schema();
+    auto num_produced = num_produced_;
+    int64_t i = first_;
+    const int64_t end = first_ + num_batches_;
+    const bool fail = fail_;
+
+    return MakeFunctionIterator(
+        [=]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+          if (i == end) {
+            if (fail) {
+              return Status::IOError("ScanTask failed after batch ", i - 1);
+            }
+            return nullptr;
+          }
+          std::this_thread::sleep_for(std::chrono::microseconds(1000 / (i + 1)));
+          ++*num_produced;
+          auto value = i++;
+          ARROW_ASSIGN_OR_RAISE(auto array, ArrayFromBuilderVisitor(
+                                                int64(), kRowsPerBatch,
+                                                [&](Int64Builder* builder) {
+                                                  builder->UnsafeAppend(value);
+                                                }));
+          return RecordBatch::Make(schema, kRowsPerBatch, {array});
+        });
+  }
+
+  static constexpr int64_t kRowsPerBatch = 64;
+
+ private:
+  int64_t first_;
+  int64_t num_batches_;
+  bool fail_;
+  std::shared_ptr<std::atomic<int64_t>> num_produced_;
+};
+
+constexpr int64_t SequenceScanTask::kRowsPerBatch;
+
+class SequenceFragment : public Fragment {
+ public:
+  SequenceFragment(int64_t first, int64_t num_tasks, int64_t batches_per_task,
+                   int64_t failing_task,
+                   std::shared_ptr<std::atomic<int64_t>> num_produced,
+                   std::shared_ptr<ScanOptions> options)
+      : Fragment(std::move(options)),
+        first_(first),
+        num_tasks_(num_tasks),
+        batches_per_task_(batches_per_task),
+        failing_task_(failing_task),
+        num_produced_(std::move(num_produced)) {}
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override {
+    ScanTaskVector tasks;
+    for (int64_t i = 0; i < num_tasks_; ++i) {
+      auto first = first_ + i * batches_per_task_;
+      tasks.push_back(std::make_shared<SequenceScanTask>(
+          first, batches_per_task_, first / batches_per_task_ == failing_task_,
+          num_produced_, scan_options_, context));
+    }
+    return MakeVectorIterator(std::move(tasks));
+  }
+
+  bool splittable() const override { return false; }
+
+ private:
+  int64_t first_;
+  int64_t num_tasks_;
+  int64_t batches_per_task_;
+  int64_t failing_task_;
+  std::shared_ptr<std::atomic<int64_t>> num_produced_;
+};
+
+class TestScanBatches : public DatasetFixtureMixin {
+ protected:
+  static constexpr int64_t kNumberFragments = 4;
+  static constexpr int64_t kTasksPerFragment = 4;
+  static constexpr int64_t kBatchesPerTask = 3;
+  static constexpr int64_t kNumberBatches =
+      kNumberFragments * kTasksPerFragment * kBatchesPerTask;
+
+  void SetUp() override { SetSchema({field("i", int64())}); }
+
+  // The ScanTask of index failing_task yields an error after its batches
+  Scanner MakeScanner(int64_t failing_task = -1) {
+    FragmentVector fragments;
+    for (int64_t i = 0; i < kNumberFragments; ++i) {
+      fragments.push_back(std::make_shared<SequenceFragment>(
+          i * kTasksPerFragment * kBatchesPerTask, kTasksPerFragment, kBatchesPerTask,
+          failing_task, num_produced_, options_));
+    }
+    SourceVector sources{std::make_shared<InMemorySource>(schema_, fragments)};
+    return Scanner{sources, options_, ctx_};
+  }
+
+  void AssertBatchValue(int64_t expected, const RecordBatch& batch) {
+    ASSERT_EQ(SequenceScanTask::kRowsPerBatch, batch.num_rows());
+    const auto& values = checked_cast<const Int64Array&>(*batch.column(0));
+    ASSERT_EQ(expected, values.Value(0));
+    ASSERT_EQ(expected, values.Value(batch.num_rows() - 1));
+  }
+
+  void AssertBatchesInOrder(Scanner* scanner) {
+    ASSERT_OK_AND_ASSIGN(auto it, scanner->ScanBatches());
+    for (int64_t i = 0; i < kNumberBatches; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+      ASSERT_NE(batch, nullptr) << "missing batch " << i;
+      AssertBatchValue(i, *batch);
+    }
+    ASSERT_OK_AND_ASSIGN(auto end, it.Next());
+    ASSERT_EQ(end, nullptr);
+  }
+
+  std::shared_ptr<std::atomic<int64_t>> num_produced_ =
+      std::make_shared<std::atomic<int64_t>>(0);
+};
+
+constexpr int64_t TestScanBatches::kNumberFragments;
+constexpr int64_t TestScanBatches::kTasksPerFragment;
+constexpr int64_t TestScanBatches::kBatchesPerTask;
+constexpr int64_t TestScanBatches::kNumberBatches;
+
+TEST_F(TestScanBatches, Ordered) {
+  auto scanner = MakeScanner();
+
+  options_->use_threads = false;
+  AssertBatchesInOrder(&scanner);
+
+  options_->use_threads = true;
+  AssertBatchesInOrder(&scanner);
+
+  const int64_t batch_size = SequenceScanTask::kRowsPerBatch * sizeof(int64_t);
+  for (int32_t readahead_tasks : {1, 2, 5, 64}) {
+    for (int64_t readahead_bytes : {int64_t(1), 3 * batch_size, int64_t(1) << 30}) {
+      SCOPED_TRACE("readahead_tasks = " + std::to_string(readahead_tasks) +
+                   ", readahead_bytes = " + std::to_string(readahead_bytes));
+      options_->readahead_tasks = readahead_tasks;
+      options_->readahead_bytes = readahead_bytes;
+      AssertBatchesInOrder(&scanner);
+    }
+  }
+}
+
+TEST_F(TestScanBatches, ToTableIsOrdered) {
+  options_->use_threads = true;
+  auto scanner = MakeScanner();
+  ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+  ASSERT_EQ(kNumberBatches * SequenceScanTask::kRowsPerBatch, table->num_rows());
+
+  TableBatchReader reader(*table);
+  for (int64_t i = 0; i < kNumberBatches; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader.ReadNext(&batch));
+    AssertBatchValue(i, *batch);
+  }
+}
+
+TEST_F(TestScanBatches, BackPressure) {
+  options_->use_threads = true;
+  options_->readahead_tasks = 4;
+  options_->readahead_bytes = 1;
+  auto scanner = MakeScanner();
+
+  {
+    ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatches());
+    for (int64_t i = 0; i < kNumberBatches / 2; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+      AssertBatchValue(i, *batch);
+
+      // Give the producers time to run ahead
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      // Each running ScanTask buffers at most one batch before pausing
+      ASSERT_LE(num_produced_->load(), i + 1 + options_->readahead_tasks);
+    }
+  }
+
+  // Destroying the iterator midway stopped the ScanTasks
+  auto num_produced = num_produced_->load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  ASSERT_EQ(num_produced, num_produced_->load());
+}
+
+TEST_F(TestScanBatches, ErrorIsOrdered) {
+  const int64_t failing_task = 6;
+  auto scanner = MakeScanner(failing_task);
+
+  for (bool use_threads : {false, true}) {
+    options_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto it, scanner.ScanBatches());
+    for (int64_t i = 0; i < (failing_task + 1) * kBatchesPerTask; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+      AssertBatchValue(i, *batch);
+    }
+    ASSERT_RAISES(IOError, it.Next());
+
+    ASSERT_RAISES(IOError, scanner.ToTable());
+  }
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     SourceVector sources;
@@ -189,6 +407,17 @@ TEST_F(TestScannerBuilder, TestFilter) {
                 builder.Filter("i64"_ == int64_t(10) || "not_a_column"_ == true));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.Readahead(1, 1));
+  ASSERT_OK(builder.Readahead(16, int64_t(1) << 32));
+
+  ASSERT_RAISES(Invalid, builder.Readahead(0, 1024));
+  ASSERT_RAISES(Invalid, builder.Readahead(4, 0));
+  ASSERT_RAISES(Invalid, builder.Readahead(-1, -1));
+}
+
 using testing::ElementsAre;
 using testing::IsEmpty;
 
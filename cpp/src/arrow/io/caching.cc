@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+
+CacheOptions CacheOptions::Defaults() {
+  // About the bandwidth-delay product of S3 as seen from EC2: reading 8 kB
+  // more costs less than a request's latency. Merged reads stay small
+  // enough to be issued concurrently.
+  return CacheOptions{/*hole_size_limit=*/8192,
+                      /*range_size_limit=*/32 * 1024 * 1024};
+}
+
+namespace internal {
+
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [](const ReadRange& range) { return range.length <= 0; }),
+               ranges.end());
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset;
+  });
+
+  std::vector<ReadRange> coalesced;
+  for (const auto& range : ranges) {
+    if (!coalesced.empty()) {
+      ReadRange& last = coalesced.back();
+      const int64_t last_end = last.offset + last.length;
+      const int64_t end = std::max(last_end, range.offset + range.length);
+      if (range.offset - last_end <= hole_size_limit &&
+          end - last.offset <= range_size_limit) {
+        last.length = end - last.offset;
+        continue;
+      }
+    }
+    coalesced.push_back(range);
+  }
+  return coalesced;
+}
+
+struct RangeCacheEntry {
+  ReadRange range;
+  std::shared_future<Result<std::shared_ptr<Buffer>>> future;
+};
+
+struct ReadRangeCache::Impl {
+  std::shared_ptr<RandomAccessFile> file;
+  CacheOptions options;
+
+  std::mutex mutex;
+  // Ordered by range offset
+  std::vector<RangeCacheEntry> entries;
+};
+
+ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file,
+                               CacheOptions options)
+    : impl_(new Impl()) {
+  impl_->file = std::move(file);
+  impl_->options = options;
+}
+
+ReadRangeCache::~ReadRangeCache() {
+  // Background reads refer to the file, not to the cache, and are left to
+  // complete
+}
+
+Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
+  ranges = CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
+                              impl_->options.range_size_limit);
+
+  auto pool = GetIOThreadPool();
+  std::vector<RangeCacheEntry> new_entries;
+  new_entries.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    std::shared_ptr<RandomAccessFile> file = impl_->file;
+    ARROW_ASSIGN_OR_RAISE(auto future, pool->Submit([file, range] {
+      return file->ReadAt(range.offset, range.length);
+    }));
+    new_entries.push_back({range, future.share()});
+  }
+
+  auto by_offset = [](const RangeCacheEntry& a, const RangeCacheEntry& b) {
+    return a.range.offset < b.range.offset;
+  };
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  auto& entries = impl_->entries;
+  const auto num_old_entries = entries.size();
+  entries.insert(entries.end(), std::make_move_iterator(new_entries.begin()),
+                 std::make_move_iterator(new_entries.end()));
+  std::inplace_merge(entries.begin(), entries.begin() + num_old_entries, entries.end(),
+                     by_offset);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
+  if (range.length == 0) {
+    return std::make_shared<Buffer>(nullptr, 0);
+  }
+
+  std::shared_future<Result<std::shared_ptr<Buffer>>> future;
+  ReadRange entry_range{};
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    const auto& entries = impl_->entries;
+    // Entries starting after the range cannot contain it; entries from
+    // separate Cache() calls may overlap, so look at all those before.
+    auto it = std::upper_bound(
+        entries.begin(), entries.end(), range.offset,
+        [](int64_t offset, const RangeCacheEntry& entry) {
+          return offset < entry.range.offset;
+        });
+    while (it != entries.begin()) {
+      --it;
+      if (it->range.Contains(range)) {
+        future = it->future;
+        entry_range = it->range;
+        break;
+      }
+    }
+  }
+  if (!future.valid()) {
+    return Status::Invalid("ReadRangeCache did not find matching cache entry for range (",
+                           range.offset, ", ", range.length, ")");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto buffer, future.get());
+  // The cached read is short if it extends past the end of the file
+  const int64_t slice_offset =
+      std::min(range.offset - entry_range.offset, buffer->size());
+  const int64_t slice_length = std::min(range.length, buffer->size() - slice_offset);
+  return SliceBuffer(std::move(buffer), slice_offset, slice_length);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
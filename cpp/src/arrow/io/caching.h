@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+/// \brief A region of a file, as given to RandomAccessFile::ReadAt()
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  bool operator==(const ReadRange& other) const {
+    return offset == other.offset && length == other.length;
+  }
+  bool operator!=(const ReadRange& other) const { return !(*this == other); }
+
+  bool Contains(const ReadRange& other) const {
+    return offset <= other.offset && other.offset + other.length <= offset + length;
+  }
+};
+
+/// \brief How to coalesce the ranges read ahead of time from a file
+struct ARROW_EXPORT CacheOptions {
+  /// Ranges separated by at most this many bytes are read together, along
+  /// with the bytes between them. Should be about the bandwidth-delay
+  /// product of the storage: the number of bytes which could have been
+  /// transferred during the latency of a separate request.
+  int64_t hole_size_limit;
+  /// Ranges are not merged past this size. Larger reads get less
+  /// concurrency and keep more unused bytes in memory.
+  int64_t range_size_limit;
+
+  /// Limits suited to object stores such as S3
+  static CacheOptions Defaults();
+};
+
+namespace internal {
+
+/// \brief Sort ranges and merge those closer than hole_size_limit
+///
+/// Empty ranges are dropped. A range longer than range_size_limit is kept
+/// as is, other ranges are only merged while the result fits in
+/// range_size_limit bytes.
+ARROW_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit);
+
+/// \brief A cache of ranges of a file, read concurrently ahead of time
+///
+/// Cache() coalesces the given ranges and starts reading them on the I/O
+/// thread pool. Read() then returns a slice of the cached buffer spanning
+/// a range, waiting for its read to complete if needed. Reads which take
+/// long because of latency rather than bandwidth, such as small reads on
+/// S3, are thus overlapped and issued in fewer requests.
+///
+/// Cache() and Read() may be called concurrently from several threads.
+class ARROW_EXPORT ReadRangeCache {
+ public:
+  ReadRangeCache(std::shared_ptr<RandomAccessFile> file, CacheOptions options);
+  ~ReadRangeCache();
+
+  /// \brief Start reading the given ranges in the background
+  Status Cache(std::vector<ReadRange> ranges);
+
+  /// \brief Return the bytes of a range covered by a previous Cache() call
+  ///
+  /// The buffer may be shorter than the range if the range extends past
+  /// the end of the file. Return Invalid if the range was not cached, and
+  /// any error encountered while reading it.
+  Result<std::shared_ptr<Buffer>> Read(ReadRange range);
+
+ protected:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
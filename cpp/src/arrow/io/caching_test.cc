@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+// A file over a buffer, counting the ReadAt() calls made on it
+class CountingFile : public RandomAccessFile {
+ public:
+  explicit CountingFile(std::shared_ptr<Buffer> buffer) : reader_(std::move(buffer)) {}
+
+  Status Close() override { return reader_.Close(); }
+  bool closed() const override { return reader_.closed(); }
+  Result<int64_t> Tell() const override { return reader_.Tell(); }
+  Status Seek(int64_t position) override { return reader_.Seek(position); }
+  Result<int64_t> GetSize() override { return reader_.GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return reader_.Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return reader_.Read(nbytes);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ++num_reads;
+    if (fail_reads) {
+      return Status::IOError("read failed");
+    }
+    return reader_.ReadAt(position, nbytes);
+  }
+
+  std::atomic<int> num_reads{0};
+  std::atomic<bool> fail_reads{false};
+
+ private:
+  BufferReader reader_;
+};
+
+void AssertRangesEqual(const std::vector<ReadRange>& expected,
+                       const std::vector<ReadRange>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].offset, actual[i].offset) << "range " << i;
+    ASSERT_EQ(expected[i].length, actual[i].length) << "range " << i;
+  }
+}
+
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges, std::vector<ReadRange> expected) {
+    AssertRangesEqual(expected, CoalesceReadRanges(ranges, /*hole_size_limit=*/10,
+                                                   /*range_size_limit=*/50));
+  };
+  check({}, {});
+  check({{110, 0}}, {});
+  check({{110, 11}}, {{110, 11}});
+  // Unsorted input
+  check({{150, 10}, {110, 10}}, {{110, 10}, {150, 10}});
+  // Holes up to hole_size_limit are read through
+  check({{110, 11}, {131, 5}}, {{110, 26}});
+  check({{110, 11}, {132, 5}}, {{110, 11}, {132, 5}});
+  // Adjacent and overlapping ranges
+  check({{110, 10}, {120, 10}, {125, 3}}, {{110, 20}});
+  // Merged ranges stay within range_size_limit
+  check({{110, 30}, {140, 20}, {160, 20}}, {{110, 50}, {160, 20}});
+  // Larger ranges are kept as is
+  check({{100, 70}, {172, 5}}, {{100, 70}, {172, 5}});
+}
+
+class TestReadRangeCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    std::string data;
+    for (int i = 0; i < 100; ++i) {
+      data.push_back(static_cast<char>(i));
+    }
+    data_ = Buffer::FromString(std::move(data));
+    file_ = std::make_shared<CountingFile>(data_);
+  }
+
+  void AssertRead(ReadRangeCache* cache, ReadRange range) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, cache->Read(range));
+    AssertBufferEqual(*buffer, *SliceBuffer(data_, range.offset, range.length));
+  }
+
+ protected:
+  std::shared_ptr<Buffer> data_;
+  std::shared_ptr<CountingFile> file_;
+};
+
+TEST_F(TestReadRangeCache, Basics) {
+  CacheOptions options{/*hole_size_limit=*/3, /*range_size_limit=*/10};
+  ReadRangeCache cache(file_, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}, {25, 0}}));
+  ASSERT_OK(cache.Cache({{30, 5}, {33, 4}}));
+  AssertRead(&cache, {1, 2});
+  AssertRead(&cache, {3, 2});
+  AssertRead(&cache, {8, 2});
+  AssertRead(&cache, {20, 2});
+  AssertRead(&cache, {30, 5});
+  AssertRead(&cache, {33, 4});
+  // Parts of cached ranges can be read too
+  AssertRead(&cache, {2, 7});
+  AssertRead(&cache, {25, 0});
+  // [1, 10), [20, 22) and [30, 37)
+  ASSERT_EQ(3, file_->num_reads);
+
+  ASSERT_RAISES(Invalid, cache.Read({0, 2}));
+  ASSERT_RAISES(Invalid, cache.Read({9, 2}));
+  ASSERT_RAISES(Invalid, cache.Read({22, 1}));
+  ASSERT_EQ(3, file_->num_reads);
+}
+
+TEST_F(TestReadRangeCache, OverlappingCacheCalls) {
+  CacheOptions options{/*hole_size_limit=*/0, /*range_size_limit=*/100};
+  ReadRangeCache cache(file_, options);
+
+  ASSERT_OK(cache.Cache({{10, 40}}));
+  ASSERT_OK(cache.Cache({{20, 5}}));
+  AssertRead(&cache, {20, 5});
+  AssertRead(&cache, {30, 10});
+  AssertRead(&cache, {10, 40});
+}
+
+TEST_F(TestReadRangeCache, PastEndOfFile) {
+  ReadRangeCache cache(file_, CacheOptions::Defaults());
+
+  ASSERT_OK(cache.Cache({{90, 20}}));
+  ASSERT_OK_AND_ASSIGN(auto buffer, cache.Read({95, 10}));
+  AssertBufferEqual(*buffer, *SliceBuffer(data_, 95, 5));
+  ASSERT_OK_AND_ASSIGN(buffer, cache.Read({105, 5}));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestReadRangeCache, ReadError) {
+  ReadRangeCache cache(file_, CacheOptions::Defaults());
+
+  file_->fail_reads = true;
+  ASSERT_OK(cache.Cache({{10, 5}}));
+  ASSERT_RAISES(IOError, cache.Read({10, 5}));
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -33,6 +33,7 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -255,6 +256,16 @@ Status ValidateRegion(int64_t offset, int64_t size) {
   return Status::OK();
 }
 
+// Reads mostly wait on the network or the disk, so the pool can be larger
+// than the number of cores
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+::arrow::internal::ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<::arrow::internal::ThreadPool> singleton =
+      *::arrow::internal::ThreadPool::MakeEternal(kDefaultIOThreadPoolCapacity);
+  return singleton.get();
+}
+
 #ifndef NDEBUG
 
 // Debug mode concurrency checking
@@ -313,5 +324,12 @@ void SharedExclusiveChecker::UnlockExclusive() {}
 #endif
 
 }  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace io
 }  // namespace arrow
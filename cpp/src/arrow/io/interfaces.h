@@ -290,5 +290,18 @@ ARROW_EXPORT
 Result<Iterator<std::shared_ptr<Buffer>>> MakeInputStreamIterator(
     std::shared_ptr<InputStream> stream, int64_t block_size);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches I/O-bound tasks, such as the concurrent reads issued
+/// by read range caches.
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// High latency filesystems may benefit from more threads than there are
+/// CPU cores.
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 }  // namespace io
 }  // namespace arrow
@@ -21,6 +21,12 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace io {
 namespace internal {
 
@@ -38,6 +44,10 @@ ARROW_EXPORT Status ValidateWriteRegion(int64_t offset, int64_t size, int64_t fi
 // knowing the file size.
 ARROW_EXPORT Status ValidateRegion(int64_t offset, int64_t size);
 
+// Return the process-global thread pool for IO-bound tasks, such as
+// concurrent ReadAt() calls on high latency filesystems.
+ARROW_EXPORT ::arrow::internal::ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
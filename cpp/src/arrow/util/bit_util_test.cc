@@ -1075,6 +1075,28 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::MAX_VLQ_BYTE_LEN_64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  ASSERT_TRUE(writer.PutZigZagVlqInt(v));
+  int64_t result;
+  ASSERT_TRUE(reader.GetZigZagVlqInt(&result));
+  ASSERT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int32_t>::max());
+  TestZigZag64(std::numeric_limits<int32_t>::min());
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_default.h"
+#include "arrow/util/bpacking_simd_internal.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <int (*UnpackSimd)(const uint32_t*, uint32_t*, int, int)>
+int UnpackWithTail(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const int num_unpacked = UnpackSimd(in, out, batch_size, num_bits);
+  unpack32_default(in + num_unpacked / 32 * num_bits, out + num_unpacked,
+                   batch_size - num_unpacked, num_bits);
+  return batch_size;
+}
+
+using UnpackFunc = int (*)(const uint32_t*, uint32_t*, int, int);
+
+UnpackFunc ResolveUnpack() {
+  auto cpu_info = CpuInfo::GetInstance();
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (cpu_info->IsSupported(CpuInfo::AVX512)) {
+    return UnpackWithTail<unpack32_avx512>;
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (cpu_info->IsSupported(CpuInfo::AVX2)) {
+    return UnpackWithTail<unpack32_avx2>;
+  }
+#endif
+  ARROW_UNUSED(cpu_info);
+  return unpack32_default;
+}
+
+}  // namespace
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  static const UnpackFunc unpack = ResolveUnpack();
+  return unpack(in, out, batch_size, num_bits);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, it must not include headers
+// defining inline functions used elsewhere.
+
+#include <immintrin.h>
+
+#include <cstdint>
+
+#include "arrow/util/bpacking_simd_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <int kBits>
+using Layout = UnpackLayout<8, kBits>;
+
+#define LANES(FUNC)                                                                   \
+  FUNC(kGroup, 0), FUNC(kGroup, 1), FUNC(kGroup, 2), FUNC(kGroup, 3), FUNC(kGroup, 4), \
+      FUNC(kGroup, 5), FUNC(kGroup, 6), FUNC(kGroup, 7)
+
+// Unpack 8 values: gather the words holding each value in its lane, then
+// shift and mask them
+template <int kBits, int kGroup>
+inline void UnpackGroup(const uint32_t* in, uint32_t* out, __m256i mask) {
+  const __m256i words = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(in + Layout<kBits>::FirstWord(kGroup)));
+  const __m256i lo = _mm256_permutevar8x32_epi32(
+      words, _mm256_setr_epi32(LANES(Layout<kBits>::LoIndex)));
+  const __m256i hi = _mm256_permutevar8x32_epi32(
+      words, _mm256_setr_epi32(LANES(Layout<kBits>::HiIndex)));
+  const __m256i shift = _mm256_setr_epi32(LANES(Layout<kBits>::Shift));
+  // Shifting left by 32 yields 0
+  const __m256i hi_shift = _mm256_sub_epi32(_mm256_set1_epi32(32), shift);
+  const __m256i values =
+      _mm256_or_si256(_mm256_srlv_epi32(lo, shift), _mm256_sllv_epi32(hi, hi_shift));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * kGroup),
+                      _mm256_and_si256(values, mask));
+}
+
+#undef LANES
+
+template <int kBits>
+int UnpackBlocks(const uint32_t* in, uint32_t* out, int num_blocks) {
+  static_assert(Layout<kBits>::kSupported, "values span too many words");
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>((1U << kBits) - 1));
+  const int64_t num_words = static_cast<int64_t>(num_blocks) * kBits;
+  for (int i = 0; i < num_blocks; ++i) {
+    // Leave the blocks close to the end of the input to the scalar version
+    if (static_cast<int64_t>(i) * kBits + Layout<kBits>::kWordsRead > num_words) {
+      return i * 32;
+    }
+    UnpackGroup<kBits, 0>(in, out, mask);
+    UnpackGroup<kBits, 1>(in, out, mask);
+    UnpackGroup<kBits, 2>(in, out, mask);
+    UnpackGroup<kBits, 3>(in, out, mask);
+    in += kBits;
+    out += 32;
+  }
+  return num_blocks * 32;
+}
+
+}  // namespace
+
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  const int num_blocks = batch_size / 32;
+  switch (num_bits) {
+#define UNPACK_CASE(BITS) \
+  case BITS:              \
+    return UnpackBlocks<BITS>(in, out, num_blocks);
+    UNPACK_CASE(1)
+    UNPACK_CASE(2)
+    UNPACK_CASE(3)
+    UNPACK_CASE(4)
+    UNPACK_CASE(5)
+    UNPACK_CASE(6)
+    UNPACK_CASE(7)
+    UNPACK_CASE(8)
+    UNPACK_CASE(9)
+    UNPACK_CASE(10)
+    UNPACK_CASE(11)
+    UNPACK_CASE(12)
+    UNPACK_CASE(13)
+    UNPACK_CASE(14)
+    UNPACK_CASE(15)
+    UNPACK_CASE(16)
+    UNPACK_CASE(17)
+    UNPACK_CASE(18)
+    UNPACK_CASE(19)
+    UNPACK_CASE(20)
+    UNPACK_CASE(21)
+    UNPACK_CASE(22)
+    UNPACK_CASE(23)
+    UNPACK_CASE(24)
+    UNPACK_CASE(25)
+    UNPACK_CASE(26)
+    UNPACK_CASE(27)
+    UNPACK_CASE(28)
+#undef UNPACK_CASE
+    default:
+      // Wider values span more than the 8 words a lane permutation reads
+      return 0;
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
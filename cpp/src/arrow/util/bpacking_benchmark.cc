@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_default.h"
+#include "arrow/util/bpacking_simd_internal.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace internal {
+
+constexpr int kNumValues = 64 * 1024;
+
+using UnpackFunc = int (*)(const uint32_t*, uint32_t*, int, int);
+
+static void BenchmarkUnpack(benchmark::State& state,  // NOLINT non-const reference
+                            UnpackFunc unpack) {
+  const int num_bits = static_cast<int>(state.range(0));
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<uint32_t> dist;
+  std::vector<uint32_t> packed(kNumValues / 32 * num_bits);
+  for (auto& word : packed) {
+    word = dist(rng);
+  }
+  std::vector<uint32_t> out(kNumValues);
+
+  for (auto _ : state) {
+    auto num_unpacked = unpack(packed.data(), out.data(), kNumValues, num_bits);
+    benchmark::DoNotOptimize(num_unpacked);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+// A SIMD kernel followed by the scalar version for the remaining values, as
+// dispatched by unpack32()
+template <int (*UnpackSimd)(const uint32_t*, uint32_t*, int, int)>
+int UnpackSimdWithTail(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  const int num_unpacked = UnpackSimd(in, out, batch_size, num_bits);
+  unpack32_default(in + num_unpacked / 32 * num_bits, out + num_unpacked,
+                   batch_size - num_unpacked, num_bits);
+  return batch_size;
+}
+
+static void UnpackDefault(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack(state, unpack32_default);
+}
+
+static void UnpackDispatched(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack(state, unpack32);
+}
+
+#define UNPACK_ARGS \
+  ->DenseRange(1, 8)->Arg(12)->Arg(16)->Arg(20)->Arg(24)->Arg(28)->Arg(32)
+
+BENCHMARK(UnpackDefault) UNPACK_ARGS;
+BENCHMARK(UnpackDispatched) UNPACK_ARGS;
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+static void UnpackAVX2(benchmark::State& state) {  // NOLINT non-const reference
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    state.SkipWithError("CPU does not support AVX2");
+    return;
+  }
+  BenchmarkUnpack(state, UnpackSimdWithTail<unpack32_avx2>);
+}
+
+BENCHMARK(UnpackAVX2) UNPACK_ARGS;
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+static void UnpackAVX512(benchmark::State& state) {  // NOLINT non-const reference
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    state.SkipWithError("CPU does not support AVX-512");
+    return;
+  }
+  BenchmarkUnpack(state, UnpackSimdWithTail<unpack32_avx512>);
+}
+
+BENCHMARK(UnpackAVX512) UNPACK_ARGS;
+#endif
+
+#undef UNPACK_ARGS
+
+}  // namespace internal
+}  // namespace arrow
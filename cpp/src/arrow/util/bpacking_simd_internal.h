@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+// SIMD implementations of unpack32(), only compiled when the compiler
+// supports the instruction set, and only called when the CPU does.
+//
+// They unpack as many blocks of 32 values as they can without reading past
+// the end of the input, and return the number of values unpacked. The
+// remaining values, if any, are left to unpack32_default(). Widths which
+// are not supported return 0.
+
+ARROW_EXPORT
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+
+ARROW_EXPORT
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+
+// Where the values of a block of 32 values of kBits bits are, for kernels
+// unpacking kLanes values at a time: the value of lane `lane` of group
+// `group` of kLanes values is made of the word at LoIndex() shifted right by
+// Shift(), and of the word at HiIndex() shifted left by 32 - Shift(), word
+// indices being relative to FirstWord() of the group.
+template <int kLanes, int kBits>
+struct UnpackLayout {
+  static constexpr int kNumGroups = 32 / kLanes;
+
+  static constexpr int BitOffset(int group, int lane) {
+    return (group * kLanes + lane) * kBits;
+  }
+
+  static constexpr int FirstWord(int group) { return BitOffset(group, 0) / 32; }
+
+  static constexpr int LoIndex(int group, int lane) {
+    return BitOffset(group, lane) / 32 - FirstWord(group);
+  }
+
+  // The high word is not needed when the value does not cross a word
+  // boundary, it is then clamped to stay in the group's words
+  static constexpr int HiIndex(int group, int lane) {
+    return LoIndex(group, lane) + 1 < kLanes ? LoIndex(group, lane) + 1 : kLanes - 1;
+  }
+
+  static constexpr int Shift(int group, int lane) { return BitOffset(group, lane) % 32; }
+
+  // Words read from the start of a block, a group reading kLanes words
+  static constexpr int kWordsRead = FirstWord(kNumGroups - 1) + kLanes;
+
+  // Whether the values of each group come from kLanes words
+  static constexpr bool kSupported = kBits > 0 && (31 + kLanes * kBits) <= 32 * kLanes;
+};
+
+}  // namespace internal
+}  // namespace arrow
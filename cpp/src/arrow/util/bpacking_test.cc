@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_default.h"
+#include "arrow/util/bpacking_simd_internal.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+using UnpackFunc = int (*)(const uint32_t*, uint32_t*, int, int);
+
+// Random values packed with num_bits bits, without padding past the end
+std::vector<uint32_t> PackRandomValues(int num_values, int num_bits,
+                                       std::vector<uint32_t>* values) {
+  std::default_random_engine rng(42 + num_bits);
+  std::uniform_int_distribution<uint32_t> dist;
+  const uint32_t mask = num_bits == 32 ? ~0U : (1U << num_bits) - 1;
+  std::vector<uint32_t> packed((static_cast<int64_t>(num_values) * num_bits + 31) / 32);
+  values->resize(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    const uint32_t value = dist(rng) & mask;
+    (*values)[i] = value;
+    const int64_t bit = static_cast<int64_t>(i) * num_bits;
+    const int word = static_cast<int>(bit / 32);
+    const int shift = static_cast<int>(bit % 32);
+    if (num_bits == 0) continue;
+    packed[word] |= value << shift;
+    if (shift + num_bits > 32) {
+      packed[word + 1] |= value >> (32 - shift);
+    }
+  }
+  return packed;
+}
+
+void CheckUnpack(UnpackFunc unpack) {
+  for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+    for (int num_values : {0, 1, 31, 32, 64, 96, 320, 1000, 1024}) {
+      std::vector<uint32_t> values;
+      const auto packed = PackRandomValues(num_values, num_bits, &values);
+      std::vector<uint32_t> out(num_values, 0xdeadbeef);
+      ASSERT_EQ(num_values / 32 * 32,
+                unpack(packed.data(), out.data(), num_values, num_bits));
+      for (int i = 0; i < num_values / 32 * 32; ++i) {
+        ASSERT_EQ(values[i], out[i])
+            << "num_bits=" << num_bits << " num_values=" << num_values << " i=" << i;
+      }
+      for (int i = num_values / 32 * 32; i < num_values; ++i) {
+        ASSERT_EQ(0xdeadbeef, out[i]) << "value past the last block was written";
+      }
+    }
+  }
+}
+
+// A SIMD kernel followed by the scalar version for the remaining values
+template <int (*UnpackSimd)(const uint32_t*, uint32_t*, int, int)>
+int UnpackSimdWithTail(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  const int num_unpacked = UnpackSimd(in, out, batch_size, num_bits);
+  EXPECT_EQ(0, num_unpacked % 32);
+  EXPECT_LE(num_unpacked, batch_size);
+  unpack32_default(in + num_unpacked / 32 * num_bits, out + num_unpacked,
+                   batch_size - num_unpacked, num_bits);
+  return batch_size;
+}
+
+}  // namespace
+
+TEST(BitUnpack, Default) { CheckUnpack(unpack32_default); }
+
+TEST(BitUnpack, Dispatched) { CheckUnpack(unpack32); }
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+TEST(BitUnpack, AVX2) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    // Nothing to test on this CPU
+    return;
+  }
+  CheckUnpack(UnpackSimdWithTail<unpack32_avx2>);
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+TEST(BitUnpack, AVX512) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    return;
+  }
+  CheckUnpack(UnpackSimdWithTail<unpack32_avx512>);
+}
+#endif
+
+}  // namespace internal
+}  // namespace arrow
@@ -125,6 +125,7 @@ static struct {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
     {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},     {"avx512f", CpuInfo::AVX512},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -198,6 +199,18 @@ bool RetrieveCacheSize(int64_t* cache_sizes) {
   return true;
 }
 
+// Return the extended control register XCR0, whose bits tell which register
+// states the OS saves on context switches
+static uint64_t ReadXCR0() {
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
 bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (!hardware_flags || !model_name) {
     return false;
@@ -235,6 +248,26 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // AVX2 and AVX-512 instructions fault unless the OS saves the YMM state,
+  // and for AVX-512 the opmask and ZMM states too. The OS enables XGETBV
+  // (OSXSAVE) to report them.
+  bool os_saves_ymm = false;
+  bool os_saves_zmm = false;
+  if (features_ECX[27]) {
+    const uint64_t xcr0 = ReadXCR0();
+    os_saves_ymm = (xcr0 & 0x6) == 0x6;
+    os_saves_zmm = os_saves_ymm && (xcr0 & 0xe0) == 0xe0;
+  }
+
+  // Structured extended feature flags
+  const int register_EBX_id = 7;
+  if (highest_valid_id >= register_EBX_id) {
+    __cpuidex(cpu_info.data(), register_EBX_id, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[5] && os_saves_ymm) *hardware_flags |= CpuInfo::AVX2;
+    if (features_EBX[16] && os_saves_zmm) *hardware_flags |= CpuInfo::AVX512;
+  }
   return true;
 }
 #endif
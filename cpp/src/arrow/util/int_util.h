@@ -97,6 +97,56 @@ bool HasAdditionOverflow(Integer value, Integer addend) {
   return (value > std::numeric_limits<Integer>::max() - addend);
 }
 
+/// Integer addition, subtraction and multiplication returning true on overflow,
+/// in which case *out holds the wrapped around result
+#if defined(__GNUC__) || defined(__clang__)
+
+template <typename Integer>
+bool AddWithOverflow(Integer u, Integer v, Integer* out) {
+  return __builtin_add_overflow(u, v, out);
+}
+
+template <typename Integer>
+bool SubtractWithOverflow(Integer u, Integer v, Integer* out) {
+  return __builtin_sub_overflow(u, v, out);
+}
+
+template <typename Integer>
+bool MultiplyWithOverflow(Integer u, Integer v, Integer* out) {
+  return __builtin_mul_overflow(u, v, out);
+}
+
+#else
+
+template <typename Integer>
+bool AddWithOverflow(Integer u, Integer v, Integer* out) {
+  using UnsignedInt = typename std::make_unsigned<decltype(u + v)>::type;
+  *out = static_cast<Integer>(static_cast<UnsignedInt>(u) + static_cast<UnsignedInt>(v));
+  return std::is_signed<Integer>::value ? ((u ^ *out) & (v ^ *out)) < 0 : *out < u;
+}
+
+template <typename Integer>
+bool SubtractWithOverflow(Integer u, Integer v, Integer* out) {
+  using UnsignedInt = typename std::make_unsigned<decltype(u - v)>::type;
+  *out = static_cast<Integer>(static_cast<UnsignedInt>(u) - static_cast<UnsignedInt>(v));
+  return std::is_signed<Integer>::value ? ((u ^ v) & (u ^ *out)) < 0 : u < v;
+}
+
+template <typename Integer>
+bool MultiplyWithOverflow(Integer u, Integer v, Integer* out) {
+  using UnsignedInt = typename std::make_unsigned<decltype(u * v)>::type;
+  *out = static_cast<Integer>(static_cast<UnsignedInt>(u) * static_cast<UnsignedInt>(v));
+  if (u == 0 || v == 0) {
+    return false;
+  }
+  if (std::is_signed<Integer>::value && v == -1) {
+    return u == std::numeric_limits<Integer>::min();
+  }
+  return *out / v != u;
+}
+
+#endif
+
 /// Upcast an integer to the largest possible width (currently 64 bits)
 
 template <typename Integer>
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <utility>
 #include <vector>
@@ -382,5 +383,43 @@ TEST(TransposeInts, Int8ToInt64) {
   ASSERT_EQ(dest, std::vector<int64_t>({2222, 4444, 6666, 1111, 4444, 3333}));
 }
 
+TEST(OverflowArithmetic, Signed) {
+  int8_t out;
+  ASSERT_FALSE(AddWithOverflow<int8_t>(100, 27, &out));
+  ASSERT_EQ(127, out);
+  ASSERT_TRUE(AddWithOverflow<int8_t>(100, 28, &out));
+  ASSERT_EQ(-128, out);
+  ASSERT_FALSE(SubtractWithOverflow<int8_t>(-100, 28, &out));
+  ASSERT_EQ(-128, out);
+  ASSERT_TRUE(SubtractWithOverflow<int8_t>(0, -128, &out));
+  ASSERT_FALSE(MultiplyWithOverflow<int8_t>(-64, 2, &out));
+  ASSERT_EQ(-128, out);
+  ASSERT_TRUE(MultiplyWithOverflow<int8_t>(-128, -1, &out));
+
+  int64_t out64;
+  const auto max64 = std::numeric_limits<int64_t>::max();
+  ASSERT_TRUE(AddWithOverflow<int64_t>(max64, 1, &out64));
+  ASSERT_EQ(std::numeric_limits<int64_t>::min(), out64);
+  ASSERT_TRUE(MultiplyWithOverflow<int64_t>(max64 / 2 + 1, 2, &out64));
+  ASSERT_FALSE(MultiplyWithOverflow<int64_t>(max64 / 2, -2, &out64));
+  ASSERT_EQ(-max64 + 1, out64);
+}
+
+TEST(OverflowArithmetic, Unsigned) {
+  uint16_t out;
+  ASSERT_FALSE(AddWithOverflow<uint16_t>(65000, 535, &out));
+  ASSERT_EQ(65535, out);
+  ASSERT_TRUE(AddWithOverflow<uint16_t>(65000, 536, &out));
+  ASSERT_EQ(0, out);
+  ASSERT_TRUE(SubtractWithOverflow<uint16_t>(1, 2, &out));
+  ASSERT_EQ(65535, out);
+  ASSERT_TRUE(MultiplyWithOverflow<uint16_t>(256, 256, &out));
+  ASSERT_EQ(0, out);
+
+  uint64_t out64;
+  ASSERT_FALSE(MultiplyWithOverflow<uint64_t>(1ULL << 32, (1ULL << 32) - 1, &out64));
+  ASSERT_TRUE(MultiplyWithOverflow<uint64_t>(1ULL << 32, 1ULL << 32, &out64));
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -137,6 +137,36 @@ TEST(BitArray, TestValues) {
   }
 }
 
+// Writes values wider than 32 bits, spanning the words of the buffer
+TEST(BitArray, TestWideValues) {
+  const int num_vals = 100;
+  for (int width = 33; width <= 64; ++width) {
+    const uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+    std::vector<uint64_t> values;
+    for (int i = 0; i < num_vals; ++i) {
+      values.push_back((0x9E3779B97F4A7C15ULL * (i + 1)) & mask);
+    }
+    const int len = static_cast<int>(BitUtil::BytesForBits(width * num_vals));
+    std::vector<uint8_t> buffer(len);
+    BitUtil::BitWriter writer(buffer.data(), len);
+    for (uint64_t value : values) {
+      ASSERT_TRUE(writer.PutValue(value, width));
+    }
+    writer.Flush();
+    ASSERT_EQ(len, writer.bytes_written());
+
+    BitUtil::BitReader reader(buffer.data(), len);
+    uint64_t first = 0;
+    ASSERT_TRUE(reader.GetValue(width, &first));
+    ASSERT_EQ(values[0], first) << "width " << width;
+    std::vector<uint64_t> rest(num_vals - 1);
+    ASSERT_EQ(num_vals - 1, reader.GetBatch(width, rest.data(), num_vals - 1));
+    for (int i = 1; i < num_vals; ++i) {
+      ASSERT_EQ(values[i], rest[i - 1]) << "width " << width << ", value " << i;
+    }
+  }
+}
+
 // Test some mixed values
 TEST(BitArray, TestMixed) {
   const int len = 1024;
@@ -54,10 +54,14 @@ struct ThreadPool::State {
   bool quick_shutdown_;
 };
 
+// The state of the pool owning the current thread, if any
+static thread_local ThreadPool::State* current_thread_pool_state = nullptr;
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
                        std::list<std::thread>::iterator it) {
+  current_thread_pool_state = state.get();
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
@@ -182,6 +186,8 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
+bool ThreadPool::OwnsThisThread() { return current_thread_pool_state == state_; }
+
 int ThreadPool::GetActualCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -286,9 +292,8 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
-// Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
-  std::shared_ptr<ThreadPool> pool = *ThreadPool::Make(ThreadPool::DefaultCapacity());
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
+  ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -299,6 +304,11 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return pool;
 }
 
+// Helper for the singleton pattern
+std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+  return *ThreadPool::MakeEternal(ThreadPool::DefaultCapacity());
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
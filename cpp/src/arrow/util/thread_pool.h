@@ -78,6 +78,10 @@ class ARROW_EXPORT ThreadPool {
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
 
+  // Like Make(), but for pools that live until process exit (see
+  // GetCpuThreadPool())
+  static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -91,6 +95,11 @@ class ARROW_EXPORT ThreadPool {
   // thread count is fully adjusted.
   Status SetCapacity(int threads);
 
+  // Return true if the current thread is one of this pool's workers.
+  // A task waiting on other tasks of the same pool should run them inline
+  // instead, as all workers may end up waiting.
+  bool OwnsThisThread();
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -295,6 +295,17 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, OwnsThisThread) {
+  auto pool = this->MakeThreadPool(2);
+  auto other_pool = this->MakeThreadPool(2);
+  ASSERT_FALSE(pool->OwnsThisThread());
+
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([&] {
+    return std::make_pair(pool->OwnsThisThread(), other_pool->OwnsThisThread());
+  }));
+  ASSERT_EQ(std::make_pair(true, false), fut.get());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
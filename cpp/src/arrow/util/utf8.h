@@ -172,6 +172,85 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Return whether all bytes are ASCII, in which case bytes and characters
+// coincide.
+inline bool ValidateAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  uint64_t mask;
+
+  while (size >= 8) {
+    memcpy(&mask, data, 8);
+    if (ARROW_PREDICT_FALSE((mask & high_bits_64) != 0)) {
+      return false;
+    }
+    size -= 8;
+    data += 8;
+  }
+  uint8_t tail = 0;
+  while (size-- > 0) {
+    tail |= *data++;
+  }
+  return (tail & 0x80) == 0;
+}
+
+// Decode the character starting at *data and advance *data past it.
+// Return false on an invalid or truncated sequence, in which case *data
+// is advanced by one byte and *codepoint holds that byte.
+inline bool UTF8Decode(const uint8_t** data, const uint8_t* end, uint32_t* codepoint) {
+  const uint8_t* str = *data;
+  const uint32_t lead = *str;
+  int64_t num_bytes;
+  if (lead < 0x80) {
+    *codepoint = lead;
+    *data = str + 1;
+    return true;
+  } else if ((lead & 0xe0) == 0xc0) {
+    num_bytes = 2;
+    *codepoint = lead & 0x1f;
+  } else if ((lead & 0xf0) == 0xe0) {
+    num_bytes = 3;
+    *codepoint = lead & 0x0f;
+  } else if ((lead & 0xf8) == 0xf0) {
+    num_bytes = 4;
+    *codepoint = lead & 0x07;
+  } else {
+    num_bytes = 0;
+  }
+  bool valid = num_bytes > 0 && end - str >= num_bytes;
+  for (int64_t i = 1; valid && i < num_bytes; ++i) {
+    valid = (str[i] & 0xc0) == 0x80;
+    *codepoint = (*codepoint << 6) | (str[i] & 0x3f);
+  }
+  if (ARROW_PREDICT_FALSE(!valid)) {
+    *codepoint = lead;
+    *data = str + 1;
+    return false;
+  }
+  *data = str + num_bytes;
+  return true;
+}
+
+// Encode a character, returning the end of the written sequence (up to
+// 4 bytes).
+inline uint8_t* UTF8Encode(uint8_t* out, uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    *out++ = static_cast<uint8_t>(codepoint);
+  } else if (codepoint < 0x800) {
+    *out++ = static_cast<uint8_t>(0xc0 | (codepoint >> 6));
+    *out++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+  } else if (codepoint < 0x10000) {
+    *out++ = static_cast<uint8_t>(0xe0 | (codepoint >> 12));
+    *out++ = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3f));
+    *out++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+  } else {
+    *out++ = static_cast<uint8_t>(0xf0 | (codepoint >> 18));
+    *out++ = static_cast<uint8_t>(0x80 | ((codepoint >> 12) & 0x3f));
+    *out++ = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3f));
+    *out++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+  }
+  return out;
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
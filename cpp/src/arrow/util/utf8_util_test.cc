@@ -251,6 +251,52 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST(ValidateAscii, Basics) {
+  auto Check = [](const std::string& s) {
+    return ValidateAscii(reinterpret_cast<const uint8_t*>(s.data()),
+                         static_cast<int64_t>(s.size()));
+  };
+  ASSERT_TRUE(Check(""));
+  ASSERT_TRUE(Check("abc"));
+  ASSERT_TRUE(Check("0123456789abcdefghij"));
+  ASSERT_FALSE(Check("\xc3\xa9"));
+  ASSERT_FALSE(Check("0123456789abcdef\x80"));
+  ASSERT_FALSE(Check("\xff0123456789abcdef"));
+}
+
+TEST(UTF8Decode, RoundTrip) {
+  for (uint32_t codepoint : {0x0u, 0x41u, 0x7fu, 0x80u, 0xe9u, 0x7ffu, 0x800u, 0x20acu,
+                             0xffffu, 0x10000u, 0x1f600u, 0x10ffffu}) {
+    uint8_t buf[4];
+    uint8_t* end = UTF8Encode(buf, codepoint);
+    ASSERT_EQ(end - buf, codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2
+                                          : codepoint < 0x10000 ? 3 : 4);
+    ASSERT_TRUE(ValidateUTF8(buf, end - buf));
+    const uint8_t* data = buf;
+    uint32_t decoded;
+    ASSERT_TRUE(UTF8Decode(&data, end, &decoded));
+    ASSERT_EQ(codepoint, decoded);
+    ASSERT_EQ(end, data);
+  }
+}
+
+TEST(UTF8Decode, Invalid) {
+  auto CheckInvalid = [](const std::string& s) {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(s.data());
+    const uint8_t* data = begin;
+    uint32_t codepoint;
+    ASSERT_FALSE(UTF8Decode(&data, begin + s.size(), &codepoint));
+    ASSERT_EQ(begin + 1, data);
+    ASSERT_EQ(static_cast<uint8_t>(s[0]), codepoint);
+  };
+  CheckInvalid("\x80");
+  CheckInvalid("\xff");
+  CheckInvalid("\xc3");
+  CheckInvalid("\xc3\x28");
+  CheckInvalid("\xe2\x82");
+  CheckInvalid("\xf0\x9f\x98");
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
@@ -38,6 +38,7 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
@@ -47,6 +48,7 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/test_util.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
 #include "parquet/test_util.h"
@@ -1983,6 +1985,179 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderThreaded) {
+  const int num_columns = 50;
+  const int num_rows = 1000;
+  const int batch_size = 64;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 3,
+                                             default_arrow_writer_properties(), &buffer));
+
+  // No readahead, readahead limited by the number of batches or by their size
+  for (auto readahead : {std::make_pair(0, kArrowDefaultReadaheadBytes),
+                         std::make_pair(4, kArrowDefaultReadaheadBytes),
+                         std::make_pair(4, int64_t(1))}) {
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_batch_size(batch_size);
+    properties.set_use_threads(true);
+    properties.set_readahead(readahead.first);
+    properties.set_readahead_bytes(readahead.second);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({1, 2, 3}, &rb_reader));
+    std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+    // TableBatchReader does not own the table
+    auto expected_table = table->Slice(num_rows / 3);
+    ::arrow::TableBatchReader table_reader(*expected_table);
+    table_reader.set_chunksize(batch_size);
+    int64_t rows_read = 0;
+    while (true) {
+      ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+      if (actual_batch == nullptr) {
+        break;
+      }
+      rows_read += actual_batch->num_rows();
+      ASSERT_OK(table_reader.ReadNext(&expected_batch));
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+    }
+    ASSERT_EQ(num_rows - num_rows / 3, rows_read);
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+
+    // Batches still being decoded are awaited on destruction
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0}, &rb_reader));
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(batch_size, actual_batch->num_rows());
+    rb_reader.reset();
+  }
+}
+
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(batch_size);
+  properties.set_pre_buffer(true);
+  // Small enough to leave some row groups in separate reads
+  properties.set_cache_options(::arrow::io::CacheOptions{/*hole_size_limit=*/64,
+                                                         /*range_size_limit=*/4096});
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups({1, 2}, {0, 5, 6}, &actual));
+  auto expected_columns = table->Slice(num_rows / 4, num_rows / 2);
+  auto expected = Table::Make(
+      ::arrow::schema({table->field(0), table->field(5), table->field(6)}),
+      {expected_columns->column(0), expected_columns->column(5),
+       expected_columns->column(6)});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+  // Column chunks which were not pre-buffered are read from the file
+  ParquetFileReader* file_reader = reader->parquet_reader();
+  file_reader->PreBuffer({1}, {0}, ::arrow::io::CacheOptions::Defaults());
+  ASSERT_EQ(num_rows, ScanFileContents({0, 1}, 256, file_reader));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({3}, &rb_reader));
+  std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+  auto expected_table = table->Slice(3 * num_rows / 4);
+  ::arrow::TableBatchReader table_reader(*expected_table);
+  table_reader.set_chunksize(batch_size);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_OK(table_reader.ReadNext(&expected_batch));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+  }
+}
+
+TEST(TestArrowReadWrite, BloomFilter) {
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int32()),
+                                 ::arrow::field("b", ::arrow::utf8()),
+                                 ::arrow::field("c", ::arrow::float64())});
+  auto table = Table::Make(
+      schema, {::arrow::ArrayFromJSON(::arrow::int32(), "[1, null, 3, 4, 5, null]"),
+               ::arrow::ArrayFromJSON(::arrow::utf8(),
+                                      R"(["x", "y", "x", null, "zz", "y"])"),
+               ::arrow::ArrayFromJSON(::arrow::float64(), "[1, 2, 3, 4, 5, 6]")});
+
+  auto write_props = WriterProperties::Builder()
+                         .enable_bloom_filter("a")
+                         ->enable_bloom_filter("b", BloomFilterOptions(/*ndv=*/100))
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                /*row_group_size=*/3, write_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+  ParquetFileReader* file_reader = reader->parquet_reader();
+  ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+  auto first = file_reader->RowGroup(0);
+  auto second = file_reader->RowGroup(1);
+  ASSERT_TRUE(first->metadata()->ColumnChunk(0)->has_bloom_filter());
+  ASSERT_TRUE(first->metadata()->ColumnChunk(1)->has_bloom_filter());
+  ASSERT_FALSE(first->metadata()->ColumnChunk(2)->has_bloom_filter());
+  ASSERT_EQ(nullptr, first->GetColumnBloomFilter(2));
+
+  auto a_filter = first->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, a_filter);
+  ASSERT_TRUE(a_filter->FindHash(a_filter->Hash(1)));
+  ASSERT_TRUE(a_filter->FindHash(a_filter->Hash(3)));
+  ASSERT_FALSE(a_filter->FindHash(a_filter->Hash(4)));
+  a_filter = second->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, a_filter);
+  ASSERT_TRUE(a_filter->FindHash(a_filter->Hash(4)));
+  ASSERT_TRUE(a_filter->FindHash(a_filter->Hash(5)));
+  ASSERT_FALSE(a_filter->FindHash(a_filter->Hash(1)));
+
+  auto hash_string = [](const BloomFilter& filter, const std::string& value) {
+    ByteArray byte_array(::arrow::util::string_view{value});
+    return filter.Hash(&byte_array);
+  };
+  auto b_filter = first->GetColumnBloomFilter(1);
+  ASSERT_NE(nullptr, b_filter);
+  ASSERT_TRUE(b_filter->FindHash(hash_string(*b_filter, "x")));
+  ASSERT_TRUE(b_filter->FindHash(hash_string(*b_filter, "y")));
+  ASSERT_FALSE(b_filter->FindHash(hash_string(*b_filter, "zz")));
+  b_filter = second->GetColumnBloomFilter(1);
+  ASSERT_NE(nullptr, b_filter);
+  ASSERT_TRUE(b_filter->FindHash(hash_string(*b_filter, "zz")));
+  ASSERT_FALSE(b_filter->FindHash(hash_string(*b_filter, "x")));
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2187,8 +2362,8 @@ TEST(TestArrowReadWrite, TableWithDuplicateColumns) {
   ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, table->num_rows()));
 }
 
-// Disabled until implementation can be finished.
-TEST(TestArrowReadWrite, DISABLED_CanonicalNestedRoundTrip) {
+// The example document of the Dremel paper
+std::shared_ptr<Table> MakeCanonicalNestedTable() {
   auto doc_id = field("DocId", ::arrow::int64(), /*nullable=*/false);
   auto links = field(
       "Links",
@@ -2220,9 +2395,171 @@ TEST(TestArrowReadWrite, DISABLED_CanonicalNestedRoundTrip) {
                      {"Url": "http://B"},
                      {"Language": [{"Code": "en-gb", "Country": "gb"}]}],
                     [{"Url": "http://C"}]])");
-  auto expected =
-      ::arrow::Table::Make(schema, {doc_id_array, links_id_array, name_array});
-  CheckSimpleRoundtrip(expected, 2);
+  return ::arrow::Table::Make(schema, {doc_id_array, links_id_array, name_array});
+}
+
+// Disabled until implementation can be finished.
+TEST(TestArrowReadWrite, DISABLED_CanonicalNestedRoundTrip) {
+  CheckSimpleRoundtrip(MakeCanonicalNestedTable(), 2);
+}
+
+// Read the levels and the non-null values of a column of the first row group
+template <typename ParquetType>
+void ReadColumnLevels(const std::shared_ptr<Buffer>& buffer, int column,
+                      std::vector<int16_t>* def_levels, std::vector<int16_t>* rep_levels,
+                      std::vector<typename ParquetType::c_type>* values) {
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto row_group = reader->RowGroup(0);
+  const int64_t num_levels = row_group->metadata()->ColumnChunk(column)->num_values();
+  def_levels->resize(num_levels);
+  rep_levels->resize(num_levels);
+  std::vector<typename ParquetType::c_type> scratch;
+  if (values == nullptr) {
+    values = &scratch;
+  }
+  values->resize(num_levels);
+
+  auto column_reader =
+      std::static_pointer_cast<TypedColumnReader<ParquetType>>(row_group->Column(column));
+  int64_t values_read = 0;
+  ASSERT_EQ(num_levels,
+            column_reader->ReadBatch(num_levels, def_levels->data(), rep_levels->data(),
+                                     values->data(), &values_read));
+  values->resize(values_read);
+}
+
+template <typename ParquetType>
+void AssertColumnLevels(
+    const std::shared_ptr<Buffer>& buffer, int column,
+    const std::vector<int16_t>& expected_def_levels,
+    const std::vector<int16_t>& expected_rep_levels,
+    const std::vector<typename ParquetType::c_type>* expected_values = nullptr) {
+  std::vector<int16_t> def_levels, rep_levels;
+  std::vector<typename ParquetType::c_type> values;
+  ASSERT_NO_FATAL_FAILURE(ReadColumnLevels<ParquetType>(
+      buffer, column, &def_levels, &rep_levels,
+      expected_values != nullptr ? &values : nullptr));
+  ASSERT_EQ(expected_def_levels, def_levels) << "column " << column;
+  ASSERT_EQ(expected_rep_levels, rep_levels) << "column " << column;
+  if (expected_values != nullptr) {
+    ASSERT_EQ(*expected_values, values) << "column " << column;
+  }
+}
+
+TEST(TestArrowWrite, CanonicalNestedLevels) {
+  auto table = MakeCanonicalNestedTable();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, table->num_rows(),
+                                             default_arrow_writer_properties(), &buffer));
+
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  ASSERT_EQ(6, reader->metadata()->num_columns());
+
+  const std::vector<int64_t> backward = {10, 30};
+  const std::vector<int64_t> forward = {20, 40, 60, 80};
+  // Links.Backward, Links.Forward
+  AssertColumnLevels<Int64Type>(buffer, 1, {1, 3, 3}, {0, 0, 1}, &backward);
+  AssertColumnLevels<Int64Type>(buffer, 2, {3, 3, 3, 3}, {0, 1, 1, 0}, &forward);
+  // Name.Language.Code, Name.Language.Country, Name.Url
+  AssertColumnLevels<ByteArrayType>(buffer, 3, {5, 5, 2, 5, 2}, {0, 2, 1, 1, 0});
+  AssertColumnLevels<ByteArrayType>(buffer, 4, {6, 5, 2, 6, 2}, {0, 2, 1, 1, 0});
+  AssertColumnLevels<ByteArrayType>(buffer, 5, {3, 3, 2, 3}, {0, 1, 1, 0});
+}
+
+TEST(TestArrowWrite, ListOfStructLevels) {
+  auto type = ::arrow::list(::arrow::struct_(
+      {field("a", ::arrow::int64()), field("b", ::arrow::int64(), /*nullable=*/false)}));
+  auto array = ::arrow::ArrayFromJSON(type, R"([[{"a": 1, "b": 10}, null,
+                                                 {"a": null, "b": 30}],
+                                                null, [], [{"a": 4, "b": 40}]])");
+  auto table = MakeSimpleTable(array, /*nullable=*/true);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, table->num_rows(),
+                                             default_arrow_writer_properties(), &buffer));
+
+  // The null struct has values in its children which must not be written
+  const std::vector<int64_t> a_values = {1, 4};
+  const std::vector<int64_t> b_values = {10, 30, 40};
+  AssertColumnLevels<Int64Type>(buffer, 0, {4, 2, 3, 0, 1, 4}, {0, 1, 1, 0, 0, 0},
+                                &a_values);
+  AssertColumnLevels<Int64Type>(buffer, 1, {3, 2, 3, 0, 1, 3}, {0, 1, 1, 0, 0, 0},
+                                &b_values);
+}
+
+TEST(TestArrowWrite, MapLevels) {
+  auto type = ::arrow::map(::arrow::int64(), ::arrow::int64());
+  auto array =
+      ::arrow::ArrayFromJSON(type, "[[[1, 10], [2, null]], null, [], [[3, 30]]]");
+  auto table = MakeSimpleTable(array, /*nullable=*/true);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, table->num_rows(),
+                                             default_arrow_writer_properties(), &buffer));
+
+  const std::vector<int64_t> keys = {1, 2, 3};
+  const std::vector<int64_t> items = {10, 30};
+  AssertColumnLevels<Int64Type>(buffer, 0, {2, 2, 0, 1, 2}, {0, 1, 0, 0, 0}, &keys);
+  AssertColumnLevels<Int64Type>(buffer, 1, {3, 2, 0, 1, 3}, {0, 1, 0, 0, 0}, &items);
+}
+
+TEST(TestArrowWrite, SlicedNestedLevels) {
+  auto type = ::arrow::large_list(::arrow::struct_({field("a", ::arrow::int64())}));
+  auto array = ::arrow::ArrayFromJSON(
+      type, R"([[{"a": 1}], [{"a": 2}, null, {"a": 3}], null, [{"a": null}]])");
+  auto table = MakeSimpleTable(array->Slice(1, 3), /*nullable=*/true);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, table->num_rows(),
+                                             default_arrow_writer_properties(), &buffer));
+
+  const std::vector<int64_t> values = {2, 3};
+  AssertColumnLevels<Int64Type>(buffer, 0, {4, 2, 4, 0, 3}, {0, 1, 1, 0, 0}, &values);
+}
+
+TEST(TestArrowReadWrite, StructRoundTrip) {
+  auto type =
+      ::arrow::struct_({field("a", ::arrow::int32()), field("b", ::arrow::utf8())});
+  auto array = ::arrow::ArrayFromJSON(type, R"([{"a": 1, "b": "x"}, null,
+                                                {"a": null, "b": "z"},
+                                                {"a": 4, "b": null}])");
+  auto table = MakeSimpleTable(array, /*nullable=*/true);
+  ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, 2));
+}
+
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  const int64_t row_group_size = num_rows / 3;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto threaded_properties =
+      ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(DoSimpleRoundtrip(table, /*use_threads=*/false, row_group_size,
+                                            {}, &result, threaded_properties));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
+
+  // Encoding the column chunks in parallel yields the same file, nested
+  // columns included
+  for (const auto& input : {table, MakeCanonicalNestedTable()}) {
+    std::shared_ptr<Buffer> serial_buffer, threaded_buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(
+        input, row_group_size, default_arrow_writer_properties(), &serial_buffer));
+    ASSERT_NO_FATAL_FAILURE(
+        WriteTableToBuffer(input, row_group_size, threaded_properties, &threaded_buffer));
+    ::arrow::AssertBufferEqual(*serial_buffer, *threaded_buffer);
+  }
+
+  // Writing from a worker of the CPU thread pool encodes serially on it
+  std::shared_ptr<Buffer> serial_buffer, pool_buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(
+      table, row_group_size, default_arrow_writer_properties(), &serial_buffer));
+  ASSERT_OK_AND_ASSIGN(auto future, ::arrow::internal::GetCpuThreadPool()->Submit([&]() {
+    WriteTableToBuffer(table, row_group_size, threaded_properties, &pool_buffer);
+  }));
+  future.wait();
+  ASSERT_NE(pool_buffer, nullptr);
+  ::arrow::AssertBufferEqual(*serial_buffer, *pool_buffer);
 }
 
 TEST(TestArrowReadWrite, DictionaryColumnChunkedWrite) {
@@ -2960,6 +3297,135 @@ INSTANTIATE_TEST_CASE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+void ReadDictionaryColumn(const std::shared_ptr<Buffer>& buffer,
+                          std::shared_ptr<ChunkedArray>* out) {
+  auto properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  FileReaderBuilder builder;
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK_NO_THROW(builder.properties(properties)->Build(&reader));
+  std::shared_ptr<Table> table;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&table));
+  *out = table->column(0);
+}
+
+void AssertDictionaryDecodesTo(const ChunkedArray& actual, const Array& expected) {
+  FunctionContext ctx(default_memory_pool());
+  ::arrow::ArrayVector dense_chunks;
+  for (const auto& chunk : actual.chunks()) {
+    ASSERT_EQ(::arrow::Type::DICTIONARY, chunk->type_id());
+    ASSERT_OK(chunk->ValidateFull());
+    std::shared_ptr<Array> dense;
+    ASSERT_OK(::arrow::compute::Cast(&ctx, *chunk, expected.type(),
+                                     ::arrow::compute::CastOptions(), &dense));
+    dense_chunks.push_back(dense);
+  }
+  ASSERT_TRUE(ChunkedArray(dense_chunks).Equals(ChunkedArray({expected.Slice(0)})));
+}
+
+TEST(TestArrowReadDirectDictionary, ReuseEqualDictionaries) {
+  // Every row group has the same dictionary
+  auto values = ::arrow::ArrayFromJSON(::arrow::int64(),
+                                       "[1, 2, null, 1, 3, 2, 1, 2, null, 1, 3, 2,"
+                                       " 1, 2, null, 1, 3, 2]");
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(MakeSimpleTable(values, /*nullable=*/true),
+                                             /*row_group_size=*/6,
+                                             default_arrow_writer_properties(), &buffer));
+
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_NO_FATAL_FAILURE(ReadDictionaryColumn(buffer, &actual));
+  ASSERT_EQ(1, actual->num_chunks());
+
+  auto dict_type = ::arrow::dictionary(::arrow::int32(), ::arrow::int64());
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(),
+                                        "[0, 1, null, 0, 2, 1, 0, 1, null, 0, 2, 1,"
+                                        " 0, 1, null, 0, 2, 1]");
+  auto dictionary = ::arrow::ArrayFromJSON(::arrow::int64(), "[1, 2, 3]");
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(::arrow::DictionaryArray::FromArrays(dict_type, indices, dictionary,
+                                                 &expected));
+  AssertArraysEqual(*expected, *actual->chunk(0));
+}
+
+TEST(TestArrowReadDirectDictionary, PhysicalTypes) {
+  std::vector<std::pair<std::shared_ptr<DataType>, std::string>> cases = {
+      {::arrow::int32(), "[3, null, 1, 3, 2, 1, null, 2, 2, 4]"},
+      {::arrow::int64(), "[3, null, 1, 3, 2, 1, null, 2, 2, 4]"},
+      {::arrow::float32(), "[3.5, null, 1, 3.5, 2, 1, null, 2, 2, 4]"},
+      {::arrow::float64(), "[3.5, null, 1, 3.5, 2, 1, null, 2, 2, 4]"},
+      {::arrow::utf8(), R"(["c", null, "a", "c", "b", "a", null, "b", "b", "d"])"},
+      {::arrow::binary(), R"(["c", null, "a", "c", "b", "a", null, "b", "b", "d"])"},
+      {::arrow::fixed_size_binary(2),
+       R"(["cc", null, "aa", "cc", "bb", "aa", null, "bb", "bb", "dd"])"}};
+  for (const auto& test_case : cases) {
+    SCOPED_TRACE(test_case.first->ToString());
+    auto values = ::arrow::ArrayFromJSON(test_case.first, test_case.second);
+    // Row groups with different dictionaries
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(
+        MakeSimpleTable(values, /*nullable=*/true), /*row_group_size=*/4,
+        default_arrow_writer_properties(), &buffer));
+
+    std::shared_ptr<ChunkedArray> actual;
+    ASSERT_NO_FATAL_FAILURE(ReadDictionaryColumn(buffer, &actual));
+    ASSERT_TRUE(
+        actual->type()->Equals(::arrow::dictionary(::arrow::int32(), test_case.first)));
+    ASSERT_EQ(3, actual->num_chunks());
+    ASSERT_NO_FATAL_FAILURE(AssertDictionaryDecodesTo(*actual, *values));
+  }
+}
+
+TEST(TestArrowReadDirectDictionary, DictionaryFallback) {
+  // The writer falls back to plain encoding once the dictionary is larger
+  // than dictionary_pagesize_limit
+  std::vector<int64_t> raw_values(1000);
+  for (int64_t i = 0; i < 1000; ++i) {
+    raw_values[i] = i % 700;
+  }
+  std::shared_ptr<Array> values;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(raw_values, &values);
+  auto writer_properties = WriterProperties::Builder()
+                               .write_batch_size(100)
+                               ->dictionary_pagesize_limit(200)
+                               ->data_pagesize(100)
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*MakeSimpleTable(values, /*nullable=*/false),
+                                default_memory_pool(), sink, values->length(),
+                                writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_NO_FATAL_FAILURE(ReadDictionaryColumn(buffer, &actual));
+  // Dictionary-encoded pages, then plain encoded ones
+  ASSERT_EQ(2, actual->num_chunks());
+  ASSERT_NO_FATAL_FAILURE(AssertDictionaryDecodesTo(*actual, *values));
+}
+
+TEST(TestArrowReadDirectDictionary, DeltaEncodedNulls) {
+  // DELTA_BINARY_PACKED pages with null slots, e.g. written after a fallback
+  // from dictionary encoding
+  auto writer_properties = WriterProperties::Builder()
+                               .disable_dictionary()
+                               ->encoding(Encoding::DELTA_BINARY_PACKED)
+                               ->build();
+  for (const auto& type : {::arrow::int32(), ::arrow::int64()}) {
+    SCOPED_TRACE(type->ToString());
+    auto values = ::arrow::ArrayFromJSON(type, "[3, null, 1, 3, null, null, 2, 4, 1]");
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*MakeSimpleTable(values, /*nullable=*/true),
+                                  default_memory_pool(), sink, /*chunk_size=*/5,
+                                  writer_properties));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::shared_ptr<ChunkedArray> actual;
+    ASSERT_NO_FATAL_FAILURE(ReadDictionaryColumn(buffer, &actual));
+    ASSERT_NO_FATAL_FAILURE(AssertDictionaryDecodesTo(*actual, *values));
+  }
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <future>
 #include <unordered_set>
 #include <utility>
@@ -295,21 +296,56 @@ class FileReaderImpl : public FileReader {
   SchemaManifest manifest_;
 };
 
+// The size of the buffers of an array, which may be shared with other arrays
+static int64_t ArrayDataSize(const ::arrow::ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += ArrayDataSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+static int64_t RecordBatchSize(const ::arrow::RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += ArrayDataSize(*batch.column_data(i));
+  }
+  return size;
+}
+
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
-                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size)
+                            std::shared_ptr<::arrow::Schema> schema,
+                            const ArrowReaderProperties& properties)
       : field_readers_(std::move(field_readers)),
         schema_(std::move(schema)),
-        batch_size_(batch_size) {}
-
-  ~RowGroupRecordBatchReader() override {}
+        batch_size_(properties.batch_size()),
+        use_threads_(properties.use_threads()),
+        readahead_(properties.readahead()),
+        readahead_bytes_(properties.readahead_bytes()) {}
+
+  ~RowGroupRecordBatchReader() override {
+    // Decoding tasks refer to the field readers
+    if (pending_round_) {
+      for (auto& future : pending_round_->futures) {
+        future.wait();
+      }
+    }
+  }
 
   std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
 
   static Status Make(const std::vector<int>& row_groups,
                      const std::vector<int>& column_indices, FileReaderImpl* reader,
-                     int64_t batch_size,
                      std::unique_ptr<::arrow::RecordBatchReader>* out) {
     std::vector<int> field_indices;
     if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices)) {
@@ -324,18 +360,138 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
                                            &field_readers[i]));
       fields.push_back(field_readers[i]->field());
     }
-    out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
-                                             ::arrow::schema(fields), batch_size));
+    out->reset(new RowGroupRecordBatchReader(
+        std::move(field_readers), ::arrow::schema(fields), reader->reader_properties_));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
-    // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
-    // does not currently honor the use_threads option.
-    std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
+    // Waiting for decoding tasks from a worker of the CPU thread pool, e.g.
+    // in a threaded dataset scan, deadlocks once all workers are waiting
+    const bool on_worker = ::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+    if (!use_threads_ || field_readers_.size() == 0 ||
+        (on_worker && !pending_round_ && decoded_batches_.empty())) {
+      std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
+      for (size_t i = 0; i < field_readers_.size(); ++i) {
+        RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
+      }
+      return MakeBatch(std::move(columns), out);
+    }
+
+    if (decoded_batches_.empty() && !exhausted_) {
+      if (!pending_round_) {
+        RETURN_NOT_OK(StartRound(/*num_batches=*/1));
+      }
+      RETURN_NOT_OK(FinishRound());
+    }
+    if (decoded_batches_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    *out = std::move(decoded_batches_.front());
+    decoded_batches_.pop_front();
+    decoded_bytes_ -= RecordBatchSize(**out);
+
+    // Decode the next batches while this one is consumed
+    if (!pending_round_ && !exhausted_ && !on_worker) {
+      int64_t num_batches =
+          readahead_ - static_cast<int64_t>(decoded_batches_.size());
+      if (batch_bytes_ > 0) {
+        num_batches =
+            std::min(num_batches, (readahead_bytes_ - decoded_bytes_) / batch_bytes_);
+      }
+      if (num_batches > 0) {
+        RETURN_NOT_OK(StartRound(static_cast<int>(num_batches)));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Consecutive batches decoded on the CPU thread pool, with one task per
+  // column decoding all the batches of the column
+  struct DecodeRound {
+    int num_batches;
+    // By column, then by batch
+    std::vector<std::vector<std::shared_ptr<ChunkedArray>>> columns;
+    std::vector<std::future<Status>> futures;
+  };
+
+  Status StartRound(int num_batches) {
+    std::unique_ptr<DecodeRound> round(new DecodeRound());
+    round->num_batches = num_batches;
+    round->columns.resize(field_readers_.size());
+    auto pool = ::arrow::internal::GetCpuThreadPool();
     for (size_t i = 0; i < field_readers_.size(); ++i) {
-      RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
+      ColumnReaderImpl* reader = field_readers_[i].get();
+      auto* chunks = &round->columns[i];
+      const int64_t batch_size = batch_size_;
+      auto decode_column = [reader, chunks, num_batches, batch_size]() -> Status {
+        BEGIN_PARQUET_CATCH_EXCEPTIONS
+        for (int b = 0; b < num_batches; ++b) {
+          std::shared_ptr<ChunkedArray> chunk;
+          RETURN_NOT_OK(reader->NextBatch(batch_size, &chunk));
+          if (chunk->length() == 0) {
+            break;
+          }
+          chunks->push_back(std::move(chunk));
+        }
+        return Status::OK();
+        END_PARQUET_CATCH_EXCEPTIONS
+      };
+      auto maybe_future = pool->Submit(std::move(decode_column));
+      if (!maybe_future.ok()) {
+        // The submitted tasks decode into the round
+        for (auto& future : round->futures) {
+          future.wait();
+        }
+        return maybe_future.status();
+      }
+      round->futures.push_back(std::move(maybe_future).ValueOrDie());
+    }
+    pending_round_ = std::move(round);
+    return Status::OK();
+  }
+
+  // Wait for the pending round and queue its batches
+  Status FinishRound() {
+    std::unique_ptr<DecodeRound> round = std::move(pending_round_);
+    Status status;
+    for (auto& future : round->futures) {
+      Status st = future.get();
+      if (!st.ok()) {
+        status = std::move(st);
+      }
+    }
+    RETURN_NOT_OK(status);
+
+    for (int b = 0; b < round->num_batches; ++b) {
+      std::vector<std::shared_ptr<ChunkedArray>> columns;
+      for (auto& chunks : round->columns) {
+        if (static_cast<int>(chunks.size()) <= b) {
+          break;
+        }
+        columns.push_back(std::move(chunks[b]));
+      }
+      if (columns.size() < field_readers_.size()) {
+        exhausted_ = true;
+        break;
+      }
+      std::shared_ptr<::arrow::RecordBatch> batch;
+      RETURN_NOT_OK(MakeBatch(std::move(columns), &batch));
+      const int64_t size = RecordBatchSize(*batch);
+      // Estimate the size of the next batches from the last one
+      batch_bytes_ = std::max<int64_t>(size, 1);
+      decoded_bytes_ += size;
+      decoded_batches_.push_back(std::move(batch));
+    }
+    return Status::OK();
+  }
+
+  Status MakeBatch(std::vector<std::shared_ptr<ChunkedArray>> columns,
+                   std::shared_ptr<::arrow::RecordBatch>* out) {
+    for (const auto& column : columns) {
+      if (column->num_chunks() > 1) {
         return Status::NotImplemented("This class cannot yet iterate chunked arrays");
       }
     }
@@ -348,10 +504,20 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     return table_batch_reader.ReadNext(out);
   }
 
- private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  bool use_threads_;
+  int64_t readahead_;
+  int64_t readahead_bytes_;
+
+  // Decoded batches not consumed yet, and their total size
+  std::deque<std::shared_ptr<::arrow::RecordBatch>> decoded_batches_;
+  int64_t decoded_bytes_ = 0;
+  // Size of the last decoded batch
+  int64_t batch_bytes_ = 0;
+  std::unique_ptr<DecodeRound> pending_round_;
+  bool exhausted_ = false;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -770,8 +936,16 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
   for (auto row_group_index : row_group_indices) {
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
-  return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
-                                         reader_properties_.batch_size(), out);
+  if (reader_properties_.pre_buffer()) {
+    for (auto column_index : column_indices) {
+      RETURN_NOT_OK(BoundsCheckColumn(column_index));
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->PreBuffer(row_group_indices, column_indices,
+                       reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+  return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this, out);
 }
 
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
@@ -800,6 +974,10 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  if (reader_properties_.pre_buffer()) {
+    reader_->PreBuffer(row_groups, indices, reader_properties_.cache_options());
+  }
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
@@ -336,8 +336,20 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Types which are the storage type of their physical type (see
+  // DictionaryRecordReader), modulo string which is a view of binary
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return true;
+    default:
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -881,7 +893,7 @@ Status TransferDate64(RecordReader* reader, MemoryPool* pool,
 }
 
 // ----------------------------------------------------------------------
-// Binary, direct to dictionary-encoded
+// Direct to dictionary-encoded
 
 Status TransferDictionary(RecordReader* reader,
                           const std::shared_ptr<DataType>& logical_value_type,
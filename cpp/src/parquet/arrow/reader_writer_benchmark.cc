@@ -164,6 +164,61 @@ BENCHMARK_TEMPLATE2(BM_WriteColumn, true, DoubleType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, true, BooleanType);
 
+// A list<struct<a: int64, b: int64>> column with nulls at every nesting level
+std::shared_ptr<::arrow::Table> MakeNestedTable(int64_t* num_leaf_values) {
+  auto struct_type = ::arrow::struct_(
+      {::arrow::field("a", ::arrow::int64()), ::arrow::field("b", ::arrow::int64())});
+  auto a_builder = std::make_shared<::arrow::Int64Builder>();
+  auto b_builder = std::make_shared<::arrow::Int64Builder>();
+  auto struct_builder = std::make_shared<::arrow::StructBuilder>(
+      struct_type, ::arrow::default_memory_pool(),
+      std::vector<std::shared_ptr<::arrow::ArrayBuilder>>{a_builder, b_builder});
+  ::arrow::ListBuilder list_builder(::arrow::default_memory_pool(), struct_builder);
+
+  *num_leaf_values = 0;
+  for (int64_t i = 0; i < BENCHMARK_SIZE / 8; ++i) {
+    if (i % 10 == 0) {
+      EXIT_NOT_OK(list_builder.AppendNull());
+      continue;
+    }
+    EXIT_NOT_OK(list_builder.Append());
+    for (int64_t j = 0; j < i % 8; ++j, ++*num_leaf_values) {
+      if (*num_leaf_values % 7 == 0) {
+        EXIT_NOT_OK(struct_builder->AppendNull());
+      } else {
+        EXIT_NOT_OK(struct_builder->Append());
+      }
+      if (*num_leaf_values % 5 == 0) {
+        EXIT_NOT_OK(a_builder->AppendNull());
+      } else {
+        EXIT_NOT_OK(a_builder->Append(j));
+      }
+      EXIT_NOT_OK(b_builder->Append(i));
+    }
+  }
+  std::shared_ptr<::arrow::Array> array;
+  EXIT_NOT_OK(list_builder.Finish(&array));
+
+  auto schema = ::arrow::schema({::arrow::field("column", array->type(), true)});
+  return ::arrow::Table::Make(schema, {array});
+}
+
+static void BM_WriteNestedColumn(::benchmark::State& state) {
+  int64_t num_leaf_values = 0;
+  std::shared_ptr<::arrow::Table> table = MakeNestedTable(&num_leaf_values);
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(
+        WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  }
+  // Two leaf columns, with definition and repetition levels
+  state.SetBytesProcessed(state.iterations() * num_leaf_values * 2 *
+                          (sizeof(int64_t) + 2 * sizeof(int16_t)));
+}
+
+BENCHMARK(BM_WriteNestedColumn);
+
 template <bool nullable, typename ParquetType>
 static void BM_ReadColumn(::benchmark::State& state) {
   using T = typename ParquetType::c_type;
@@ -18,20 +18,23 @@
 #include "parquet/arrow/writer.h"
 
 #include <algorithm>
-#include <deque>
+#include <numeric>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
-#include "arrow/buffer_builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/extension_type.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
-#include "arrow/visitor_inline.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/column_writer.h"
@@ -48,14 +51,16 @@ using arrow::Decimal128Array;
 using arrow::DictionaryArray;
 using arrow::Field;
 using arrow::FixedSizeBinaryArray;
-using Int16BufferBuilder = arrow::TypedBufferBuilder<int16_t>;
 using arrow::ExtensionArray;
+using arrow::FixedSizeListArray;
+using arrow::LargeListArray;
 using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
 using arrow::ResizableBuffer;
 using arrow::Status;
+using arrow::StructArray;
 using arrow::Table;
 using arrow::TimeUnit;
 
@@ -68,258 +73,320 @@ namespace arrow {
 
 namespace {
 
+// Number of Parquet leaf columns an Arrow type is written as
+int CountLeafColumns(const ::arrow::DataType& type) {
+  if (type.id() == ::arrow::Type::EXTENSION) {
+    return CountLeafColumns(
+        *static_cast<const ::arrow::ExtensionType&>(type).storage_type());
+  }
+  if (type.id() == ::arrow::Type::DICTIONARY || type.num_children() == 0) {
+    return 1;
+  }
+  int num_leaves = 0;
+  for (const auto& child : type.children()) {
+    num_leaves += CountLeafColumns(*child->type());
+  }
+  return num_leaves;
+}
+
+// Generate the definition and repetition levels of one leaf column of an
+// Arrow array, which may nest lists, large lists, fixed size lists, maps and
+// structs arbitrarily.
+//
+// Rather than recursing into each list element, levels are computed one
+// nesting level at a time, from the top-level array down to the leaf. Each
+// level slot is either present at the current nesting level, in which case
+// its position in the array of that level is known, or was cut short by a
+// null or an empty list above, in which case its definition level is final.
+// A nesting level then amounts to one pass over the slots, reading its
+// validity bitmap or its list offsets.
 class LevelBuilder {
  public:
-  explicit LevelBuilder(MemoryPool* pool, const SchemaField* schema_field,
-                        const SchemaManifest* schema_manifest)
-      : def_levels_(pool),
-        rep_levels_(pool),
-        schema_field_(schema_field),
-        schema_manifest_(schema_manifest) {}
-
-  Status VisitInline(const Array& array);
-
-  template <typename T>
-  ::arrow::enable_if_t<std::is_base_of<::arrow::FlatArray, T>::value, Status> Visit(
-      const T& array) {
-    array_offsets_.push_back(static_cast<int32_t>(array.offset()));
-    valid_bitmaps_.push_back(array.null_bitmap_data());
-    null_counts_.push_back(array.null_count());
-    values_array_ = std::make_shared<T>(array.data());
-    return Status::OK();
-  }
+  LevelBuilder(MemoryPool* pool, bool nullable, int leaf_index)
+      : pool_(pool), nullable_(nullable), leaf_index_(leaf_index) {}
 
-  Status Visit(const DictionaryArray& array) {
-    // Only currently handle DictionaryArray where the dictionary is a
-    // primitive type
-    if (array.dict_type()->value_type()->num_children() > 0) {
-      return Status::NotImplemented(
-          "Writing DictionaryArray with nested dictionary "
-          "type not yet supported");
+  Status GenerateLevels(const Array& array,
+                        const std::shared_ptr<ResizableBuffer>& def_levels_scratch,
+                        int64_t* num_levels, const int16_t** def_levels,
+                        const int16_t** rep_levels,
+                        std::shared_ptr<Array>* values_array) {
+    const Array* storage = &array;
+    while (storage->type_id() == ::arrow::Type::EXTENSION) {
+      storage = static_cast<const ExtensionArray*>(storage)->storage().get();
+    }
+    if (storage->type_id() == ::arrow::Type::DICTIONARY ||
+        storage->type()->num_children() == 0) {
+      return GenerateFlatLevels(*storage, def_levels_scratch, num_levels, def_levels,
+                                rep_levels, values_array);
     }
-    array_offsets_.push_back(static_cast<int32_t>(array.offset()));
-    valid_bitmaps_.push_back(array.null_bitmap_data());
-    null_counts_.push_back(array.null_count());
-    values_array_ = std::make_shared<DictionaryArray>(array.data());
-    return Status::OK();
-  }
 
-  Status Visit(const ListArray& array) {
-    array_offsets_.push_back(static_cast<int32_t>(array.offset()));
-    valid_bitmaps_.push_back(array.null_bitmap_data());
-    null_counts_.push_back(array.null_count());
-    offsets_.push_back(array.raw_value_offsets());
+    const int64_t length = array.length();
+    positions_.resize(length);
+    std::iota(positions_.begin(), positions_.end(), 0);
+    def_levels_.assign(length, 0);
+    rep_levels_.assign(length, 0);
+    def_level_ = 0;
+    rep_level_ = 0;
 
-    // Min offset isn't always zero in the case of sliced Arrays.
-    min_offset_idx_ = array.value_offset(min_offset_idx_);
-    max_offset_idx_ = array.value_offset(max_offset_idx_);
+    RETURN_NOT_OK(Visit(array, nullable_, leaf_index_));
 
-    return VisitInline(*array.values());
+    *num_levels = static_cast<int64_t>(def_levels_.size());
+    *def_levels = max_definition_level_ > 0 ? def_levels_.data() : nullptr;
+    *rep_levels = max_repetition_level_ > 0 ? rep_levels_.data() : nullptr;
+    return GatherLeafValues(values_array);
   }
 
-  Status Visit(const ExtensionArray& array) { return VisitInline(*array.storage()); }
+  int16_t max_definition_level() const { return max_definition_level_; }
+  int16_t max_repetition_level() const { return max_repetition_level_; }
 
-#define NOT_IMPLEMENTED_VISIT(ArrowTypePrefix)                             \
-  Status Visit(const ::arrow::ArrowTypePrefix##Array& array) {             \
-    return Status::NotImplemented("Level generation for " #ArrowTypePrefix \
-                                  " not supported yet");                   \
-  }
-
-  // See ARROW-1644
-  NOT_IMPLEMENTED_VISIT(LargeList)
-  NOT_IMPLEMENTED_VISIT(Map)
-  NOT_IMPLEMENTED_VISIT(FixedSizeList)
-  NOT_IMPLEMENTED_VISIT(Struct)
-  NOT_IMPLEMENTED_VISIT(Union)
-
-#undef NOT_IMPLEMENTED_VISIT
-
-  Status ExtractNullability() {
-    // Walk upwards to extract nullability
-    const SchemaField* current_field = schema_field_;
-    while (current_field != nullptr) {
-      nullable_.push_front(current_field->field->nullable());
-      if (current_field->field->type()->num_children() > 1) {
-        return Status::NotImplemented(
-            "Fields with more than one child are not supported.");
+ private:
+  // Position of a slot which is not present at the current nesting level
+  static constexpr int64_t kNotPresent = -1;
+
+  Status GenerateFlatLevels(const Array& array,
+                            const std::shared_ptr<ResizableBuffer>& def_levels_scratch,
+                            int64_t* num_levels, const int16_t** def_levels,
+                            const int16_t** rep_levels,
+                            std::shared_ptr<Array>* values_array) {
+    RETURN_NOT_OK(CheckLeafType(array));
+    *rep_levels = nullptr;
+    if (nullable_) {
+      RETURN_NOT_OK(def_levels_scratch->Resize(array.length() * sizeof(int16_t), false));
+      auto def_levels_ptr =
+          reinterpret_cast<int16_t*>(def_levels_scratch->mutable_data());
+      if (array.null_count() == 0) {
+        std::fill(def_levels_ptr, def_levels_ptr + array.length(), 1);
+      } else if (array.null_count() == array.length()) {
+        std::fill(def_levels_ptr, def_levels_ptr + array.length(), 0);
       } else {
-        current_field = schema_manifest_->GetParent(current_field);
+        ::arrow::internal::BitmapReader valid_bits_reader(
+            array.null_bitmap_data(), array.offset(), array.length());
+        for (int i = 0; i < array.length(); i++) {
+          def_levels_ptr[i] = valid_bits_reader.IsSet() ? 1 : 0;
+          valid_bits_reader.Next();
+        }
       }
+      *def_levels = def_levels_ptr;
+    } else {
+      *def_levels = nullptr;
     }
+    *num_levels = array.length();
+    max_definition_level_ = nullable_ ? 1 : 0;
+    max_repetition_level_ = 0;
+    *values_array = ::arrow::MakeArray(array.data());
     return Status::OK();
   }
 
-  Status GenerateLevels(const Array& array, int64_t* values_offset, int64_t* num_values,
-                        int64_t* num_levels,
-                        const std::shared_ptr<ResizableBuffer>& def_levels_scratch,
-                        std::shared_ptr<Buffer>* def_levels_out,
-                        std::shared_ptr<Buffer>* rep_levels_out,
-                        std::shared_ptr<Array>* values_array) {
-    // Work downwards to extract bitmaps and offsets
-    min_offset_idx_ = 0;
-    max_offset_idx_ = array.length();
-    RETURN_NOT_OK(VisitInline(array));
-    *num_values = max_offset_idx_ - min_offset_idx_;
-    *values_offset = min_offset_idx_;
-    *values_array = values_array_;
-
-    RETURN_NOT_OK(ExtractNullability());
-
-    // Generate the levels.
-    if (nullable_.size() == 1) {
-      // We have a PrimitiveArray
-      *rep_levels_out = nullptr;
-      if (nullable_[0]) {
-        RETURN_NOT_OK(
-            def_levels_scratch->Resize(array.length() * sizeof(int16_t), false));
-        auto def_levels_ptr =
-            reinterpret_cast<int16_t*>(def_levels_scratch->mutable_data());
-        if (array.null_count() == 0) {
-          std::fill(def_levels_ptr, def_levels_ptr + array.length(), 1);
-        } else if (array.null_count() == array.length()) {
-          std::fill(def_levels_ptr, def_levels_ptr + array.length(), 0);
-        } else {
-          ::arrow::internal::BitmapReader valid_bits_reader(
-              array.null_bitmap_data(), array.offset(), array.length());
-          for (int i = 0; i < array.length(); i++) {
-            def_levels_ptr[i] = valid_bits_reader.IsSet() ? 1 : 0;
-            valid_bits_reader.Next();
-          }
-        }
-
-        *def_levels_out = def_levels_scratch;
-      } else {
-        *def_levels_out = nullptr;
-      }
-      *num_levels = array.length();
-    } else {
-      // Note it is hard to estimate memory consumption due to zero length
-      // arrays otherwise we would preallocate.  An upper boun on memory
-      // is the sum of the length of each list array  + number of elements
-      // but this might be too loose of an upper bound so we choose to use
-      // safe methods.
-      RETURN_NOT_OK(rep_levels_.Append(0));
-      RETURN_NOT_OK(HandleListEntries(0, 0, 0, array.length()));
-
-      RETURN_NOT_OK(def_levels_.Finish(def_levels_out));
-      RETURN_NOT_OK(rep_levels_.Finish(rep_levels_out));
-      *num_levels = (*rep_levels_out)->size() / sizeof(int16_t);
+  Status Visit(const Array& array, bool nullable, int leaf_index) {
+    switch (array.type_id()) {
+      case ::arrow::Type::EXTENSION:
+        return Visit(*static_cast<const ExtensionArray&>(array).storage(), nullable,
+                     leaf_index);
+      case ::arrow::Type::STRUCT:
+        return VisitStruct(static_cast<const StructArray&>(array), nullable, leaf_index);
+      case ::arrow::Type::LIST:
+      case ::arrow::Type::MAP:
+        // A map is written as a list of key-value structs
+        return VisitList(static_cast<const ListArray&>(array), nullable, leaf_index);
+      case ::arrow::Type::LARGE_LIST:
+        return VisitList(static_cast<const LargeListArray&>(array), nullable,
+                         leaf_index);
+      case ::arrow::Type::FIXED_SIZE_LIST:
+        return VisitList(static_cast<const FixedSizeListArray&>(array), nullable,
+                         leaf_index);
+      default:
+        return VisitLeaf(array, nullable);
     }
-
-    return Status::OK();
   }
 
-  Status HandleList(int16_t def_level, int16_t rep_level, int64_t index) {
-    if (nullable_[rep_level]) {
-      if (null_counts_[rep_level] == 0 ||
-          BitUtil::GetBit(valid_bitmaps_[rep_level], index + array_offsets_[rep_level])) {
-        return HandleNonNullList(static_cast<int16_t>(def_level + 1), rep_level, index);
-      } else {
-        return def_levels_.Append(def_level);
+  Status VisitStruct(const StructArray& array, bool nullable, int leaf_index) {
+    if (nullable) {
+      AddNullability(array);
+    }
+    const auto& type = *array.type();
+    for (int i = 0; i < type.num_children(); ++i) {
+      const int num_leaves = CountLeafColumns(*type.child(i)->type());
+      if (leaf_index < num_leaves) {
+        return Visit(*array.field(i), type.child(i)->nullable(), leaf_index);
       }
-    } else {
-      return HandleNonNullList(def_level, rep_level, index);
+      leaf_index -= num_leaves;
     }
+    return Status::Invalid("Leaf column out of bounds for struct type ", type);
   }
 
-  Status HandleNonNullList(int16_t def_level, int16_t rep_level, int64_t index) {
-    const int32_t inner_offset = offsets_[rep_level][index];
-    const int32_t inner_length = offsets_[rep_level][index + 1] - inner_offset;
-    const int64_t recursion_level = rep_level + 1;
-    if (inner_length == 0) {
-      return def_levels_.Append(def_level);
+  template <typename ListArrayType>
+  Status VisitList(const ListArrayType& array, bool nullable, int leaf_index) {
+    if (nullable) {
+      AddNullability(array);
     }
-    if (recursion_level < static_cast<int64_t>(offsets_.size())) {
-      return HandleListEntries(static_cast<int16_t>(def_level + 1),
-                               static_cast<int16_t>(rep_level + 1), inner_offset,
-                               inner_length);
-    }
-    // We have reached the leaf: primitive list, handle remaining nullables
-    const bool nullable_level = nullable_[recursion_level];
-    const int64_t level_null_count = null_counts_[recursion_level];
-    const uint8_t* level_valid_bitmap = valid_bitmaps_[recursion_level];
-
-    if (inner_length >= 1) {
-      RETURN_NOT_OK(
-          rep_levels_.Append(inner_length - 1, static_cast<int16_t>(rep_level + 1)));
+
+    // Size the slots of the list elements: a present non-empty list
+    // expands to one slot per element, anything else keeps its slot
+    const int64_t num_slots = static_cast<int64_t>(positions_.size());
+    int64_t num_element_slots = 0;
+    for (int64_t i = 0; i < num_slots; ++i) {
+      const int64_t position = positions_[i];
+      num_element_slots +=
+          position == kNotPresent
+              ? 1
+              : std::max<int64_t>(1, static_cast<int64_t>(array.value_length(position)));
     }
 
-    // Special case: this is a null array (all elements are null)
-    if (level_null_count && level_valid_bitmap == nullptr) {
-      return def_levels_.Append(inner_length, static_cast<int16_t>(def_level + 1));
+    std::vector<int64_t> positions(num_element_slots);
+    std::vector<int16_t> def_levels(num_element_slots, 0);
+    std::vector<int16_t> rep_levels(num_element_slots);
+    const int16_t element_rep_level = static_cast<int16_t>(rep_level_ + 1);
+    int64_t out = 0;
+    for (int64_t i = 0; i < num_slots; ++i) {
+      const int64_t position = positions_[i];
+      const int64_t list_length =
+          position == kNotPresent ? 0
+                                  : static_cast<int64_t>(array.value_length(position));
+      rep_levels[out] = rep_levels_[i];
+      if (list_length == 0) {
+        // Null above or empty list: the definition level of an empty list is
+        // the one reached so far
+        positions[out] = kNotPresent;
+        def_levels[out] = position == kNotPresent ? def_levels_[i] : def_level_;
+        ++out;
+        continue;
+      }
+      const int64_t list_offset = static_cast<int64_t>(array.value_offset(position));
+      std::iota(positions.begin() + out, positions.begin() + out + list_length,
+                list_offset);
+      std::fill(rep_levels.begin() + out + 1, rep_levels.begin() + out + list_length,
+                element_rep_level);
+      out += list_length;
     }
-    for (int64_t i = 0; i < inner_length; i++) {
-      if (nullable_level &&
-          ((level_null_count == 0) ||
-           BitUtil::GetBit(level_valid_bitmap,
-                           inner_offset + i + array_offsets_[recursion_level]))) {
-        // Non-null element in a null level
-        RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 2)));
-      } else {
-        // This can be produced in two cases:
-        //  * elements are nullable and this one is null
-        //   (i.e. max_def_level = def_level + 2)
-        //  * elements are non-nullable (i.e. max_def_level = def_level + 1)
-        RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 1)));
+    positions_.swap(positions);
+    def_levels_.swap(def_levels);
+    rep_levels_.swap(rep_levels);
+
+    // The repeated group of the list elements
+    ++def_level_;
+    ++rep_level_;
+    const auto& list_type = static_cast<const ::arrow::BaseListType&>(*array.type());
+    return Visit(*array.values(), list_type.value_field()->nullable(), leaf_index);
+  }
+
+  Status VisitLeaf(const Array& array, bool nullable) {
+    RETURN_NOT_OK(CheckLeafType(array));
+    leaf_array_ = &array;
+    max_definition_level_ = static_cast<int16_t>(def_level_ + (nullable ? 1 : 0));
+    max_repetition_level_ = rep_level_;
+
+    // Slots present at the leaf are spaced values of the column, whether
+    // null or not
+    const uint8_t* valid_bits = array.null_bitmap_data();
+    const bool all_null = array.null_count() == array.length() && valid_bits == nullptr;
+    const bool check_validity = nullable && array.null_count() > 0;
+    const int64_t num_slots = static_cast<int64_t>(positions_.size());
+    leaf_positions_.clear();
+    leaf_positions_.reserve(num_slots);
+    for (int64_t i = 0; i < num_slots; ++i) {
+      const int64_t position = positions_[i];
+      if (position == kNotPresent) {
+        continue;
+      }
+      leaf_positions_.push_back(position);
+      def_levels_[i] = max_definition_level_;
+      if (check_validity &&
+          (all_null || !BitUtil::GetBit(valid_bits, array.offset() + position))) {
+        def_levels_[i] = def_level_;
       }
     }
     return Status::OK();
   }
 
-  Status HandleListEntries(int16_t def_level, int16_t rep_level, int64_t offset,
-                           int64_t length) {
-    for (int64_t i = 0; i < length; i++) {
-      if (i > 0) {
-        RETURN_NOT_OK(rep_levels_.Append(rep_level));
+  // Mark the present slots which are null in array as not present
+  void AddNullability(const Array& array) {
+    if (array.null_count() > 0) {
+      const uint8_t* valid_bits = array.null_bitmap_data();
+      const int64_t offset = array.offset();
+      const int64_t num_slots = static_cast<int64_t>(positions_.size());
+      for (int64_t i = 0; i < num_slots; ++i) {
+        const int64_t position = positions_[i];
+        if (position != kNotPresent &&
+            (valid_bits == nullptr || !BitUtil::GetBit(valid_bits, offset + position))) {
+          positions_[i] = kNotPresent;
+          def_levels_[i] = def_level_;
+        }
       }
-      RETURN_NOT_OK(HandleList(def_level, rep_level, offset + i));
     }
-    return Status::OK();
+    ++def_level_;
   }
 
- private:
-  Int16BufferBuilder def_levels_;
-  Int16BufferBuilder rep_levels_;
+  // The values of the leaf array at the present slots, sliced when they are
+  // contiguous, which is always the case when there are no nulls above the
+  // leaf
+  Status GatherLeafValues(std::shared_ptr<Array>* out) {
+    const auto leaf = ::arrow::MakeArray(leaf_array_->data());
+    const int64_t num_values = static_cast<int64_t>(leaf_positions_.size());
+    if (num_values == 0) {
+      *out = leaf->Slice(0, 0);
+      return Status::OK();
+    }
+    const int64_t first = leaf_positions_.front();
+    if (leaf_positions_.back() - first + 1 == num_values) {
+      *out = leaf->Slice(first, num_values);
+      return Status::OK();
+    }
+    auto indices = std::make_shared<::arrow::Int64Array>(
+        num_values, ::arrow::Buffer::Wrap(leaf_positions_));
+    ::arrow::compute::FunctionContext ctx(pool_);
+    return ::arrow::compute::Take(&ctx, *leaf, *indices, ::arrow::compute::TakeOptions(),
+                                  out);
+  }
 
-  const SchemaField* schema_field_;
-  const SchemaManifest* schema_manifest_;
+  static Status CheckLeafType(const Array& array) {
+    if (array.type_id() == ::arrow::Type::UNION) {
+      return Status::NotImplemented("Level generation for Union not supported yet");
+    }
+    if (array.type_id() == ::arrow::Type::DICTIONARY &&
+        static_cast<const DictionaryArray&>(array)
+                .dict_type()
+                ->value_type()
+                ->num_children() > 0) {
+      // Only currently handle DictionaryArray where the dictionary is a
+      // primitive type
+      return Status::NotImplemented(
+          "Writing DictionaryArray with nested dictionary "
+          "type not yet supported");
+    }
+    return Status::OK();
+  }
 
-  std::vector<int64_t> null_counts_;
-  std::vector<const uint8_t*> valid_bitmaps_;
-  std::vector<const int32_t*> offsets_;
-  std::vector<int32_t> array_offsets_;
-  std::deque<bool> nullable_;
+  MemoryPool* pool_;
+  const bool nullable_;
+  const int leaf_index_;
 
-  int64_t min_offset_idx_;
-  int64_t max_offset_idx_;
-  std::shared_ptr<Array> values_array_;
-};
+  // One entry per level slot
+  std::vector<int64_t> positions_;
+  std::vector<int16_t> def_levels_;
+  std::vector<int16_t> rep_levels_;
 
-Status LevelBuilder::VisitInline(const Array& array) {
-  return VisitArrayInline(array, this);
-}
+  // Definition and repetition levels of the slots present at the current
+  // nesting level
+  int16_t def_level_ = 0;
+  int16_t rep_level_ = 0;
 
-Status GetLeafType(const ::arrow::DataType& type, ::arrow::Type::type* leaf_type) {
-  if (type.id() == ::arrow::Type::LIST || type.id() == ::arrow::Type::STRUCT) {
-    if (type.num_children() != 1) {
-      return Status::Invalid("Nested column branch had multiple children: ", type);
-    }
-    return GetLeafType(*type.child(0)->type(), leaf_type);
-  } else {
-    *leaf_type = type.id();
-    return Status::OK();
-  }
-}
+  int16_t max_definition_level_ = 0;
+  int16_t max_repetition_level_ = 0;
+  const Array* leaf_array_ = nullptr;
+  std::vector<int64_t> leaf_positions_;
+};
 
+// Write one leaf column of a (possibly nested) Arrow column
 class ArrowColumnWriter {
  public:
-  ArrowColumnWriter(ArrowWriteContext* ctx, ColumnWriter* column_writer,
-                    const SchemaField* schema_field,
-                    const SchemaManifest* schema_manifest)
+  // nullable is the nullability of the top-level field, leaf_index the
+  // index of the column among the leaf columns of the field
+  ArrowColumnWriter(ArrowWriteContext* ctx, ColumnWriter* column_writer, bool nullable,
+                    int leaf_index)
       : ctx_(ctx),
         writer_(column_writer),
-        schema_field_(schema_field),
-        schema_manifest_(schema_manifest) {}
+        nullable_(nullable),
+        leaf_index_(leaf_index) {}
 
   Status Write(const Array& data) {
     if (data.length() == 0) {
@@ -327,27 +394,22 @@ class ArrowColumnWriter {
       return Status::OK();
     }
 
-    ::arrow::Type::type values_type;
-    RETURN_NOT_OK(GetLeafType(*data.type(), &values_type));
-
-    std::shared_ptr<Array> _values_array;
-    int64_t values_offset = 0;
     int64_t num_levels = 0;
-    int64_t num_values = 0;
-    LevelBuilder level_builder(ctx_->memory_pool, schema_field_, schema_manifest_);
-    std::shared_ptr<Buffer> def_levels_buffer, rep_levels_buffer;
-    RETURN_NOT_OK(level_builder.GenerateLevels(
-        data, &values_offset, &num_values, &num_levels, ctx_->def_levels_buffer,
-        &def_levels_buffer, &rep_levels_buffer, &_values_array));
     const int16_t* def_levels = nullptr;
-    if (def_levels_buffer) {
-      def_levels = reinterpret_cast<const int16_t*>(def_levels_buffer->data());
-    }
     const int16_t* rep_levels = nullptr;
-    if (rep_levels_buffer) {
-      rep_levels = reinterpret_cast<const int16_t*>(rep_levels_buffer->data());
+    std::shared_ptr<Array> values_array;
+    LevelBuilder level_builder(ctx_->memory_pool, nullable_, leaf_index_);
+    RETURN_NOT_OK(level_builder.GenerateLevels(data, ctx_->def_levels_buffer,
+                                               &num_levels, &def_levels, &rep_levels,
+                                               &values_array));
+
+    const ColumnDescriptor* descr = writer_->descr();
+    if (level_builder.max_definition_level() != descr->max_definition_level() ||
+        level_builder.max_repetition_level() != descr->max_repetition_level()) {
+      return Status::Invalid("Arrow type ", *data.type(),
+                             " does not match the levels of Parquet column ",
+                             descr->path()->ToDotString());
     }
-    std::shared_ptr<Array> values_array = _values_array->Slice(values_offset, num_values);
     return writer_->WriteArrow(def_levels, rep_levels, num_levels, *values_array, ctx_);
   }
 
@@ -405,8 +467,8 @@ class ArrowColumnWriter {
  private:
   ArrowWriteContext* ctx_;
   ColumnWriter* writer_;
-  const SchemaField* schema_field_;
-  const SchemaManifest* schema_manifest_;
+  const bool nullable_;
+  const int leaf_index_;
 };
 
 }  // namespace
@@ -460,16 +522,21 @@ class FileWriterImpl : public FileWriter {
 
   Status WriteColumnChunk(const std::shared_ptr<ChunkedArray>& data, int64_t offset,
                           int64_t size) override {
-    ColumnWriter* column_writer;
-    PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
-
-    const SchemaField* schema_field = nullptr;
-    RETURN_NOT_OK(schema_manifest_.GetColumnField(row_group_writer_->current_column(),
-                                                  &schema_field));
-    ArrowColumnWriter arrow_writer(&column_write_context_, column_writer, schema_field,
-                                   &schema_manifest_);
-    RETURN_NOT_OK(arrow_writer.Write(*data, offset, size));
-    return arrow_writer.Close();
+    // A nested column is written as all the leaf columns of its field
+    const int num_leaves = CountLeafColumns(*data->type());
+    for (int leaf_index = 0; leaf_index < num_leaves; ++leaf_index) {
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+
+      const bool nullable =
+          writer_->schema()->GetColumnRoot(row_group_writer_->current_column())
+              ->is_optional();
+      ArrowColumnWriter arrow_writer(&column_write_context_, column_writer, nullable,
+                                     leaf_index);
+      RETURN_NOT_OK(arrow_writer.Write(*data, offset, size));
+      RETURN_NOT_OK(arrow_writer.Close());
+    }
+    return Status::OK();
   }
 
   Status WriteColumnChunk(const std::shared_ptr<::arrow::ChunkedArray>& data) override {
@@ -491,7 +558,12 @@ class FileWriterImpl : public FileWriter {
       chunk_size = this->properties().max_row_group_length();
     }
 
+    const bool use_threads = arrow_properties_->use_threads() &&
+                             properties().file_encryption_properties() == nullptr;
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (use_threads) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -514,6 +586,59 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  // Encode and compress the column chunks of a row group in parallel into
+  // memory, then write them in column order
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+
+    struct LeafColumn {
+      int field_index;
+      int leaf_index;
+      int column_index;
+      bool nullable;
+    };
+    std::vector<LeafColumn> leaves;
+    for (int i = 0; i < table.num_columns(); i++) {
+      const int column_index = static_cast<int>(leaves.size());
+      const int num_leaves = CountLeafColumns(*table.column(i)->type());
+      if (column_index + num_leaves > row_group_writer_->num_columns()) {
+        return Status::Invalid("Table has more leaf columns than the Parquet schema");
+      }
+      const bool nullable = writer_->schema()->GetColumnRoot(column_index)->is_optional();
+      for (int leaf_index = 0; leaf_index < num_leaves; leaf_index++) {
+        leaves.push_back({i, leaf_index, column_index + leaf_index, nullable});
+      }
+    }
+
+    auto WriteLeafColumn = [&](int i) {
+      const LeafColumn& leaf = leaves[i];
+      ColumnWriter* column_writer = row_group_writer_->column(leaf.column_index);
+      // The scratch buffers of the context cannot be shared between threads
+      ArrowWriteContext ctx(column_write_context_.memory_pool, arrow_properties_.get());
+      ArrowColumnWriter arrow_writer(&ctx, column_writer, leaf.nullable, leaf.leaf_index);
+      RETURN_NOT_OK(arrow_writer.Write(*table.column(leaf.field_index), offset, size));
+      PARQUET_CATCH_NOT_OK(column_writer->FinishPages());
+      return Status::OK();
+    };
+    const int num_leaves = static_cast<int>(leaves.size());
+    if (::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      // Waiting for encoding tasks from a worker of the CPU thread pool
+      // deadlocks once all workers are waiting, so encode serially instead
+      for (int i = 0; i < num_leaves; i++) {
+        RETURN_NOT_OK(WriteLeafColumn(i));
+      }
+    } else {
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(num_leaves, WriteLeafColumn));
+    }
+
+    // Flush the row group so that at most one is buffered at a time
+    PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    return Status::OK();
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
   ::arrow::MemoryPool* memory_pool() const override {
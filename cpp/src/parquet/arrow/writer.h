@@ -68,6 +68,11 @@ class PARQUET_EXPORT FileWriter {
   virtual ::arrow::Status WriteTable(const ::arrow::Table& table, int64_t chunk_size) = 0;
 
   virtual ::arrow::Status NewRowGroup(int64_t chunk_size) = 0;
+
+  /// \brief Write the ColumnChunks of the next field in the current row group
+  ///
+  /// A nested field (struct, list or map) is written as the ColumnChunks of
+  /// all its leaf columns.
   virtual ::arrow::Status WriteColumnChunk(const ::arrow::Array& data) = 0;
 
   /// \brief Write ColumnChunk in row group using slice of a ChunkedArray
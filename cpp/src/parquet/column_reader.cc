@@ -575,8 +575,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -584,11 +587,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -1342,83 +1340,224 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
- public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
-    this->read_dictionary_ = true;
+std::shared_ptr<::arrow::DataType> DictionaryValueType(const ColumnDescriptor* descr) {
+  switch (descr->physical_type()) {
+    case Type::INT32:
+      return ::arrow::int32();
+    case Type::INT64:
+      return ::arrow::int64();
+    case Type::FLOAT:
+      return ::arrow::float32();
+    case Type::DOUBLE:
+      return ::arrow::float64();
+    case Type::BYTE_ARRAY:
+      return ::arrow::binary();
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return ::arrow::fixed_size_binary(descr->type_length());
+    default:
+      throw ParquetException("Cannot read " + TypeToString(descr->physical_type()) +
+                             " values as dictionary-encoded");
   }
+}
 
-  std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
-    FlushBuilder();
-    std::vector<std::shared_ptr<::arrow::Array>> result;
-    std::swap(result, result_chunks_);
-    return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
+// Copy dictionary values to an Arrow array of the storage type of DType
+template <typename DType>
+std::shared_ptr<::arrow::Array> MakeDictionaryValues(
+    const typename DType::c_type* values, int32_t length,
+    const std::shared_ptr<::arrow::DataType>& type, MemoryPool* pool) {
+  std::shared_ptr<Buffer> data;
+  PARQUET_THROW_NOT_OK(
+      ::arrow::AllocateBuffer(pool, length * sizeof(typename DType::c_type), &data));
+  if (length > 0) {
+    memcpy(data->mutable_data(), values, length * sizeof(typename DType::c_type));
   }
+  return ::arrow::MakeArray(::arrow::ArrayData::Make(type, length, {nullptr, data}, 0));
+}
 
-  void FlushBuilder() {
-    if (builder_.length() > 0) {
-      std::shared_ptr<::arrow::Array> chunk;
-      PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
-      result_chunks_.emplace_back(std::move(chunk));
+template <>
+std::shared_ptr<::arrow::Array> MakeDictionaryValues<ByteArrayType>(
+    const ByteArray* values, int32_t length,
+    const std::shared_ptr<::arrow::DataType>& type, MemoryPool* pool) {
+  ::arrow::BinaryBuilder builder(type, pool);
+  int64_t data_length = 0;
+  for (int32_t i = 0; i < length; ++i) {
+    data_length += values[i].len;
+  }
+  PARQUET_THROW_NOT_OK(builder.Reserve(length));
+  PARQUET_THROW_NOT_OK(builder.ReserveData(data_length));
+  for (int32_t i = 0; i < length; ++i) {
+    builder.UnsafeAppend(values[i].ptr, static_cast<int32_t>(values[i].len));
+  }
+  std::shared_ptr<::arrow::Array> out;
+  PARQUET_THROW_NOT_OK(builder.Finish(&out));
+  return out;
+}
 
-      // Also clears the dictionary memo table
-      builder_.ResetFull();
-    }
+template <>
+std::shared_ptr<::arrow::Array> MakeDictionaryValues<FLBAType>(
+    const FLBA* values, int32_t length, const std::shared_ptr<::arrow::DataType>& type,
+    MemoryPool* pool) {
+  ::arrow::FixedSizeBinaryBuilder builder(type, pool);
+  PARQUET_THROW_NOT_OK(builder.Reserve(length));
+  for (int32_t i = 0; i < length; ++i) {
+    builder.UnsafeAppend(values[i].ptr);
   }
+  std::shared_ptr<::arrow::Array> out;
+  PARQUET_THROW_NOT_OK(builder.Finish(&out));
+  return out;
+}
 
-  void MaybeWriteNewDictionary() {
-    if (this->new_dictionary_) {
-      /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
-      this->new_dictionary_ = false;
-    }
+// Read dictionary-encoded pages without materializing or hashing their
+// values: the dictionary page becomes the dictionary of the result and the
+// indices are decoded straight into its indices buffer. A dictionary equal to
+// the previous one, e.g. in the next row group, is reused. Pages which are
+// not dictionary-encoded are appended to a dictionary builder.
+template <typename DType>
+class TypedDictionaryRecordReader : public TypedRecordReader<DType>,
+                                    virtual public DictionaryRecordReader {
+ public:
+  TypedDictionaryRecordReader(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool),
+        value_type_(DictionaryValueType(descr)),
+        indices_(pool),
+        is_valid_(pool),
+        fallback_builder_(value_type_, pool) {
+    this->read_dictionary_ = true;
+    // Values are decoded to indices_ or fallback_builder_
+    this->uses_values_ = false;
+  }
+
+  std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
+    FlushIndices();
+    FlushFallbackBuilder();
+    std::vector<std::shared_ptr<::arrow::Array>> result;
+    std::swap(result, result_chunks_);
+    return std::make_shared<::arrow::ChunkedArray>(
+        std::move(result), ::arrow::dictionary(::arrow::int32(), value_type_));
   }
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
-      MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
+      FlushFallbackBuilder();
+      MaybeSetDictionary();
+      PARQUET_THROW_NOT_OK(indices_.Reserve(values_to_read * sizeof(int32_t)));
+      num_decoded = GetDictDecoder()->DecodeIndices(static_cast<int>(values_to_read),
+                                                    IndicesHead());
+      indices_.UnsafeAdvance(num_decoded * sizeof(int32_t));
     } else {
+      FlushIndices();
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
-          static_cast<int>(values_to_read), &builder_);
-
-      /// Flush values since they have been copied into the builder
-      ResetValues();
+          static_cast<int>(values_to_read), &fallback_builder_);
     }
     DCHECK_EQ(num_decoded, values_to_read);
+    /// Flush values since they have been copied
+    this->ResetValues();
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
-    int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
-      MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      num_decoded = decoder->DecodeIndicesSpaced(
-          static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+    const uint8_t* valid_bits = this->valid_bits_->data();
+    const int64_t valid_bits_offset = this->values_written_;
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
+      FlushFallbackBuilder();
+      MaybeSetDictionary();
+      PARQUET_THROW_NOT_OK(indices_.Reserve(values_to_read * sizeof(int32_t)));
+      PARQUET_THROW_NOT_OK(is_valid_.Reserve(values_to_read));
+      int64_t num_decoded = GetDictDecoder()->DecodeIndicesSpaced(
+          static_cast<int>(values_to_read), static_cast<int>(null_count), valid_bits,
+          valid_bits_offset, IndicesHead());
+      DCHECK_EQ(num_decoded, values_to_read);
+      indices_.UnsafeAdvance(num_decoded * sizeof(int32_t));
+      ::arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset,
+                                                 values_to_read);
+      is_valid_.UnsafeAppend</*count_falses=*/true>(values_to_read, [&] {
+        bool is_valid = bit_reader.IsSet();
+        bit_reader.Next();
+        return is_valid;
+      });
     } else {
-      num_decoded = this->current_decoder_->DecodeArrow(
-          static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
-
-      /// Flush values since they have been copied into the builder
-      ResetValues();
+      FlushIndices();
+      int64_t num_decoded = this->current_decoder_->DecodeArrow(
+          static_cast<int>(values_to_read), static_cast<int>(null_count), valid_bits,
+          valid_bits_offset, &fallback_builder_);
+      DCHECK_EQ(num_decoded, values_to_read - null_count);
     }
-    DCHECK_EQ(num_decoded, values_to_read - null_count);
+    /// Flush values since they have been copied
+    this->ResetValues();
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  using T = typename DType::c_type;
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  DictDecoder<DType>* GetDictDecoder() {
+    return dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
+  }
+
+  int32_t* IndicesHead() {
+    return reinterpret_cast<int32_t*>(indices_.mutable_data() + indices_.length());
+  }
+
+  void MaybeSetDictionary() {
+    if (!this->new_dictionary_) {
+      return;
+    }
+    this->new_dictionary_ = false;
+    const T* values;
+    int32_t length;
+    GetDictDecoder()->GetDictionary(&values, &length);
+    auto dictionary =
+        MakeDictionaryValues<DType>(values, length, value_type_, this->pool_);
+    if (dictionary_ != nullptr && dictionary_->Equals(*dictionary)) {
+      // Indices of the new dictionary are valid in the current one
+      return;
+    }
+    FlushIndices();
+    dictionary_ = std::move(dictionary);
+  }
+
+  void FlushIndices() {
+    const int64_t length = indices_.length() / static_cast<int64_t>(sizeof(int32_t));
+    if (length == 0) {
+      return;
+    }
+    std::shared_ptr<Buffer> indices, is_valid;
+    int64_t null_count = 0;
+    PARQUET_THROW_NOT_OK(indices_.Finish(&indices));
+    if (this->nullable_values_) {
+      null_count = is_valid_.false_count();
+      PARQUET_THROW_NOT_OK(is_valid_.Finish(&is_valid));
+      if (null_count == 0) {
+        is_valid.reset();
+      }
+    }
+    if (dictionary_ == nullptr) {
+      // Only nulls were read, without a dictionary page
+      PARQUET_THROW_NOT_OK(
+          ::arrow::MakeArrayOfNull(this->pool_, value_type_, 0, &dictionary_));
+    }
+    auto data =
+        ::arrow::ArrayData::Make(::arrow::dictionary(::arrow::int32(), value_type_),
+                                 length, {is_valid, indices}, null_count);
+    data->dictionary = dictionary_;
+    result_chunks_.push_back(::arrow::MakeArray(data));
+  }
+
+  void FlushFallbackBuilder() {
+    if (fallback_builder_.length() > 0) {
+      std::shared_ptr<::arrow::Array> chunk;
+      PARQUET_THROW_NOT_OK(fallback_builder_.Finish(&chunk));
+      result_chunks_.push_back(std::move(chunk));
+      // Also clears the dictionary memo table
+      fallback_builder_.ResetFull();
+    }
+  }
+
+  std::shared_ptr<::arrow::DataType> value_type_;
+  // The dictionary of the indices being read
+  std::shared_ptr<::arrow::Array> dictionary_;
+  ::arrow::BufferBuilder indices_;
+  ::arrow::TypedBufferBuilder<bool> is_valid_;
+  typename EncodingTraits<DType>::DictAccumulator fallback_builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -1432,19 +1571,28 @@ void TypedRecordReader<ByteArrayType>::DebugPrintState() {}
 template <>
 void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
-std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
-                                                        ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
-  if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
-  } else {
-    return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
-  }
-}
-
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
                                                  const bool read_dictionary) {
+  if (read_dictionary) {
+    switch (descr->physical_type()) {
+      case Type::INT32:
+        return std::make_shared<TypedDictionaryRecordReader<Int32Type>>(descr, pool);
+      case Type::INT64:
+        return std::make_shared<TypedDictionaryRecordReader<Int64Type>>(descr, pool);
+      case Type::FLOAT:
+        return std::make_shared<TypedDictionaryRecordReader<FloatType>>(descr, pool);
+      case Type::DOUBLE:
+        return std::make_shared<TypedDictionaryRecordReader<DoubleType>>(descr, pool);
+      case Type::BYTE_ARRAY:
+        return std::make_shared<TypedDictionaryRecordReader<ByteArrayType>>(descr, pool);
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return std::make_shared<TypedDictionaryRecordReader<FLBAType>>(descr, pool);
+      default:
+        // Read as dense values
+        break;
+    }
+  }
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
@@ -1459,7 +1607,7 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::DOUBLE:
       return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, pool, read_dictionary);
+      return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, pool);
     default: {
@@ -305,7 +305,8 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices), with the storage type of the physical type as value type. Not
+/// valid for BOOLEAN and INT96 columns
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
@@ -32,15 +32,21 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/stopwatch.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
+#include "parquet/hyperloglog.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/murmur3.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -65,6 +71,50 @@ inline const int16_t* AddIfNotNull(const int16_t* base, int64_t offset) {
   return nullptr;
 }
 
+// Hash of a value as inserted into a column chunk's Bloom filter or into its
+// dictionary encoding sample, with a BloomFilter or a Hasher
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, int32_t value, int) {
+  return hasher.Hash(value);
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, int64_t value, int) {
+  return hasher.Hash(value);
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, float value, int) {
+  return hasher.Hash(value);
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, double value, int) {
+  return hasher.Hash(value);
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, const Int96& value, int) {
+  return hasher.Hash(&value);
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, const ByteArray& value, int) {
+  return hasher.Hash(&value);
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType& hasher, const FLBA& value, int type_length) {
+  return hasher.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
+template <typename HasherType>
+inline uint64_t HashValue(const HasherType&, bool, int) {
+  // Neither Bloom filters nor dictionaries are written for boolean columns
+  DCHECK(false);
+  return 0;
+}
+
 }  // namespace
 
 LevelEncoder::LevelEncoder() {}
@@ -153,7 +203,9 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       ColumnIndexBuilder* column_index_builder = nullptr,
+                       OffsetIndexBuilder* offset_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
@@ -167,7 +219,9 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        column_index_builder_(column_index_builder),
+        offset_index_builder_(offset_index_builder) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
@@ -231,10 +285,19 @@ class SerializedPageWriter : public PageWriter {
     return final_pos - start_pos;
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+    bloom_filter.WriteTo(sink_.get());
+    metadata_->SetBloomFilterOffset(offset);
+  }
+
   void Close(bool has_dictionary, bool fallback) override {
     if (meta_encryptor_ != nullptr) {
       UpdateEncryption(encryption::kColumnMetaData);
     }
+    if (offset_index_builder_ != nullptr) {
+      offset_index_builder_->Finish(/*final_position=*/0);
+    }
     // index_page_offset = -1 since they are not supported
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
@@ -309,6 +372,16 @@ class SerializedPageWriter : public PageWriter {
 
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
+    if (column_index_builder_ != nullptr) {
+      column_index_builder_->AddPage(page.statistics(), page.num_values());
+    }
+    if (offset_index_builder_ != nullptr) {
+      // Page indexes are only built for non-repeated columns, whose values
+      // are rows
+      offset_index_builder_->AddPage(start_pos,
+                                     static_cast<int32_t>(header_size + output_data_len),
+                                     /*first_row_index=*/num_values_);
+    }
     num_values_ += page.num_values();
 
     ++page_ordinal_;
@@ -405,6 +478,10 @@ class SerializedPageWriter : public PageWriter {
   std::shared_ptr<Encryptor> data_encryptor_;
 
   std::shared_ptr<ResizableBuffer> encryption_buffer_;
+
+  // Page index of the column chunk, if written
+  ColumnIndexBuilder* column_index_builder_;
+  OffsetIndexBuilder* offset_index_builder_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -415,13 +492,18 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
-      : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     ColumnIndexBuilder* column_index_builder = nullptr,
+                     OffsetIndexBuilder* offset_index_builder = nullptr)
+      : final_sink_(std::move(sink)),
+        metadata_(metadata),
+        has_dictionary_pages_(false),
+        offset_index_builder_(offset_index_builder) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), column_index_builder, offset_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -435,6 +517,9 @@ class BufferedPageWriter : public PageWriter {
     }
     // index_page_offset = -1 since they are not supported
     PARQUET_ASSIGN_OR_THROW(int64_t final_position, final_sink_->Tell());
+    if (offset_index_builder_ != nullptr) {
+      offset_index_builder_->Finish(final_position);
+    }
     // dictionary page offset should be 0 iff there are no dictionary pages
     auto dictionary_page_offset =
         has_dictionary_pages_ ? pager_->dictionary_page_offset() + final_position : 0;
@@ -455,6 +540,14 @@ class BufferedPageWriter : public PageWriter {
     return pager_->WriteDataPage(page);
   }
 
+  void WriteBloomFilter(const BloomFilter& bloom_filter) override {
+    // Pages are buffered until Close(), so offset by the final position
+    PARQUET_ASSIGN_OR_THROW(int64_t final_position, final_sink_->Tell());
+    PARQUET_ASSIGN_OR_THROW(int64_t offset, in_memory_sink_->Tell());
+    bloom_filter.WriteTo(in_memory_sink_.get());
+    metadata_->SetBloomFilterOffset(final_position + offset);
+  }
+
   void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) override {
     pager_->Compress(src_buffer, dest_buffer);
   }
@@ -467,6 +560,7 @@ class BufferedPageWriter : public PageWriter {
   std::shared_ptr<::arrow::io::BufferOutputStream> in_memory_sink_;
   std::unique_ptr<SerializedPageWriter> pager_;
   bool has_dictionary_pages_;
+  OffsetIndexBuilder* offset_index_builder_;
 };
 
 std::unique_ptr<PageWriter> PageWriter::Open(
@@ -474,17 +568,18 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor, ColumnIndexBuilder* column_index_builder,
+    OffsetIndexBuilder* offset_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        column_index_builder, offset_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        column_index_builder, offset_index_builder));
   }
 }
 
@@ -515,6 +610,7 @@ class ColumnWriterImpl {
         total_bytes_written_(0),
         total_compressed_bytes_(0),
         closed_(false),
+        pages_finished_(false),
         fallback_(false),
         definition_levels_sink_(allocator_),
         repetition_levels_sink_(allocator_) {
@@ -534,6 +630,8 @@ class ColumnWriterImpl {
 
   int64_t Close();
 
+  void FinishPages();
+
  protected:
   virtual std::shared_ptr<Buffer> GetValuesBuffer() = 0;
 
@@ -560,14 +658,14 @@ class ColumnWriterImpl {
 
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_finished_);
     PARQUET_THROW_NOT_OK(
         definition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
 
   // Write multiple repetition levels
   void WriteRepetitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_finished_);
     PARQUET_THROW_NOT_OK(
         repetition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
@@ -616,6 +714,9 @@ class ColumnWriterImpl {
   // Flag to check if the Writer has been closed
   bool closed_;
 
+  // Flag to check if all the pages have been encoded
+  bool pages_finished_;
+
   // Flag to infer if dictionary encoding has fallen back to PLAIN
   bool fallback_;
 
@@ -630,6 +731,9 @@ class ColumnWriterImpl {
 
   std::vector<CompressedDataPage> data_pages_;
 
+  // Values of the column chunk, if a Bloom filter is written
+  std::unique_ptr<BloomFilter> bloom_filter_;
+
  private:
   void InitSinks() {
     definition_levels_sink_.Rewind(0);
@@ -731,14 +835,21 @@ void ColumnWriterImpl::AddDataPage() {
   num_buffered_encoded_values_ = 0;
 }
 
-int64_t ColumnWriterImpl::Close() {
-  if (!closed_) {
-    closed_ = true;
+void ColumnWriterImpl::FinishPages() {
+  if (!pages_finished_) {
+    pages_finished_ = true;
     if (has_dictionary_ && !fallback_) {
       WriteDictionaryPage();
     }
 
     FlushBufferedDataPages();
+  }
+}
+
+int64_t ColumnWriterImpl::Close() {
+  if (!closed_) {
+    closed_ = true;
+    FinishPages();
 
     EncodedStatistics chunk_statistics = GetChunkStatistics();
     chunk_statistics.ApplyStatSizeLimits(
@@ -749,6 +860,9 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+    if (bloom_filter_ != nullptr) {
+      pager_->WriteBloomFilter(*bloom_filter_);
+    }
     pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -832,10 +946,30 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+
+    const auto encryption_properties =
+        properties->column_encryption_properties(descr_->path()->ToDotString());
+    const bool encrypted =
+        encryption_properties != nullptr && encryption_properties->is_encrypted();
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        DType::type_num != Type::BOOLEAN && !encrypted) {
+      const BloomFilterOptions& options =
+          properties->bloom_filter_options(descr_->path());
+      std::unique_ptr<BlockSplitBloomFilter> bloom_filter(new BlockSplitBloomFilter());
+      bloom_filter->Init(
+          BlockSplitBloomFilter::OptimalNumOfBits(options.ndv, options.fpp) / 8);
+      bloom_filter_ = std::move(bloom_filter);
+    }
+
+    if (use_dictionary && properties->dictionary_sample_size() > 0) {
+      dictionary_sample_.reset(new HyperLogLog());
+    }
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
 
+  void FinishPages() override { ColumnWriterImpl::FinishPages(); }
+
   void WriteBatch(int64_t num_values, const int16_t* def_levels,
                   const int16_t* rep_levels, const T* values) override {
     // We check for DataPage limits only after we have inserted the values. If a user
@@ -960,6 +1094,10 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   const WriterProperties* properties() override { return properties_; }
 
+  const DictionarySampleStatistics& dictionary_sample_statistics() const override {
+    return dictionary_sample_statistics_;
+  }
+
  private:
   using ValueEncoderType = typename EncodingTraits<DType>::Encoder;
   using TypedStats = TypedStatistics<DType>;
@@ -967,6 +1105,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
 
+  // Distinct values among the first values of the column chunk, while
+  // deciding whether to keep dictionary encoding it
+  std::unique_ptr<HyperLogLog> dictionary_sample_;
+  MurmurHash3 dictionary_sample_hasher_;
+  DictionarySampleStatistics dictionary_sample_statistics_;
+
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
   // subsequent array chunks to see either if materialization is required (in
@@ -1075,11 +1219,87 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
                                      properties_->memory_pool());
       encoding_ = Encoding::PLAIN;
+      dictionary_sample_.reset();
+    }
+  }
+
+  // Adds the hashes of the next non-null values to the dictionary sample,
+  // before they are encoded. insert_hashes(n) inserts the hashes of at most n
+  // values and returns their number. Once the sample is complete, dictionary
+  // encoding is abandoned if too many of the sampled values are distinct.
+  template <typename InsertHashes>
+  void SampleDictionaryValues(InsertHashes&& insert_hashes) {
+    if (dictionary_sample_ == nullptr) {
+      return;
+    }
+    ::arrow::internal::StopWatch watch;
+    watch.Start();
+    auto& stats = dictionary_sample_statistics_;
+    const int64_t sample_size = properties_->dictionary_sample_size();
+    stats.num_sampled_values += insert_hashes(sample_size - stats.num_sampled_values);
+    const bool sample_complete = stats.num_sampled_values >= sample_size;
+    if (sample_complete) {
+      stats.estimated_distinct_values = dictionary_sample_->Estimate();
+      stats.dictionary_rejected =
+          stats.estimated_distinct_values >
+          properties_->dictionary_max_distinct_ratio() * stats.num_sampled_values;
+      dictionary_sample_.reset();
+    }
+    stats.sampling_time_ns += static_cast<int64_t>(watch.Stop());
+    if (sample_complete && stats.dictionary_rejected) {
+      AbandonDictionaryEncoding();
+    }
+  }
+
+  void SampleDictionaryValues(const T* values, int64_t num_values) {
+    SampleDictionaryValues([&](int64_t max_values) {
+      const int64_t num_sampled = std::min(num_values, max_values);
+      for (int64_t i = 0; i < num_sampled; ++i) {
+        dictionary_sample_->InsertHash(
+            HashValue(dictionary_sample_hasher_, values[i], descr_->type_length()));
+      }
+      return num_sampled;
+    });
+  }
+
+  void SampleDictionaryValuesSpaced(const T* values, int64_t num_spaced_values,
+                                    const uint8_t* valid_bits,
+                                    int64_t valid_bits_offset) {
+    SampleDictionaryValues([&](int64_t max_values) {
+      int64_t num_sampled = 0;
+      ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                        num_spaced_values);
+      for (int64_t i = 0; i < num_spaced_values && num_sampled < max_values; ++i) {
+        if (valid_bits_reader.IsSet()) {
+          dictionary_sample_->InsertHash(
+              HashValue(dictionary_sample_hasher_, values[i], descr_->type_length()));
+          ++num_sampled;
+        }
+        valid_bits_reader.Next();
+      }
+      return num_sampled;
+    });
+  }
+
+  // Switches to the encoding the column would have without dictionary
+  // encoding. If values were already dictionary encoded, the buffered pages
+  // must be flushed, which is left to CheckDictionarySizeLimit() once the
+  // current batch is committed: it then falls back to PLAIN as when the
+  // dictionary page size limit is reached.
+  void AbandonDictionaryEncoding() {
+    auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+    if (dict_encoder->num_entries() > 0 || !data_pages_.empty()) {
+      return;
     }
+    has_dictionary_ = false;
+    encoding_ = properties_->encoding(descr_->path());
+    current_encoder_ = MakeEncoder(DType::type_num, encoding_, false, descr_,
+                                   properties_->memory_pool());
   }
 
-  // Checks if the Dictionary Page size limit is reached
-  // If the limit is reached, the Dictionary and Data Pages are serialized
+  // Checks if the Dictionary Page size limit is reached, or if the dictionary
+  // sample rejected dictionary encoding
+  // If so, the Dictionary and Data Pages are serialized
   // The encoding is switched to PLAIN
   //
   // Only one Dictionary Page is written.
@@ -1094,26 +1314,37 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     // We have to dynamic cast here because TypedEncoder<Type> as some compilers
     // don't want to cast through virtual inheritance
     auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
-    if (dict_encoder->dict_encoded_size() >= properties_->dictionary_pagesize_limit()) {
+    if (dict_encoder->dict_encoded_size() >= properties_->dictionary_pagesize_limit() ||
+        dictionary_sample_statistics_.dictionary_rejected) {
       FallbackToPlainEncoding();
     }
   }
 
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
+    SampleDictionaryValues(values, num_values);
     dynamic_cast<ValueEncoderType*>(current_encoder_.get())
         ->Put(values, static_cast<int>(num_values));
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        bloom_filter_->InsertHash(
+            HashValue(*bloom_filter_, values[i], descr_->type_length()));
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
                          const uint8_t* valid_bits, int64_t valid_bits_offset) {
     if (descr_->schema_node()->is_optional()) {
+      SampleDictionaryValuesSpaced(values, num_spaced_values, valid_bits,
+                                   valid_bits_offset);
       dynamic_cast<ValueEncoderType*>(current_encoder_.get())
           ->PutSpaced(values, static_cast<int>(num_spaced_values), valid_bits,
                       valid_bits_offset);
     } else {
+      SampleDictionaryValues(values, num_values);
       dynamic_cast<ValueEncoderType*>(current_encoder_.get())
           ->Put(values, static_cast<int>(num_values));
     }
@@ -1122,6 +1353,24 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (descr_->schema_node()->is_optional()) {
+        ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                          num_spaced_values);
+        for (int64_t i = 0; i < num_spaced_values; ++i) {
+          if (valid_bits_reader.IsSet()) {
+            bloom_filter_->InsertHash(
+                HashValue(*bloom_filter_, values[i], descr_->type_length()));
+          }
+          valid_bits_reader.Next();
+        }
+      } else {
+        for (int64_t i = 0; i < num_values; ++i) {
+          bloom_filter_->InsertHash(
+              HashValue(*bloom_filter_, values[i], descr_->type_length()));
+        }
+      }
+    }
   }
 };
 
@@ -1154,13 +1403,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. The Bloom filter is fed from
+    // the dense values too.
     return WriteDense();
   }
 
@@ -1601,10 +1851,30 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
                       &batch_num_spaced_values);
     std::shared_ptr<::arrow::Array> data_slice =
         array.Slice(value_offset, batch_num_spaced_values);
+    const auto& binary_slice = checked_cast<const ::arrow::BinaryArray&>(*data_slice);
+    SampleDictionaryValues([&](int64_t max_values) {
+      int64_t num_sampled = 0;
+      for (int64_t i = 0; i < binary_slice.length() && num_sampled < max_values; ++i) {
+        if (binary_slice.IsValid(i)) {
+          ByteArray value(binary_slice.GetView(i));
+          dictionary_sample_->InsertHash(dictionary_sample_hasher_.Hash(&value));
+          ++num_sampled;
+        }
+      }
+      return num_sampled;
+    });
     current_encoder_->Put(*data_slice);
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < binary_slice.length(); ++i) {
+        if (binary_slice.IsValid(i)) {
+          ByteArray value(binary_slice.GetView(i));
+          bloom_filter_->InsertHash(bloom_filter_->Hash(&value));
+        }
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
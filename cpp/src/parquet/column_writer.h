@@ -42,11 +42,14 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
+class ColumnIndexBuilder;
 class CompressedDataPage;
 class DictionaryPage;
 class ColumnChunkMetaDataBuilder;
 class Encryptor;
+class OffsetIndexBuilder;
 class WriterProperties;
 
 class PARQUET_EXPORT LevelEncoder {
@@ -90,7 +93,9 @@ class PARQUET_EXPORT PageWriter {
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       bool buffered_row_group = false,
       std::shared_ptr<Encryptor> header_encryptor = NULLPTR,
-      std::shared_ptr<Encryptor> data_encryptor = NULLPTR);
+      std::shared_ptr<Encryptor> data_encryptor = NULLPTR,
+      ColumnIndexBuilder* column_index_builder = NULLPTR,
+      OffsetIndexBuilder* offset_index_builder = NULLPTR);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
@@ -101,11 +106,30 @@ class PARQUET_EXPORT PageWriter {
 
   virtual int64_t WriteDictionaryPage(const DictionaryPage& page) = 0;
 
+  // Write a Bloom filter of the column chunk values after its pages and record
+  // its offset in the column chunk metadata. Must be called before Close()
+  virtual void WriteBloomFilter(const BloomFilter& bloom_filter) = 0;
+
   virtual bool has_compressor() = 0;
 
   virtual void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) = 0;
 };
 
+/// \brief How the first values of a column chunk were sampled to decide
+/// whether to dictionary-encode it, see
+/// WriterProperties::Builder::dictionary_sample_size
+struct PARQUET_EXPORT DictionarySampleStatistics {
+  /// The number of non-null values sampled
+  int64_t num_sampled_values = 0;
+  /// The estimated number of distinct sampled values, 0 until the sample is
+  /// complete
+  int64_t estimated_distinct_values = 0;
+  /// Whether dictionary encoding was abandoned because of the estimate
+  bool dictionary_rejected = false;
+  /// The time spent hashing the sampled values and deciding, in nanoseconds
+  int64_t sampling_time_ns = 0;
+};
+
 static constexpr int WRITE_BATCH_SIZE = 1000;
 class PARQUET_EXPORT ColumnWriter {
  public:
@@ -119,6 +143,13 @@ class PARQUET_EXPORT ColumnWriter {
   /// \return Total size of the column in bytes
   virtual int64_t Close() = 0;
 
+  /// \brief Encode and compress all the values written so far into pages
+  ///
+  /// No values may be written afterwards. Close is then left with writing the
+  /// column chunk metadata, which lets the column chunks of a buffered row
+  /// group be encoded concurrently before they are written in order.
+  virtual void FinishPages() = 0;
+
   /// \brief The physical Parquet type of the column
   virtual Type::type type() const = 0;
 
@@ -139,6 +170,10 @@ class PARQUET_EXPORT ColumnWriter {
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
+  /// \brief The outcome of the dictionary encoding sample of the column chunk,
+  /// all zeros if no sampling is done
+  virtual const DictionarySampleStatistics& dictionary_sample_statistics() const = 0;
+
   /// \brief Write Apache Arrow columnar data directly to ColumnWriter. Returns
   /// error status if the array data type is not compatible with the concrete
   /// writer type
@@ -25,6 +25,7 @@
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
+#include "parquet/file_writer.h"
 #include "parquet/metadata.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
@@ -382,22 +383,30 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+}
+*/
+
+// The DELTA_* encodings only apply to some physical types
+using TestInt32ValuesWriter = TestPrimitiveWriter<Int32Type>;
+TEST_F(TestInt32ValuesWriter, RequiredDeltaBinaryPacked) {
   this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+using TestByteArrayDeltaWriter = TestPrimitiveWriter<ByteArrayType>;
+TEST_F(TestByteArrayDeltaWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+TEST_F(TestByteArrayDeltaWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
 }
-*/
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
@@ -681,6 +690,159 @@ TEST_F(TestByteArrayValuesWriter, CheckDefaultStats) {
   ASSERT_TRUE(this->metadata_is_stats_set());
 }
 
+// Dictionary encoding decided from a sample of the first values of an
+// optional INT32 column chunk
+class TestDictionarySample : public ::testing::Test {
+ public:
+  static constexpr int64_t kSampleSize = 500;
+  static constexpr int kNumValues = 10000;
+
+  void SetUp() override {
+    auto node = PrimitiveNode::Make("int32", Repetition::OPTIONAL, Type::INT32);
+    schema_.Init(GroupNode::Make("schema", Repetition::REQUIRED, {node}));
+  }
+
+  // Write num_distinct distinct values with every tenth value null, in
+  // batches of batch_size levels
+  void WriteColumn(int num_distinct, int64_t sample_size, int batch_size) {
+    def_levels_.clear();
+    values_.clear();
+    for (int i = 0; i < kNumValues; ++i) {
+      def_levels_.push_back(i % 10 == 9 ? 0 : 1);
+      if (def_levels_.back() == 1) {
+        values_.push_back(static_cast<int32_t>(values_.size() % num_distinct));
+      }
+    }
+
+    sink_ = CreateOutputStream();
+    // Dictionary page offsets of 0 are not recorded in the column metadata,
+    // so start after a file header
+    PARQUET_THROW_NOT_OK(sink_->Write(kParquetMagic, 4));
+    properties_ =
+        WriterProperties::Builder().dictionary_sample_size(sample_size)->build();
+    metadata_ = ColumnChunkMetaDataBuilder::Make(properties_, schema_.Column(0));
+    std::unique_ptr<PageWriter> pager =
+        PageWriter::Open(sink_, Compression::UNCOMPRESSED,
+                         Codec::UseDefaultCompressionLevel(), metadata_.get());
+    writer_ = ColumnWriter::Make(metadata_.get(), std::move(pager), properties_.get());
+    auto typed_writer = std::static_pointer_cast<TypedColumnWriter<Int32Type>>(writer_);
+    int64_t value_offset = 0;
+    for (int offset = 0; offset < kNumValues; offset += batch_size) {
+      const int num_levels = std::min(batch_size, kNumValues - offset);
+      typed_writer->WriteBatch(num_levels, def_levels_.data() + offset, nullptr,
+                               values_.data() + value_offset);
+      value_offset +=
+          std::count(def_levels_.begin() + offset,
+                     def_levels_.begin() + offset + num_levels, static_cast<int16_t>(1));
+    }
+    writer_->Close();
+  }
+
+  void ReadAndCompare() {
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink_->Finish());
+    auto source = std::make_shared<::arrow::io::BufferReader>(
+        ::arrow::SliceBuffer(buffer, 4, buffer->size() - 4));
+    std::unique_ptr<PageReader> page_reader =
+        PageReader::Open(std::move(source), kNumValues, Compression::UNCOMPRESSED);
+    auto reader = std::static_pointer_cast<TypedColumnReader<Int32Type>>(
+        ColumnReader::Make(schema_.Column(0), std::move(page_reader)));
+    std::vector<int16_t> def_levels_out(kNumValues);
+    std::vector<int32_t> values_out(kNumValues);
+    int64_t levels_read = 0;
+    int64_t values_read = 0;
+    while (levels_read < kNumValues) {
+      int64_t batch_values_read = 0;
+      const int64_t batch_levels_read = reader->ReadBatch(
+          kNumValues - levels_read, def_levels_out.data() + levels_read, nullptr,
+          values_out.data() + values_read, &batch_values_read);
+      ASSERT_GT(batch_levels_read, 0);
+      levels_read += batch_levels_read;
+      values_read += batch_values_read;
+    }
+    values_out.resize(values_read);
+    ASSERT_EQ(def_levels_, def_levels_out);
+    ASSERT_EQ(values_, values_out);
+  }
+
+  std::unique_ptr<ColumnChunkMetaData> metadata() {
+    return ColumnChunkMetaData::Make(metadata_->contents(), schema_.Column(0));
+  }
+
+ protected:
+  SchemaDescriptor schema_;
+  std::vector<int16_t> def_levels_;
+  std::vector<int32_t> values_;
+  std::shared_ptr<::arrow::io::BufferOutputStream> sink_;
+  std::shared_ptr<WriterProperties> properties_;
+  std::unique_ptr<ColumnChunkMetaDataBuilder> metadata_;
+  std::shared_ptr<ColumnWriter> writer_;
+};
+
+constexpr int64_t TestDictionarySample::kSampleSize;
+
+TEST_F(TestDictionarySample, Disabled) {
+  ASSERT_NO_FATAL_FAILURE(WriteColumn(kNumValues, /*sample_size=*/0, kNumValues));
+  const auto& stats = writer_->dictionary_sample_statistics();
+  ASSERT_EQ(0, stats.num_sampled_values);
+  ASSERT_EQ(0, stats.estimated_distinct_values);
+  ASSERT_FALSE(stats.dictionary_rejected);
+  ASSERT_EQ(0, stats.sampling_time_ns);
+  ASSERT_TRUE(metadata()->has_dictionary_page());
+  ASSERT_NO_FATAL_FAILURE(ReadAndCompare());
+}
+
+TEST_F(TestDictionarySample, LowCardinality) {
+  ASSERT_NO_FATAL_FAILURE(WriteColumn(/*num_distinct=*/10, kSampleSize, kNumValues));
+  const auto& stats = writer_->dictionary_sample_statistics();
+  ASSERT_EQ(kSampleSize, stats.num_sampled_values);
+  ASSERT_EQ(10, stats.estimated_distinct_values);
+  ASSERT_FALSE(stats.dictionary_rejected);
+  ASSERT_TRUE(metadata()->has_dictionary_page());
+  std::vector<Encoding::type> expected(
+      {Encoding::PLAIN_DICTIONARY, Encoding::PLAIN, Encoding::RLE});
+  ASSERT_EQ(expected, metadata()->encodings());
+  ASSERT_NO_FATAL_FAILURE(ReadAndCompare());
+}
+
+TEST_F(TestDictionarySample, HighCardinality) {
+  // The whole sample is in the first write_batch_size values, so that no value
+  // is dictionary encoded
+  ASSERT_NO_FATAL_FAILURE(WriteColumn(kNumValues, kSampleSize, kNumValues));
+  const auto& stats = writer_->dictionary_sample_statistics();
+  ASSERT_EQ(kSampleSize, stats.num_sampled_values);
+  ASSERT_NEAR(kSampleSize, stats.estimated_distinct_values, kSampleSize / 20);
+  ASSERT_TRUE(stats.dictionary_rejected);
+  ASSERT_FALSE(metadata()->has_dictionary_page());
+  std::vector<Encoding::type> expected({Encoding::PLAIN, Encoding::RLE});
+  ASSERT_EQ(expected, metadata()->encodings());
+  ASSERT_NO_FATAL_FAILURE(ReadAndCompare());
+}
+
+TEST_F(TestDictionarySample, HighCardinalityAcrossBatches) {
+  // The values of the batches written before the sample is complete are
+  // already dictionary encoded, so the column chunk falls back to PLAIN
+  ASSERT_NO_FATAL_FAILURE(WriteColumn(kNumValues, kSampleSize, /*batch_size=*/50));
+  const auto& stats = writer_->dictionary_sample_statistics();
+  ASSERT_EQ(kSampleSize, stats.num_sampled_values);
+  ASSERT_TRUE(stats.dictionary_rejected);
+  ASSERT_TRUE(metadata()->has_dictionary_page());
+  std::vector<Encoding::type> expected(
+      {Encoding::PLAIN_DICTIONARY, Encoding::PLAIN, Encoding::RLE, Encoding::PLAIN});
+  ASSERT_EQ(expected, metadata()->encodings());
+  ASSERT_NO_FATAL_FAILURE(ReadAndCompare());
+}
+
+TEST_F(TestDictionarySample, SmallerThanSample) {
+  // Too few values to decide, dictionary encoding is kept
+  ASSERT_NO_FATAL_FAILURE(WriteColumn(kNumValues, 2 * kNumValues, kNumValues));
+  const auto& stats = writer_->dictionary_sample_statistics();
+  ASSERT_EQ(9 * kNumValues / 10, stats.num_sampled_values);
+  ASSERT_EQ(0, stats.estimated_distinct_values);
+  ASSERT_FALSE(stats.dictionary_rejected);
+  ASSERT_TRUE(metadata()->has_dictionary_page());
+  ASSERT_NO_FATAL_FAILURE(ReadAndCompare());
+}
+
 TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   // In ARROW-3930 we discovered a bug when writing from Arrow when we had data
   // that looks like this:
@@ -914,6 +914,440 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+// DELTA_BINARY_PACKED pages start with a header holding the block size, the
+// number of miniblocks per block, the total number of values and the first
+// value. Each block of deltas between consecutive values then stores its
+// minimum delta, the bit width of each miniblock and the bit packed deltas
+// minus the minimum delta, miniblock by miniblock.
+constexpr int kDeltaValuesPerBlock = 128;
+constexpr int kDeltaMiniBlocksPerBlock = 4;
+constexpr int kDeltaValuesPerMiniBlock = kDeltaValuesPerBlock / kDeltaMiniBlocksPerBlock;
+
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        sink_(pool),
+        block_buffer_(AllocateBuffer(pool, kMaxBlockSize)),
+        block_writer_(block_buffer_->mutable_data(), kMaxBlockSize) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderSize + sink_.length() + num_block_values_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  using BitReader = ::arrow::BitUtil::BitReader;
+
+  // Upper bounds of the encoded sizes of the header and of a block
+  static constexpr int kMaxHeaderSize =
+      3 * BitReader::MAX_VLQ_BYTE_LEN + BitReader::MAX_VLQ_BYTE_LEN_64;
+  static constexpr int kMaxBlockSize = BitReader::MAX_VLQ_BYTE_LEN_64 +
+                                       kDeltaMiniBlocksPerBlock +
+                                       kDeltaValuesPerBlock * static_cast<int>(sizeof(T));
+
+  void FlushBlock();
+
+  // The encoded blocks, the header is only known once all values are put
+  ::arrow::BufferBuilder sink_;
+  std::shared_ptr<ResizableBuffer> block_buffer_;
+  ::arrow::BitUtil::BitWriter block_writer_;
+
+  // The deltas of the current block, computed with wrapping unsigned arithmetic
+  UT deltas_[kDeltaValuesPerBlock];
+  int num_block_values_ = 0;
+  int64_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) return;
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+  while (idx < num_values) {
+    const int n = std::min(num_values - idx, kDeltaValuesPerBlock - num_block_values_);
+    const T* values = src + idx;
+    UT* deltas = deltas_ + num_block_values_;
+    deltas[0] = static_cast<UT>(values[0]) - static_cast<UT>(current_value_);
+    for (int i = 1; i < n; ++i) {
+      deltas[i] = static_cast<UT>(values[i]) - static_cast<UT>(values[i - 1]);
+    }
+    current_value_ = values[n - 1];
+    num_block_values_ += n;
+    idx += n;
+    if (num_block_values_ == kDeltaValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (num_block_values_ == 0) return;
+
+  T min_delta = static_cast<T>(deltas_[0]);
+  for (int i = 1; i < num_block_values_; ++i) {
+    min_delta = std::min(min_delta, static_cast<T>(deltas_[i]));
+  }
+
+  // The last miniblock is padded with zeros once the minimum delta is
+  // subtracted
+  const int num_mini_blocks =
+      static_cast<int>(BitUtil::CeilDiv(num_block_values_, kDeltaValuesPerMiniBlock));
+  const int num_padded_values = num_mini_blocks * kDeltaValuesPerMiniBlock;
+  for (int i = num_block_values_; i < num_padded_values; ++i) {
+    deltas_[i] = static_cast<UT>(min_delta);
+  }
+  for (int i = 0; i < num_padded_values; ++i) {
+    deltas_[i] -= static_cast<UT>(min_delta);
+  }
+
+  block_writer_.Clear();
+  if (!block_writer_.PutZigZagVlqInt(min_delta)) {
+    throw ParquetException("Delta bit pack block overflow");
+  }
+  uint8_t* bit_widths = block_writer_.GetNextBytePtr(kDeltaMiniBlocksPerBlock);
+  DCHECK(bit_widths != nullptr);
+  for (int m = 0; m < kDeltaMiniBlocksPerBlock; ++m) {
+    if (m >= num_mini_blocks) {
+      // Unused miniblocks are not written but still have a bit width
+      bit_widths[m] = 0;
+      continue;
+    }
+    // The bit width of the largest delta is the one of their bitwise or
+    const UT* deltas = deltas_ + m * kDeltaValuesPerMiniBlock;
+    UT all_bits = 0;
+    for (int i = 0; i < kDeltaValuesPerMiniBlock; ++i) {
+      all_bits |= deltas[i];
+    }
+    bit_widths[m] = static_cast<uint8_t>(BitUtil::NumRequiredBits(all_bits));
+  }
+  for (int m = 0; m < num_mini_blocks; ++m) {
+    const int bit_width = bit_widths[m];
+    if (bit_width == 0) continue;
+    const UT* deltas = deltas_ + m * kDeltaValuesPerMiniBlock;
+    for (int i = 0; i < kDeltaValuesPerMiniBlock; ++i) {
+      block_writer_.PutValue(deltas[i], bit_width);
+    }
+  }
+  block_writer_.Flush();
+
+  PARQUET_THROW_NOT_OK(
+      sink_.Append(block_buffer_->data(), block_writer_.bytes_written()));
+  num_block_values_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderSize];
+  ::arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderSize);
+  if (!header_writer.PutVlqInt(kDeltaValuesPerBlock) ||
+      !header_writer.PutVlqInt(kDeltaMiniBlocksPerBlock) ||
+      !header_writer.PutVlqInt(static_cast<uint32_t>(total_value_count_)) ||
+      !header_writer.PutZigZagVlqInt(first_value_)) {
+    throw ParquetException("Delta bit pack header overflow");
+  }
+  header_writer.Flush();
+  const int header_len = header_writer.bytes_written();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_len + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_len);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_len, sink_.data(), sink_.length());
+  }
+
+  sink_.Rewind(0);
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  using ArrayType = typename ::arrow::CTypeTraits<T>::ArrayType;
+  if (values.type_id() != ArrayType::TypeClass::type_id) {
+    std::string type_name = ArrayType::TypeClass::type_name();
+    throw ParquetException("direct put to " + type_name + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+              data.null_bitmap_data(), data.offset());
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
+                                           const uint8_t* valid_bits,
+                                           int64_t valid_bits_offset) {
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), num_values * sizeof(T));
+  T* data = reinterpret_cast<T*>(buffer->mutable_data());
+  int num_valid_values = 0;
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  for (int i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      data[num_valid_values++] = src[i];
+    }
+    valid_bits_reader.Next();
+  }
+  Put(data, num_valid_values);
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+// The lengths of the values, DELTA_BINARY_PACKED encoded, then the
+// concatenated values
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const ByteArray* src, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  ::arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  std::vector<int32_t> lengths_;
+};
+
+void DeltaLengthByteArrayEncoder::Put(const ByteArray* src, int num_values) {
+  lengths_.resize(num_values);
+  int64_t total_length = 0;
+  for (int i = 0; i < num_values; ++i) {
+    lengths_[i] = static_cast<int32_t>(src[i].len);
+    total_length += src[i].len;
+  }
+  length_encoder_.Put(lengths_.data(), num_values);
+
+  PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+  for (int i = 0; i < num_values; ++i) {
+    sink_.UnsafeAppend(src[i].ptr, src[i].len);
+  }
+}
+
+void DeltaLengthByteArrayEncoder::Put(const ::arrow::Array& values) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const ::arrow::BinaryArray&>(values);
+  const int num_values = static_cast<int>(data.length());
+  if (data.null_count() == 0) {
+    // The values are contiguous in the array data
+    const int32_t* offsets = data.raw_value_offsets();
+    lengths_.resize(num_values);
+    for (int i = 0; i < num_values; ++i) {
+      lengths_[i] = offsets[i + 1] - offsets[i];
+    }
+    length_encoder_.Put(lengths_.data(), num_values);
+    PARQUET_THROW_NOT_OK(sink_.Append(data.value_data()->data() + offsets[0],
+                                      offsets[num_values] - offsets[0]));
+    return;
+  }
+  std::vector<ByteArray> valid_values;
+  valid_values.reserve(num_values - data.null_count());
+  for (int i = 0; i < num_values; ++i) {
+    if (data.IsValid(i)) {
+      valid_values.emplace_back(data.GetView(i));
+    }
+  }
+  Put(valid_values.data(), static_cast<int>(valid_values.size()));
+}
+
+void DeltaLengthByteArrayEncoder::PutSpaced(const ByteArray* src, int num_values,
+                                            const uint8_t* valid_bits,
+                                            int64_t valid_bits_offset) {
+  std::vector<ByteArray> valid_values;
+  valid_values.reserve(num_values);
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  for (int i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      valid_values.push_back(src[i]);
+    }
+    valid_bits_reader.Next();
+  }
+  Put(valid_values.data(), static_cast<int>(valid_values.size()));
+}
+
+std::shared_ptr<Buffer> DeltaLengthByteArrayEncoder::FlushValues() {
+  std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+  memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+  }
+  sink_.Rewind(0);
+  return std::move(buffer);
+}
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+// The length of the prefix each value shares with the previous one,
+// DELTA_BINARY_PACKED encoded, then the remaining suffixes,
+// DELTA_LENGTH_BYTE_ARRAY encoded
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const ByteArray* src, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  // The last value put, the first value of a page has no prefix
+  std::string last_value_;
+  std::vector<int32_t> prefix_lengths_;
+  std::vector<ByteArray> suffixes_;
+};
+
+// The length of the common prefix of a and b, both of at least length bytes
+inline uint32_t CommonPrefixLength(const uint8_t* a, const uint8_t* b,
+                                   uint32_t length) {
+  uint32_t i = 0;
+  // Compare 8 bytes at a time until they differ
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    if (arrow::util::SafeLoadAs<uint64_t>(a + i) !=
+        arrow::util::SafeLoadAs<uint64_t>(b + i)) {
+      break;
+    }
+  }
+  while (i < length && a[i] == b[i]) {
+    ++i;
+  }
+  return i;
+}
+
+void DeltaByteArrayEncoder::Put(const ByteArray* src, int num_values) {
+  if (num_values == 0) return;
+  prefix_lengths_.resize(num_values);
+  suffixes_.resize(num_values);
+
+  // Values are compared with the previous one in src, only the last one is
+  // copied for the next call
+  const uint8_t* last_ptr = reinterpret_cast<const uint8_t*>(last_value_.data());
+  uint32_t last_len = static_cast<uint32_t>(last_value_.size());
+  for (int i = 0; i < num_values; ++i) {
+    const ByteArray& value = src[i];
+    const uint32_t prefix_length =
+        CommonPrefixLength(last_ptr, value.ptr, std::min(last_len, value.len));
+    prefix_lengths_[i] = static_cast<int32_t>(prefix_length);
+    suffixes_[i] = ByteArray(value.len - prefix_length, value.ptr + prefix_length);
+    last_ptr = value.ptr;
+    last_len = value.len;
+  }
+  last_value_.assign(reinterpret_cast<const char*>(last_ptr), last_len);
+
+  prefix_length_encoder_.Put(prefix_lengths_.data(), num_values);
+  suffix_encoder_.Put(suffixes_.data(), num_values);
+}
+
+void DeltaByteArrayEncoder::Put(const ::arrow::Array& values) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const ::arrow::BinaryArray&>(values);
+  std::vector<ByteArray> valid_values;
+  valid_values.reserve(data.length() - data.null_count());
+  for (int64_t i = 0; i < data.length(); ++i) {
+    if (data.IsValid(i)) {
+      valid_values.emplace_back(data.GetView(i));
+    }
+  }
+  Put(valid_values.data(), static_cast<int>(valid_values.size()));
+}
+
+void DeltaByteArrayEncoder::PutSpaced(const ByteArray* src, int num_values,
+                                      const uint8_t* valid_bits,
+                                      int64_t valid_bits_offset) {
+  std::vector<ByteArray> valid_values;
+  valid_values.reserve(num_values);
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  for (int i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      valid_values.push_back(src[i]);
+    }
+    valid_bits_reader.Next();
+  }
+  Put(valid_values.data(), static_cast<int>(valid_values.size()));
+}
+
+std::shared_ptr<Buffer> DeltaByteArrayEncoder::FlushValues() {
+  std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+  std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+  std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer(
+      this->memory_pool(), prefix_lengths->size() + suffixes->size());
+  memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+  memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+         suffixes->size());
+  last_value_.clear();
+  return std::move(buffer);
+}
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -974,6 +1408,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -1654,7 +2108,51 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     return num_values;
   }
 
+  void GetDictionary(const T** dictionary, int32_t* dictionary_length) override {
+    *dictionary = reinterpret_cast<const T*>(dictionary_->data());
+    *dictionary_length = dictionary_length_;
+  }
+
+  int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset, int32_t* indices) override {
+    // The slots of nulls are not always written
+    std::fill(indices, indices + num_values, 0);
+    if (num_values != idx_decoder_.GetBatchSpaced(num_values, null_count, valid_bits,
+                                                  valid_bits_offset, indices)) {
+      ParquetException::EofException();
+    }
+    CheckIndices(indices, num_values, null_count);
+    num_values_ -= num_values - null_count;
+    return num_values;
+  }
+
+  int DecodeIndices(int num_values, int32_t* indices) override {
+    num_values = std::min(num_values, num_values_);
+    if (num_values != idx_decoder_.GetBatch(indices, num_values)) {
+      ParquetException::EofException();
+    }
+    CheckIndices(indices, num_values, /*null_count=*/0);
+    num_values_ -= num_values;
+    return num_values;
+  }
+
  protected:
+  // Indices are handed out without being looked up in the dictionary, make
+  // sure that they can be
+  void CheckIndices(const int32_t* indices, int num_values, int null_count) {
+    if (num_values == null_count) {
+      // Only the zeros of nulls, valid even with an empty dictionary
+      return;
+    }
+    uint32_t max_index = 0;
+    for (int i = 0; i < num_values; ++i) {
+      max_index = std::max(max_index, static_cast<uint32_t>(indices[i]));
+    }
+    if (max_index >= static_cast<uint32_t>(dictionary_length_)) {
+      throw ParquetException("Dictionary index out of bounds");
+    }
+  }
+
   inline void DecodeDict(TypedDecoder<Type>* dictionary) {
     dictionary_length_ = static_cast<int32_t>(dictionary->values_left());
     PARQUET_THROW_NOT_OK(dictionary_->Resize(dictionary_length_ * sizeof(T),
@@ -2124,6 +2622,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2134,12 +2633,18 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   }
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    this->num_values_ = num_values;
+    DecoderImpl::SetData(num_values, data, len);
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
+  /// The number of values in the data, which excludes nulls
+  int ValidValuesCount() const { return total_value_count_; }
+
+  /// The number of bytes of the data consumed so far. Once all the values
+  /// are decoded, this is the size of the encoded data.
+  int BytesConsumed() { return len_ - decoder_.bytes_left(); }
+
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
@@ -2147,204 +2652,387 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    const std::vector<T> values = DecodeValidValues(num_values - null_count);
+    if (null_count == 0) {
+      PARQUET_THROW_NOT_OK(out->AppendValues(values));
+      return num_values;
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    auto value = values.begin();
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        out->UnsafeAppend(*value++);
+      } else {
+        out->UnsafeAppendNull();
+      }
+      bit_reader.Next();
+    }
+    return static_cast<int>(values.size());
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+    const std::vector<T> values = DecodeValidValues(num_values - null_count);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
+    if (null_count == 0) {
+      for (T value : values) {
+        PARQUET_THROW_NOT_OK(out->Append(value));
+      }
+      return num_values;
     }
-    return num_values;
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    auto value = values.begin();
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        PARQUET_THROW_NOT_OK(out->Append(*value++));
+      } else {
+        PARQUET_THROW_NOT_OK(out->AppendNull());
+      }
+      bit_reader.Next();
+    }
+    return static_cast<int>(values.size());
   }
 
  private:
-  void InitBlock() {
+  // The header is written once per page, before the blocks
+  void InitHeader() {
     int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+    if (!decoder_.GetVlqInt(&block_size) || !decoder_.GetVlqInt(&num_mini_blocks_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&last_value_)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (block_size <= 0 || block_size % 128 != 0 || num_mini_blocks_ <= 0 ||
+        block_size % num_mini_blocks_ != 0 ||
+        (block_size / num_mini_blocks_) % 32 != 0 || total_value_count_ < 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = block_size / num_mini_blocks_;
+    total_values_remaining_ = total_value_count_;
+    first_value_pending_ = total_value_count_ > 0;
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    bit_widths_.resize(num_mini_blocks_);
+    mini_block_deltas_.resize(values_per_mini_block_);
+    // The first delta starts a new block
+    mini_block_idx_ = num_mini_blocks_;
+    mini_block_values_left_ = 0;
+  }
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
+  void InitBlock() {
+    T min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
     for (int i = 0; i < num_mini_blocks_; ++i) {
-      if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
+      if (!decoder_.GetAligned<uint8_t>(1, &bit_widths_[i])) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
+  // Unpack the whole next miniblock, the deltas are then summed in
+  // GetInternal
+  void InitMiniBlock() {
+    if (mini_block_idx_ == num_mini_blocks_) {
+      InitBlock();
+    }
+    const int bit_width = bit_widths_[mini_block_idx_++];
+    if (bit_width > static_cast<int>(sizeof(T) * 8)) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED bit width");
+    }
+    UT* deltas = mini_block_deltas_.data();
+    if (bit_width == 0) {
+      std::fill(deltas, deltas + values_per_mini_block_, UT(0));
+    } else if (decoder_.GetBatch(bit_width, deltas, values_per_mini_block_) !=
+               values_per_mini_block_) {
+      ParquetException::EofException();
+    }
+    for (int i = 0; i < values_per_mini_block_; ++i) {
+      deltas[i] += min_delta_;
+    }
+    mini_block_values_left_ = values_per_mini_block_;
+  }
+
+  // Decode the values of the non-null slots, all of which must be present
+  std::vector<T> DecodeValidValues(int num_values) {
+    std::vector<T> values(num_values);
+    if (GetInternal(values.data(), num_values) != num_values) {
+      ParquetException::EofException();
+    }
+    return values;
+  }
+
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
+    max_values = std::min(max_values, total_values_remaining_);
+    int i = 0;
+    if (max_values > 0 && first_value_pending_) {
+      buffer[i++] = last_value_;
+      first_value_pending_ = false;
+    }
+    while (i < max_values) {
+      if (mini_block_values_left_ == 0) {
+        InitMiniBlock();
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int n = std::min(max_values - i, mini_block_values_left_);
+      const UT* deltas =
+          mini_block_deltas_.data() + values_per_mini_block_ - mini_block_values_left_;
+      // Wrapping unsigned arithmetic, as in the encoder
+      UT value = static_cast<UT>(last_value_);
+      for (int j = 0; j < n; ++j) {
+        value += deltas[j];
+        buffer[i + j] = static_cast<T>(value);
+      }
+      last_value_ = static_cast<T>(value);
+      mini_block_values_left_ -= n;
+      i += n;
     }
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
   int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
-  std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
-
-  int32_t last_value_;
+  int values_per_mini_block_;
+  int32_t total_value_count_ = 0;
+  int total_values_remaining_ = 0;
+  bool first_value_pending_ = false;
+
+  UT min_delta_;
+  int mini_block_idx_;
+  std::vector<uint8_t> bit_widths_;
+  std::vector<UT> mini_block_deltas_;
+  int mini_block_values_left_;
+
+  T last_value_;
 };
 
 // ----------------------------------------------------------------------
-// DELTA_LENGTH_BYTE_ARRAY
+// Base of the DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY decoders, which
+// decode all the values of a page in SetData since their lengths precede
+// them in the data
 
-class DeltaLengthByteArrayDecoder : public DecoderImpl,
-                                    virtual public TypedDecoder<ByteArrayType> {
+class DeltaByteArrayDecoderBase : public DecoderImpl,
+                                  virtual public TypedDecoder<ByteArrayType> {
  public:
-  explicit DeltaLengthByteArrayDecoder(const ColumnDescriptor* descr,
-                                       MemoryPool* pool = arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
-        len_decoder_(nullptr, pool),
-        pool_(pool) {}
-
-  void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
-  }
-
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
-    max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
-    for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
-      buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
-    }
-    this->num_values_ -= max_values;
+    max_values = std::min(max_values, num_values_left());
+    std::copy(values_.begin() + next_value_, values_.begin() + next_value_ + max_values,
+              buffer);
+    next_value_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeArrowDense(num_values, null_count, valid_bits,
+                                          valid_bits_offset, out, &result));
+    return result;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeArrowDict(num_values, null_count, valid_bits,
+                                         valid_bits_offset, out, &result));
+    return result;
+  }
+
+  int DecodeArrowNonNull(
+      int num_values, typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeArrowDense(num_values, 0, NULLPTR, 0, out, &result));
+    return result;
+  }
+
+  int DecodeArrowNonNull(
+      int num_values,
+      typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeArrowDict(num_values, 0, NULLPTR, 0, out, &result));
+    return result;
+  }
+
+ protected:
+  DeltaByteArrayDecoderBase(const ColumnDescriptor* descr, Encoding::type encoding)
+      : DecoderImpl(descr, encoding) {}
+
+  int num_values_left() const {
+    return static_cast<int>(values_.size()) - next_value_;
+  }
+
+  std::vector<ByteArray> values_;
+  int next_value_ = 0;
+
+ private:
+  Status DecodeArrowDense(int num_values, int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out,
+                          int* out_values_decoded) {
+    const int values_to_decode = num_values - null_count;
+    if (ARROW_PREDICT_FALSE(num_values_left() < values_to_decode)) {
+      ParquetException::EofException();
+    }
+    ArrowBinaryHelper helper(out);
+
+    RETURN_NOT_OK(helper.builder->Reserve(num_values));
+    for (int i = 0; i < num_values; ++i) {
+      if (null_count == 0 || BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        const ByteArray& value = values_[next_value_++];
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+          RETURN_NOT_OK(helper.builder->Reserve(num_values - i));
+        }
+        RETURN_NOT_OK(helper.Append(value.ptr, static_cast<int32_t>(value.len)));
+      } else {
+        helper.UnsafeAppendNull();
+      }
+    }
+
+    num_values_ -= values_to_decode;
+    *out_values_decoded = values_to_decode;
+    return Status::OK();
+  }
+
+  Status DecodeArrowDict(int num_values, int null_count, const uint8_t* valid_bits,
+                         int64_t valid_bits_offset,
+                         typename EncodingTraits<ByteArrayType>::DictAccumulator* builder,
+                         int* out_values_decoded) {
+    const int values_to_decode = num_values - null_count;
+    if (ARROW_PREDICT_FALSE(num_values_left() < values_to_decode)) {
+      ParquetException::EofException();
+    }
+
+    RETURN_NOT_OK(builder->Reserve(num_values));
+    for (int i = 0; i < num_values; ++i) {
+      if (null_count == 0 || BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        const ByteArray& value = values_[next_value_++];
+        RETURN_NOT_OK(builder->Append(value.ptr, static_cast<int32_t>(value.len)));
+      } else {
+        RETURN_NOT_OK(builder->AppendNull());
+      }
+    }
+
+    num_values_ -= values_to_decode;
+    *out_values_decoded = values_to_decode;
+    return Status::OK();
+  }
+};
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY
+
+class DeltaLengthByteArrayDecoder : public DeltaByteArrayDecoderBase {
+ public:
+  explicit DeltaLengthByteArrayDecoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = arrow::default_memory_pool())
+      : DeltaByteArrayDecoderBase(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
+        len_decoder_(nullptr, pool) {}
+
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    DecoderImpl::SetData(num_values, data, len);
+    DecodeValues(data, len, &values_);
+    next_value_ = 0;
+  }
+
+  /// \brief Decode all the values of data, which point into it
+  ///
+  /// \return the number of bytes of data consumed
+  int DecodeValues(const uint8_t* data, int len, std::vector<ByteArray>* values) {
+    len_decoder_.SetData(0, data, len);
+    const int num_values = len_decoder_.ValidValuesCount();
+    lengths_.resize(num_values);
+    if (len_decoder_.Decode(lengths_.data(), num_values) != num_values) {
+      ParquetException::EofException();
+    }
+    int offset = len_decoder_.BytesConsumed();
+    values->resize(num_values);
+    for (int i = 0; i < num_values; ++i) {
+      const int32_t length = lengths_[i];
+      if (ARROW_PREDICT_FALSE(length < 0 || length > len - offset)) {
+        ParquetException::EofException();
+      }
+      (*values)[i] = ByteArray(static_cast<uint32_t>(length), data + offset);
+      offset += length;
+    }
+    return offset;
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  std::vector<int32_t> lengths_;
 };
 
 // ----------------------------------------------------------------------
 // DELTA_BYTE_ARRAY
 
-class DeltaByteArrayDecoder : public DecoderImpl,
-                              virtual public TypedDecoder<ByteArrayType> {
+class DeltaByteArrayDecoder : public DeltaByteArrayDecoderBase {
  public:
   explicit DeltaByteArrayDecoder(const ColumnDescriptor* descr,
                                  MemoryPool* pool = arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+      : DeltaByteArrayDecoderBase(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        buffer_(AllocateBuffer(pool, 0)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
-
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
-
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    DecoderImpl::SetData(num_values, data, len);
+
+    prefix_len_decoder_.SetData(0, data, len);
+    const int num_prefixes = prefix_len_decoder_.ValidValuesCount();
+    prefix_lengths_.resize(num_prefixes);
+    if (prefix_len_decoder_.Decode(prefix_lengths_.data(), num_prefixes) !=
+        num_prefixes) {
+      ParquetException::EofException();
     }
-    this->num_values_ -= max_values;
-    return max_values;
+    const int prefix_len_length = prefix_len_decoder_.BytesConsumed();
+    suffix_decoder_.DecodeValues(data + prefix_len_length, len - prefix_len_length,
+                                 &values_);
+    if (static_cast<int>(values_.size()) != num_prefixes) {
+      throw ParquetException("DELTA_BYTE_ARRAY prefix and suffix counts differ");
+    }
+
+    // Rebuild the values in an owned buffer, each one starts with a prefix of
+    // the previous one
+    int64_t total_length = 0;
+    for (int i = 0; i < num_prefixes; ++i) {
+      total_length += prefix_lengths_[i] + values_[i].len;
+    }
+    PARQUET_THROW_NOT_OK(buffer_->Resize(total_length, /*shrink_to_fit=*/false));
+    uint8_t* out = buffer_->mutable_data();
+    uint32_t last_len = 0;
+    const uint8_t* last_ptr = out;
+    for (int i = 0; i < num_prefixes; ++i) {
+      const int32_t prefix_len = prefix_lengths_[i];
+      if (ARROW_PREDICT_FALSE(prefix_len < 0 ||
+                              static_cast<uint32_t>(prefix_len) > last_len)) {
+        throw ParquetException("Invalid DELTA_BYTE_ARRAY prefix length");
+      }
+      const ByteArray suffix = values_[i];
+      memcpy(out, last_ptr, prefix_len);
+      memcpy(out + prefix_len, suffix.ptr, suffix.len);
+      last_len = prefix_len + suffix.len;
+      last_ptr = out;
+      values_[i] = ByteArray(last_len, out);
+      out += last_len;
+    }
+    next_value_ = 0;
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  std::vector<int32_t> prefix_lengths_;
+  // The decoded values of the current page
+  std::shared_ptr<ResizableBuffer> buffer_;
 };
 
 // ----------------------------------------------------------------------
@@ -2450,6 +3138,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -322,8 +322,9 @@ class TypedDecoder : virtual public Decoder {
   /// \return number of values decoded
   virtual int DecodeArrowNonNull(int num_values,
                                  typename EncodingTraits<DType>::Accumulator* out) {
-    const uint8_t valid_bits = 0;
-    return DecodeArrow(num_values, 0, &valid_bits, 0, out);
+    // All values are valid
+    std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_values), 0xFF);
+    return DecodeArrow(num_values, 0, valid_bits.data(), 0, out);
   }
 
   /// \brief Decode into a DictionaryBuilder
@@ -338,16 +339,23 @@ class TypedDecoder : virtual public Decoder {
   /// \return number of values decoded
   virtual int DecodeArrowNonNull(
       int num_values, typename EncodingTraits<DType>::DictAccumulator* builder) {
-    const uint8_t valid_bits = 0;
-    return DecodeArrow(num_values, 0, &valid_bits, 0, builder);
+    // All values are valid
+    std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_values), 0xFF);
+    return DecodeArrow(num_values, 0, valid_bits.data(), 0, builder);
   }
 };
 
 template <typename DType>
 class DictDecoder : virtual public TypedDecoder<DType> {
  public:
+  using T = typename DType::c_type;
+
   virtual void SetDict(TypedDecoder<DType>* dictionary) = 0;
 
+  /// \brief The decoded dictionary values, owned by the decoder and valid
+  /// until the next SetDict() call
+  virtual void GetDictionary(const T** dictionary, int32_t* dictionary_length) = 0;
+
   /// \brief Insert dictionary values into the Arrow dictionary builder's memo,
   /// but do not append any indices
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
@@ -367,6 +375,22 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   /// \warning Remember to reset the builder each time the dict decoder is initialized
   /// with a new dictionary page
   virtual int DecodeIndices(int num_values, ::arrow::ArrayBuilder* builder) = 0;
+
+  /// \brief Decode only dictionary indices, with a 0 index for each null
+  ///
+  /// Throws if an index is out of the bounds of the dictionary.
+  ///
+  /// \return number of values decoded, including nulls
+  virtual int DecodeIndicesSpaced(int num_values, int null_count,
+                                  const uint8_t* valid_bits, int64_t valid_bits_offset,
+                                  int32_t* indices) = 0;
+
+  /// \brief Decode only dictionary indices (no nulls)
+  ///
+  /// Throws if an index is out of the bounds of the dictionary.
+  ///
+  /// \return number of values decoded
+  virtual int DecodeIndices(int num_values, int32_t* indices) = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -29,7 +30,9 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/rle_encoding.h"
 
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
@@ -864,6 +867,55 @@ TEST_F(DictEncoding, CheckDecodeIndicesNoNulls) {
   CheckDict(actual_num_values, *builder);
 }
 
+TEST_F(DictEncoding, CheckDecodeIndicesToBuffer) {
+  for (auto np : null_probabilities_) {
+    InitTestCase(np);
+    std::vector<int32_t> indices(num_values_, -1);
+    ASSERT_EQ(num_values_, dict_decoder_->DecodeIndicesSpaced(
+                               num_values_, null_count_, valid_bits_, 0, indices.data()));
+
+    const ByteArray* dictionary;
+    int32_t dictionary_length;
+    dict_decoder_->GetDictionary(&dictionary, &dictionary_length);
+    for (int i = 0; i < num_values_; ++i) {
+      ASSERT_GE(indices[i], 0);
+      ASSERT_LT(indices[i], std::max(dictionary_length, 1));
+      if (::arrow::BitUtil::GetBit(valid_bits_, i)) {
+        ASSERT_EQ(input_data_[i], dictionary[indices[i]]);
+      }
+    }
+  }
+}
+
+TEST(TestDictDecoder, IndicesOutOfBounds) {
+  auto descr = ExampleDescr<Int32Type>();
+  std::vector<int32_t> dict_values = {1, 2, 3};
+  auto plain_encoder = MakeTypedEncoder<Int32Type>(Encoding::PLAIN, false, descr.get());
+  plain_encoder->Put(dict_values.data(), static_cast<int>(dict_values.size()));
+  auto dict_buffer = plain_encoder->FlushValues();
+  auto plain_decoder = MakeTypedDecoder<Int32Type>(Encoding::PLAIN, descr.get());
+  plain_decoder->SetData(static_cast<int>(dict_values.size()), dict_buffer->data(),
+                         static_cast<int>(dict_buffer->size()));
+
+  // Index 3, bit-packed with a bit width of 2
+  std::vector<int32_t> indices = {0, 1, 2, 3, 0, 1, 2, 3};
+  std::vector<uint8_t> data(1 + ::arrow::util::RleEncoder::MinBufferSize(2));
+  data[0] = 2;
+  ::arrow::util::RleEncoder encoder(data.data() + 1, static_cast<int>(data.size() - 1),
+                                    /*bit_width=*/2);
+  for (int32_t index : indices) {
+    ASSERT_TRUE(encoder.Put(index));
+  }
+  const int encoded_size = 1 + encoder.Flush();
+
+  auto dict_decoder = MakeDictDecoder<Int32Type>(descr.get());
+  dict_decoder->SetDict(plain_decoder.get());
+  dict_decoder->SetData(static_cast<int>(indices.size()), data.data(), encoded_size);
+  std::vector<int32_t> out(indices.size());
+  ASSERT_THROW(dict_decoder->DecodeIndices(static_cast<int>(indices.size()), out.data()),
+               ParquetException);
+}
+
 // ----------------------------------------------------------------------
 // BYTE_STREAM_SPLIT encode/decode tests.
 
@@ -1049,5 +1101,315 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    // Put in several batches so that blocks span them
+    const int batch_size = 100;
+    for (int i = 0; i < num_values_; i += batch_size) {
+      encoder->Put(draws_ + i, std::min(batch_size, num_values_ - i));
+    }
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    // Decode in steps which are not aligned with miniblocks
+    const int step = 37;
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int n = decoder->Decode(decode_buf_ + values_decoded, step);
+      ASSERT_GT(n, 0);
+      values_decoded += n;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_EQ(0, decoder->Decode(decode_buf_, step));
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+  void ExecuteValues(std::vector<T> values) {
+    num_values_ = static_cast<int>(values.size());
+    this->input_bytes_.resize(num_values_ * sizeof(T));
+    this->output_bytes_.resize(num_values_ * sizeof(T));
+    draws_ = reinterpret_cast<T*>(this->input_bytes_.data());
+    decode_buf_ = reinterpret_cast<T*>(this->output_bytes_.data());
+    std::copy(values.begin(), values.end(), draws_);
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(129, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(0, 1));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Sequences) {
+  using T = typename TypeParam::c_type;
+  std::vector<T> values(1000);
+  // Constant, then increasing and decreasing values
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<T>(i * 3);
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<T>(1000 - i * i);
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Extremes) {
+  using T = typename TypeParam::c_type;
+  // Deltas between extremes overflow T
+  std::vector<T> values;
+  for (int i = 0; i < 300; ++i) {
+    values.push_back(i % 2 == 0 ? std::numeric_limits<T>::min()
+                                : std::numeric_limits<T>::max());
+    if (i % 7 == 0) {
+      values.push_back(0);
+    }
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+}
+
+TEST(DeltaBitPackEncodeDecode, PutSpaced) {
+  const int32_t data[] = {1, 0, 5, 9, 0, -4, 7, 0, 0, 12, 3};
+  const int32_t valid_data[] = {1, 5, 9, -4, 7, 12, 3};
+  // The enable bits are: 10110110 011.
+  const uint8_t valid_bits[2] = {0x6DU, 0x6U};
+  const int num_values = sizeof(data) / sizeof(data[0U]);
+  const int num_valid_values = sizeof(valid_data) / sizeof(valid_data[0U]);
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->PutSpaced(data, num_values, valid_bits, 0);
+  std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  std::vector<int32_t> decoded(num_values);
+  ASSERT_EQ(num_values, decoder->DecodeSpaced(decoded.data(), num_values,
+                                              num_values - num_valid_values,
+                                              valid_bits, 0));
+  for (int i = 0; i < num_values; ++i) {
+    if (BitUtil::GetBit(valid_bits, i)) {
+      ASSERT_EQ(data[i], decoded[i]) << i;
+    }
+  }
+}
+
+TEST(DeltaBitPackEncodeDecode, DecodeArrowSpaced) {
+  auto expected = ::arrow::ArrayFromJSON(::arrow::int32(),
+                                         "[1, null, 5, 9, null, -4, 7, null, null, 12]");
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(*expected);
+  std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+  const int num_values = static_cast<int>(expected->length());
+  const int null_count = static_cast<int>(expected->null_count());
+  const uint8_t* valid_bits = expected->null_bitmap_data();
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  typename EncodingTraits<Int32Type>::Accumulator acc;
+  ASSERT_EQ(num_values - null_count,
+            decoder->DecodeArrow(num_values, null_count, valid_bits, 0, &acc));
+  std::shared_ptr<::arrow::Array> actual;
+  ASSERT_OK(acc.Finish(&actual));
+  ::arrow::AssertArraysEqual(*expected, *actual);
+
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  ::arrow::Dictionary32Builder<::arrow::Int32Type> dict_builder;
+  ASSERT_EQ(num_values - null_count,
+            decoder->DecodeArrow(num_values, null_count, valid_bits, 0, &dict_builder));
+  ASSERT_OK(dict_builder.Finish(&actual));
+  auto dict_type = ::arrow::dictionary(::arrow::int32(), ::arrow::int32());
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(),
+                                        "[0, null, 1, 2, null, 3, 4, null, null, 5]");
+  auto dictionary = ::arrow::ArrayFromJSON(::arrow::int32(), "[1, 5, 9, -4, 7, 12]");
+  std::shared_ptr<::arrow::Array> expected_dict;
+  ASSERT_OK(::arrow::DictionaryArray::FromArrays(dict_type, indices, dictionary,
+                                                 &expected_dict));
+  ::arrow::AssertArraysEqual(*expected_dict, *actual);
+}
+
+TEST(DeltaBitPackEncodeDecode, PutArrow) {
+  arrow::random::RandomArrayGenerator rag{1337};
+  const int num_values = 1000;
+  auto arr = rag.Int64(num_values, -1000, 1000, 0);
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(*arr);
+  std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+  std::vector<int64_t> decoded(num_values);
+  ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+  auto raw_values = checked_cast<const arrow::Int64Array&>(*arr).raw_values();
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(raw_values[i], decoded[i]) << i;
+  }
+
+  ASSERT_THROW(encoder->Put(*rag.Int32(10, 0, 10, 0)), ParquetException);
+}
+
+TEST(DeltaBitPackEncodeDecode, DecodeInvalidHeader) {
+  // A block size which is not a multiple of 128
+  const uint8_t data[] = {0x40, 0x04, 0x01, 0x00};
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  ASSERT_THROW(decoder->SetData(1, data, sizeof(data)), ParquetException);
+  ASSERT_THROW(decoder->SetData(1, data, 2), ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests
+
+class DeltaLengthByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+class DeltaByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+void TestDeltaByteArrayRoundTrip(Encoding::type encoding,
+                                 const std::vector<std::string>& values) {
+  std::vector<ByteArray> input;
+  for (const auto& value : values) {
+    input.emplace_back(static_cast<uint32_t>(value.size()),
+                       reinterpret_cast<const uint8_t*>(value.data()));
+  }
+  const int num_values = static_cast<int>(input.size());
+  auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+  auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+  // Encode two pages, the first value of a page has no prefix
+  for (int page = 0; page < 2; ++page) {
+    encoder->Put(input.data(), num_values / 2);
+    encoder->Put(input.data() + num_values / 2, num_values - num_values / 2);
+    std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+
+    decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+    std::vector<ByteArray> decoded(num_values);
+    ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+    ASSERT_EQ(0, decoder->values_left());
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(input[i], decoded[i]) << i;
+    }
+  }
+}
+
+TEST(DeltaByteArrayEncodeDecode, SharedPrefixes) {
+  const std::vector<std::string> values = {
+      "",         "a",          "abc",          "abcdefghijkl", "abcdefghijklmnop",
+      "abcdefgh", "abcdefghij", "abcdefghijxy", "b",            "",
+      "bcd",      "bcd",        "bcdefghijklmnopqrstuvwxyz"};
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_NO_FATAL_FAILURE(TestDeltaByteArrayRoundTrip(encoding, values));
+  }
+}
+
+TEST(DeltaByteArrayEncodeDecode, PutArrow) {
+  auto arr = ::arrow::ArrayFromJSON(::arrow::binary(),
+                                    R"(["parquet", null, "parrot", "part", null, ""])");
+  auto expected = ::arrow::ArrayFromJSON(
+      ::arrow::binary(), R"(["parquet", "parrot", "part", "", "parrot", "part"])");
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+    encoder->Put(*arr);
+    // Without nulls, from a slice
+    encoder->Put(*arr->Slice(2, 2));
+    std::shared_ptr<Buffer> buffer = encoder->FlushValues();
+
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    decoder->SetData(6, buffer->data(), static_cast<int>(buffer->size()));
+    typename EncodingTraits<ByteArrayType>::Accumulator acc;
+    acc.builder.reset(new ::arrow::BinaryBuilder);
+    ASSERT_EQ(6, decoder->DecodeArrowNonNull(6, &acc));
+    std::shared_ptr<::arrow::Array> actual;
+    ASSERT_OK(acc.builder->Finish(&actual));
+    ASSERT_ARRAYS_EQUAL(*expected, *actual);
+  }
+}
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+}
+
 }  // namespace test
 }  // namespace parquet
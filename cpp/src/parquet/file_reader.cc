@@ -20,14 +20,23 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -36,6 +45,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -75,17 +85,140 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+// The bytes of a column chunk in the file
+static ::arrow::io::ReadRange ComputeColumnChunkRange(const FileMetaData& file_metadata,
+                                                     const ColumnChunkMetaData* col,
+                                                     int64_t source_size) {
+  int64_t col_start = col->data_page_offset();
+  if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
+      col_start > col->dictionary_page_offset()) {
+    col_start = col->dictionary_page_offset();
+  }
+
+  int64_t col_length = col->total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata.writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t bytes_remaining = source_size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
+// Read a ColumnIndex or an OffsetIndex, return nullptr if the column chunk
+// has none. Page indexes of encrypted columns are encrypted and not read.
+template <typename Index>
+static std::unique_ptr<Index> ReadPageIndex(ArrowInputFile* source, int64_t source_size,
+                                            const ColumnChunkMetaData& col,
+                                            bool has_index, IndexLocation location) {
+  if (!has_index || col.crypto_metadata() != nullptr) {
+    return nullptr;
+  }
+  if (location.offset < 0 || location.length <= 0 ||
+      location.offset + location.length > source_size) {
+    throw ParquetException("Invalid page index location in column metadata");
+  }
+  PARQUET_ASSIGN_OR_THROW(auto buffer, source->ReadAt(location.offset, location.length));
+  if (buffer->size() != location.length) {
+    throw ParquetException("Failed reading page index");
+  }
+  return Index::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+}
+
+static std::unique_ptr<OffsetIndex> ReadOffsetIndex(ArrowInputFile* source,
+                                                    int64_t source_size,
+                                                    const ColumnChunkMetaData& col) {
+  return ReadPageIndex<OffsetIndex>(source, source_size, col, col.has_offset_index(),
+                                    col.offset_index_location());
+}
+
+// The rows selected by ParquetFileReader::SelectRows() in a row group
+struct RowGroupSelection {
+  RowRanges rows;
+  // By column index
+  std::unordered_map<int, std::shared_ptr<OffsetIndex>> offset_indexes;
+
+  // Whether the pages of the column are to be skipped, which is only the case
+  // the first time it is read. Columns which were not selected may only be read
+  // once all the selected ones were.
+  bool ReadColumn(int i) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (unread_columns.erase(i) > 0) {
+      return true;
+    }
+    if (!unread_columns.empty() && offset_indexes.find(i) == offset_indexes.end()) {
+      std::stringstream ss;
+      ss << "Column " << i << " was not passed to SelectRows()";
+      throw ParquetException(ss.str());
+    }
+    return false;
+  }
+
+  bool consumed() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return unread_columns.empty();
+  }
+
+  std::mutex mutex;
+  std::unordered_set<int> unread_columns;
+};
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
-  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source, int64_t source_size,
-                     FileMetaData* file_metadata, int row_group_number,
-                     const ReaderProperties& props,
+  SerializedRowGroup(std::shared_ptr<ArrowInputFile> source,
+                     std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source,
+                     std::vector<bool> cached_columns,
+                     std::shared_ptr<RowGroupSelection> selection,
+                     int64_t source_size, FileMetaData* file_metadata,
+                     int row_group_number, const ReaderProperties& props,
                      std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
       : source_(std::move(source)),
+        cached_source_(std::move(cached_source)),
+        cached_columns_(std::move(cached_columns)),
+        selection_(std::move(selection)),
         source_size_(source_size),
         file_metadata_(file_metadata),
         properties_(props),
@@ -99,31 +232,30 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   const ReaderProperties* properties() const override { return &properties_; }
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
+    if (selection_ && selection_->ReadColumn(i)) {
+      return GetSelectedPageReader(i);
+    }
+
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t bytes_remaining = source_size_ - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(*file_metadata_, col.get(), source_size_);
+    std::shared_ptr<ArrowInputStream> stream;
+    if (cached_source_ && cached_columns_[i]) {
+      // The column chunk was read ahead of time by ParquetFileReader::PreBuffer()
+      PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
+      if (buffer->size() != col_range.length) {
+        std::stringstream ss;
+        ss << "Tried reading " << col_range.length << " bytes starting at position "
+           << col_range.offset << " from file but only got " << buffer->size();
+        throw ParquetException(ss.str());
+      }
+      stream = std::make_shared<::arrow::io::BufferReader>(buffer);
+    } else {
+      stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
 
-    std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
-
     std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
@@ -160,8 +292,121 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    // The serialized filter starts with its bitset length, followed by the
+    // hash strategy and the algorithm
+    constexpr int64_t kHeaderSize = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset + kHeaderSize > source_size_) {
+      throw ParquetException("Invalid Bloom filter offset in column metadata");
+    }
+    uint32_t num_bytes = 0;
+    PARQUET_ASSIGN_OR_THROW(int64_t bytes_read,
+                            source_->ReadAt(offset, sizeof(uint32_t), &num_bytes));
+    if (bytes_read != static_cast<int64_t>(sizeof(uint32_t)) ||
+        offset + kHeaderSize + num_bytes > source_size_) {
+      throw ParquetException("Invalid Bloom filter length in file");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(offset, kHeaderSize + num_bytes));
+    ::arrow::io::BufferReader stream(std::move(buffer));
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    return ReadPageIndex<ColumnIndex>(source_.get(), source_size_, *col,
+                                      col->has_column_index(),
+                                      col->column_index_location());
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    return ReadOffsetIndex(source_.get(), source_size_, *col);
+  }
+
  private:
+  // Read the dictionary page and the data pages overlapping the selected rows
+  std::unique_ptr<PageReader> GetSelectedPageReader(int i) {
+    auto it = selection_->offset_indexes.find(i);
+    auto col = row_group_metadata_->ColumnChunk(i);
+    const std::vector<PageLocation>& pages = it->second->page_locations();
+    const RowRanges& rows = selection_->rows;
+    const int64_t num_rows = row_group_metadata_->num_rows();
+
+    std::vector<::arrow::io::ReadRange> ranges;
+    int64_t num_selected_rows = 0;
+    auto row_range = rows.begin();
+    for (size_t p = 0; p < pages.size(); ++p) {
+      const int64_t page_start = pages[p].first_row_index;
+      const int64_t page_end =
+          p + 1 < pages.size() ? pages[p + 1].first_row_index : num_rows;
+      while (row_range != rows.end() &&
+             row_range->first_row + row_range->num_rows <= page_start) {
+        ++row_range;
+      }
+      if (row_range != rows.end() && row_range->first_row < page_end) {
+        ranges.push_back({pages[p].offset, pages[p].compressed_page_size});
+        num_selected_rows += page_end - page_start;
+      }
+    }
+
+    std::shared_ptr<Buffer> buffer;
+    if (ranges.empty()) {
+      buffer = std::make_shared<Buffer>(nullptr, 0);
+    } else {
+      // The dictionary page, if any, precedes the first data page
+      ::arrow::io::ReadRange col_range =
+          ComputeColumnChunkRange(*file_metadata_, col.get(), source_size_);
+      if (pages[0].offset > col_range.offset) {
+        ranges.push_back({col_range.offset, pages[0].offset - col_range.offset});
+      }
+      ranges = ::arrow::io::internal::CoalesceReadRanges(
+          std::move(ranges), /*hole_size_limit=*/0,
+          /*range_size_limit=*/std::numeric_limits<int64_t>::max());
+
+      ::arrow::BufferVector buffers;
+      for (const auto& range : ranges) {
+        std::shared_ptr<Buffer> range_buffer;
+        if (cached_source_ && cached_columns_[i]) {
+          PARQUET_ASSIGN_OR_THROW(range_buffer, cached_source_->Read(range));
+        } else {
+          PARQUET_ASSIGN_OR_THROW(range_buffer,
+                                  source_->ReadAt(range.offset, range.length));
+        }
+        if (range_buffer->size() != range.length) {
+          std::stringstream ss;
+          ss << "Tried reading " << range.length << " bytes starting at position "
+             << range.offset << " from file but only got " << range_buffer->size();
+          throw ParquetException(ss.str());
+        }
+        buffers.push_back(std::move(range_buffer));
+      }
+      if (buffers.size() == 1) {
+        buffer = std::move(buffers[0]);
+      } else {
+        PARQUET_THROW_NOT_OK(
+            ::arrow::ConcatenateBuffers(buffers, properties_.memory_pool(), &buffer));
+      }
+    }
+
+    // Non repeated columns have as many values as rows
+    auto stream = std::make_shared<::arrow::io::BufferReader>(std::move(buffer));
+    return PageReader::Open(std::move(stream), num_selected_rows, col->compression(),
+                            properties_.memory_pool());
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
+  // Column chunks read ahead of time, by column index
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  std::vector<bool> cached_columns_;
+  // Pages to read, if restricted by ParquetFileReader::SelectRows()
+  std::shared_ptr<RowGroupSelection> selection_;
   int64_t source_size_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
@@ -196,12 +441,91 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, source_size_, file_metadata_.get(),
-                               static_cast<int16_t>(i), properties_, file_decryptor_));
+    std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source;
+    std::vector<bool> cached_columns;
+    auto it = prebuffered_column_chunks_.find(i);
+    if (it != prebuffered_column_chunks_.end()) {
+      cached_source = cached_source_;
+      cached_columns = it->second;
+    }
+    std::shared_ptr<RowGroupSelection> selection;
+    {
+      std::lock_guard<std::mutex> lock(selection_mutex_);
+      auto selection_it = row_group_selections_.find(i);
+      if (selection_it != row_group_selections_.end()) {
+        if (selection_it->second->consumed()) {
+          row_group_selections_.erase(selection_it);
+        } else {
+          selection = selection_it->second;
+        }
+      }
+    }
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, std::move(cached_source), std::move(cached_columns),
+        std::move(selection), source_size_, file_metadata_.get(),
+        static_cast<int16_t>(i), properties_, file_decryptor_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options) override {
+    cached_source_ =
+        std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, options);
+    prebuffered_column_chunks_.clear();
+
+    const int num_columns = file_metadata_->num_columns();
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row_group : row_groups) {
+      auto row_group_metadata = file_metadata_->RowGroup(row_group);
+      std::vector<bool>& cached_columns = prebuffered_column_chunks_[row_group];
+      cached_columns.resize(num_columns, false);
+      for (int col : column_indices) {
+        auto col_metadata = row_group_metadata->ColumnChunk(col);
+        ranges.push_back(
+            ComputeColumnChunkRange(*file_metadata_, col_metadata.get(), source_size_));
+        cached_columns[col] = true;
+      }
+    }
+    PARQUET_THROW_NOT_OK(cached_source_->Cache(std::move(ranges)));
+  }
+
+  RowRanges SelectRows(int row_group, const RowRanges& rows,
+                       const std::vector<int>& column_indices) override {
+    {
+      std::lock_guard<std::mutex> lock(selection_mutex_);
+      row_group_selections_.erase(row_group);
+    }
+    auto row_group_metadata = file_metadata_->RowGroup(row_group);
+    const int64_t num_rows = row_group_metadata->num_rows();
+    RowRanges all_rows;
+    if (num_rows > 0) {
+      all_rows.push_back({0, num_rows});
+    }
+
+    auto selection = std::make_shared<RowGroupSelection>();
+    std::vector<const OffsetIndex*> offset_indexes;
+    for (int col : column_indices) {
+      // Pages of repeated columns do not necessarily start at row boundaries
+      if (file_metadata_->schema()->Column(col)->max_repetition_level() > 0) {
+        return all_rows;
+      }
+      auto col_metadata = row_group_metadata->ColumnChunk(col);
+      std::shared_ptr<OffsetIndex> offset_index =
+          ReadOffsetIndex(source_.get(), source_size_, *col_metadata);
+      if (offset_index == nullptr) {
+        return all_rows;
+      }
+      offset_indexes.push_back(offset_index.get());
+      selection->offset_indexes[col] = std::move(offset_index);
+      selection->unread_columns.insert(col);
+    }
+    selection->rows = AlignRowRanges(rows, offset_indexes, num_rows);
+    std::lock_guard<std::mutex> lock(selection_mutex_);
+    row_group_selections_[row_group] = selection;
+    return selection->rows;
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(std::shared_ptr<FileMetaData> metadata) {
@@ -259,6 +583,13 @@ class SerializedFile : public ParquetFileReader::Contents {
 
  private:
   std::shared_ptr<ArrowInputFile> source_;
+  // Column chunks read ahead of time, by row group index
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
+  std::unordered_map<int, std::vector<bool>> prebuffered_column_chunks_;
+  // Rows selected by SelectRows(), by row group index, until all the selected
+  // columns were read. Row groups may be scanned concurrently.
+  std::mutex selection_mutex_;
+  std::unordered_map<int, std::shared_ptr<RowGroupSelection>> row_group_selections_;
   int64_t source_size_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
@@ -524,6 +855,30 @@ std::shared_ptr<FileMetaData> ParquetFileReader::metadata() const {
   return contents_->metadata();
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices,
+                                  const ::arrow::io::CacheOptions& options) {
+  contents_->PreBuffer(row_groups, column_indices, options);
+}
+
+RowRanges ParquetFileReader::Contents::SelectRows(
+    int row_group, const RowRanges& rows, const std::vector<int>& column_indices) {
+  // Without page skipping, all the rows are read
+  const int64_t num_rows = metadata()->RowGroup(row_group)->num_rows();
+  if (num_rows == 0) {
+    return {};
+  }
+  return {{0, num_rows}};
+}
+
+RowRanges ParquetFileReader::SelectRows(int row_group, const RowRanges& rows,
+                                        const std::vector<int>& column_indices) {
+  DCHECK(row_group < metadata()->num_row_groups())
+      << "The file only has " << metadata()->num_row_groups()
+      << "row groups, requested selection for: " << row_group;
+  return contents_->SelectRows(row_group, rows, column_indices);
+}
+
 std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   DCHECK(i < metadata()->num_row_groups())
       << "The file only has " << metadata()->num_row_groups()
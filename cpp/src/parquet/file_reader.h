@@ -24,11 +24,13 @@
 #include <vector>
 
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnReader;
 class FileMetaData;
 class PageReader;
@@ -45,6 +47,9 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +63,23 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  /// \brief Read the Bloom filter of a column chunk
+  ///
+  /// Return nullptr if the column chunk has no Bloom filter, see
+  /// WriterProperties::Builder::enable_bloom_filter().
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  /// \brief Read the per page statistics of a column chunk
+  ///
+  /// Return nullptr if the column chunk has no page index, see
+  /// WriterProperties::Builder::enable_write_page_index().
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  /// \brief Read the page locations of a column chunk
+  ///
+  /// Return nullptr if the column chunk has no page index.
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -79,6 +101,13 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    // Start reading column chunks ahead of time. Implementations which do
+    // not support it may ignore the hint.
+    virtual void PreBuffer(const std::vector<int>& /*row_groups*/,
+                           const std::vector<int>& /*column_indices*/,
+                           const ::arrow::io::CacheOptions& /*options*/) {}
+    virtual RowRanges SelectRows(int row_group, const RowRanges& rows,
+                                 const std::vector<int>& column_indices);
   };
 
   ParquetFileReader();
@@ -118,6 +147,42 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// \brief Read the given column chunks ahead of time
+  ///
+  /// The byte ranges of the given columns of the given row groups are
+  /// coalesced according to options and read concurrently on the I/O
+  /// thread pool. Column readers subsequently created for these column
+  /// chunks are served from memory. A later call replaces the column chunks
+  /// buffered by a previous one.
+  ///
+  /// \param[in] row_groups indices of the row groups to buffer
+  /// \param[in] column_indices indices of the leaf columns to buffer
+  /// \param[in] options how to coalesce the reads
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices,
+                 const ::arrow::io::CacheOptions& options);
+
+  /// \brief Only read the data pages of a row group overlapping the given rows
+  ///
+  /// Column readers subsequently created for the given columns of the row
+  /// group skip the other data pages, using the OffsetIndex of the column
+  /// chunks. Pages of different columns start at different rows, so the
+  /// rows are extended to page boundaries of all the given columns; only
+  /// these columns may then be read from the row group. If one of them is
+  /// repeated or has no OffsetIndex, the whole row group is read.
+  ///
+  /// The selection only applies to the first column reader created for each
+  /// of the given columns. Once all of them were created, it is dropped and
+  /// later reads of the row group return all its rows again. A later call for
+  /// the same row group replaces it.
+  ///
+  /// \param[in] row_group index of the row group
+  /// \param[in] rows the rows to read
+  /// \param[in] column_indices indices of the leaf columns to read
+  /// \return the rows which will actually be read
+  RowRanges SelectRows(int row_group, const RowRanges& rows,
+                       const std::vector<int>& column_indices);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -28,6 +28,7 @@
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -83,7 +84,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   RowGroupSerializer(std::shared_ptr<ArrowOutputStream> sink,
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
-                     InternalFileEncryptor* file_encryptor = nullptr)
+                     InternalFileEncryptor* file_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -93,7 +95,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         next_column_index_(0),
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
-        file_encryptor_(file_encryptor) {
+        file_encryptor_(file_encryptor),
+        page_index_builder_(page_index_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -135,10 +138,12 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto data_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                         : nullptr;
+    const int column_index = next_column_index_ - 1;
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
-        col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
+        col_meta, row_group_ordinal_, static_cast<int16_t>(column_index),
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        GetColumnIndexBuilder(column_index), GetOffsetIndexBuilder(column_index));
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
     return column_writers_[0].get();
   }
@@ -208,6 +213,15 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   mutable int64_t num_rows_;
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
+  PageIndexBuilder* page_index_builder_;
+
+  ColumnIndexBuilder* GetColumnIndexBuilder(int i) const {
+    return page_index_builder_ ? page_index_builder_->GetColumnIndexBuilder(i) : nullptr;
+  }
+
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int i) const {
+    return page_index_builder_ ? page_index_builder_->GetOffsetIndexBuilder(i) : nullptr;
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -245,7 +259,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
           static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          buffered_row_group_, meta_encryptor, data_encryptor, GetColumnIndexBuilder(i),
+          GetOffsetIndexBuilder(i));
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
     }
@@ -284,6 +299,13 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      if (page_index_builder_) {
+        // Page indexes are written between the last row group and the footer
+        PageIndexLocation location;
+        page_index_builder_->WriteTo(sink_.get(), &location);
+        metadata_->SetPageIndexLocation(location);
+      }
+
       // Write magic bytes and metadata
       auto file_encryption_properties = properties_->file_encryption_properties();
 
@@ -312,9 +334,12 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      page_index_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, static_cast<int16_t>(num_row_groups_ - 1), properties_.get(),
-        buffered_row_group, file_encryptor_.get()));
+        buffered_row_group, file_encryptor_.get(), page_index_builder_.get()));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -388,12 +413,17 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<RowGroupWriter> row_group_writer_;
 
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
 
   void StartFile() {
     auto file_encryption_properties = properties_->file_encryption_properties();
     if (file_encryption_properties == nullptr) {
       // Unencrypted parquet files always start with PAR1
       PARQUET_THROW_NOT_OK(sink_->Write(kParquetMagic, 4));
+      // Page indexes of encrypted files would have to be encrypted too
+      if (properties_->write_page_index()) {
+        page_index_builder_.reset(new PageIndexBuilder(&schema_));
+      }
     } else {
       // Check that all columns in columnEncryptionProperties exist in the schema.
       auto encrypted_columns = file_encryption_properties->encrypted_columns();
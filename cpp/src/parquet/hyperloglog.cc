@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/hyperloglog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "parquet/exception.h"
+
+namespace parquet {
+
+HyperLogLog::HyperLogLog(int precision) : precision_(precision) {
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    std::stringstream ss;
+    ss << "HyperLogLog precision must be between " << kMinPrecision << " and "
+       << kMaxPrecision << ", got " << precision;
+    throw ParquetException(ss.str());
+  }
+  registers_.resize(static_cast<size_t>(1) << precision_, 0);
+}
+
+int64_t HyperLogLog::Estimate() const {
+  const double m = static_cast<double>(registers_.size());
+  double sum = 0;
+  int64_t num_zeros = 0;
+  for (uint8_t rank : registers_) {
+    sum += std::ldexp(1.0, -rank);
+    num_zeros += rank == 0;
+  }
+
+  double alpha;
+  switch (registers_.size()) {
+    case 16:
+      alpha = 0.673;
+      break;
+    case 32:
+      alpha = 0.697;
+      break;
+    case 64:
+      alpha = 0.709;
+      break;
+    default:
+      alpha = 0.7213 / (1 + 1.079 / m);
+      break;
+  }
+  double estimate = alpha * m * m / sum;
+
+  // The raw estimate is biased for small cardinalities, for which counting
+  // the empty registers is more accurate. No correction is needed for large
+  // cardinalities since the hashes have 64 bits.
+  if (estimate <= 2.5 * m && num_zeros > 0) {
+    estimate = m * std::log(m / static_cast<double>(num_zeros));
+  }
+  return static_cast<int64_t>(std::llround(estimate));
+}
+
+void HyperLogLog::Reset() { std::fill(registers_.begin(), registers_.end(), 0); }
+
+}  // namespace parquet
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "parquet/platform.h"
+
+namespace parquet {
+
+/// \brief A HyperLogLog sketch, estimating the number of distinct values
+/// inserted into it from their 64-bit hashes
+///
+/// See Flajolet et al., "HyperLogLog: the analysis of a near-optimal
+/// cardinality estimation algorithm". Small cardinalities are estimated by
+/// linear counting instead, as in Heule et al., "HyperLogLog in Practice".
+/// The relative standard error of the estimate is about
+/// 1.04 / sqrt(2^precision).
+class PARQUET_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 16;
+  static constexpr int kDefaultPrecision = 12;
+
+  /// \param[in] precision the log2 of the number of registers of the sketch,
+  /// between kMinPrecision and kMaxPrecision
+  explicit HyperLogLog(int precision = kDefaultPrecision);
+
+  /// \brief Add the hash of a value
+  void InsertHash(uint64_t hash) {
+    // The leading bits select a register, which keeps the largest position
+    // of the first set bit among the remaining bits. The sentinel bit bounds
+    // that position.
+    const uint64_t index = hash >> (64 - precision_);
+    const uint64_t rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+    const auto rank =
+        static_cast<uint8_t>(::arrow::BitUtil::CountLeadingZeros(rest) + 1);
+    if (rank > registers_[index]) {
+      registers_[index] = rank;
+    }
+  }
+
+  /// \brief Estimate the number of distinct hashes inserted so far
+  int64_t Estimate() const;
+
+  /// \brief Forget all the hashes inserted so far
+  void Reset();
+
+  int precision() const { return precision_; }
+
+ private:
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace parquet
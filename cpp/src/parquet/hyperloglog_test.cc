@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "parquet/exception.h"
+#include "parquet/hyperloglog.h"
+#include "parquet/murmur3.h"
+
+namespace parquet {
+namespace test {
+
+// Insert the values [begin, end) num_repeats times
+void InsertRange(const MurmurHash3& hasher, int64_t begin, int64_t end,
+                 HyperLogLog* sketch, int num_repeats = 1) {
+  for (int repeat = 0; repeat < num_repeats; ++repeat) {
+    for (int64_t value = begin; value < end; ++value) {
+      sketch->InsertHash(hasher.Hash(value));
+    }
+  }
+}
+
+void AssertEstimateNear(int64_t expected, const HyperLogLog& sketch,
+                        double relative_error) {
+  const int64_t estimate = sketch.Estimate();
+  ASSERT_LE(std::llabs(estimate - expected), expected * relative_error)
+      << "estimated " << estimate << " distinct values instead of " << expected;
+}
+
+TEST(TestHyperLogLog, Empty) {
+  HyperLogLog sketch;
+  ASSERT_EQ(0, sketch.Estimate());
+}
+
+TEST(TestHyperLogLog, SmallCardinalities) {
+  MurmurHash3 hasher;
+  HyperLogLog sketch;
+  InsertRange(hasher, 0, 1, &sketch);
+  ASSERT_EQ(1, sketch.Estimate());
+
+  sketch.Reset();
+  ASSERT_EQ(0, sketch.Estimate());
+  // Duplicates do not change the estimate
+  InsertRange(hasher, 0, 100, &sketch, /*num_repeats=*/10);
+  AssertEstimateNear(100, sketch, 0.02);
+}
+
+TEST(TestHyperLogLog, LargeCardinalities) {
+  MurmurHash3 hasher;
+  // The relative standard error is 1.04 / sqrt(4096), about 1.6%
+  HyperLogLog sketch;
+  InsertRange(hasher, 0, 20000, &sketch);
+  AssertEstimateNear(20000, sketch, 0.05);
+  InsertRange(hasher, 0, 500000, &sketch);
+  AssertEstimateNear(500000, sketch, 0.05);
+
+  // About 6.5% with 256 registers
+  HyperLogLog small_sketch(8);
+  ASSERT_EQ(8, small_sketch.precision());
+  InsertRange(hasher, 0, 100000, &small_sketch, /*num_repeats=*/2);
+  AssertEstimateNear(100000, small_sketch, 0.2);
+}
+
+TEST(TestHyperLogLog, InvalidPrecision) {
+  ASSERT_THROW(HyperLogLog(HyperLogLog::kMinPrecision - 1), ParquetException);
+  ASSERT_THROW(HyperLogLog(HyperLogLog::kMaxPrecision + 1), ParquetException);
+  ASSERT_NO_THROW(HyperLogLog(HyperLogLog::kMinPrecision));
+  ASSERT_NO_THROW(HyperLogLog(HyperLogLog::kMaxPrecision));
+}
+
+}  // namespace test
+}  // namespace parquet
@@ -29,6 +29,7 @@
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_decryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/schema.h"
 #include "parquet/schema_internal.h"
 #include "parquet/statistics.h"
@@ -273,6 +274,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
   inline int64_t index_page_offset() const { return column_metadata_->index_page_offset; }
 
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline IndexLocation column_index_location() const {
+    return {column_->column_index_offset, column_->column_index_length};
+  }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline IndexLocation offset_index_location() const {
+    return {column_->offset_index_offset, column_->offset_index_length};
+  }
+
   inline int64_t total_compressed_size() const {
     return column_metadata_->total_compressed_size;
   }
@@ -371,6 +392,24 @@ int64_t ColumnChunkMetaData::total_uncompressed_size() const {
   return impl_->total_uncompressed_size();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+IndexLocation ColumnChunkMetaData::column_index_location() const {
+  return impl_->column_index_location();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+IndexLocation ColumnChunkMetaData::offset_index_location() const {
+  return impl_->offset_index_location();
+}
+
 int64_t ColumnChunkMetaData::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -963,6 +1002,10 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void SetBloomFilterOffset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -1141,6 +1184,10 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::SetBloomFilterOffset(int64_t offset) {
+  impl_->SetBloomFilterOffset(offset);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -1275,6 +1322,31 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void SetPageIndexLocation(const PageIndexLocation& location) {
+    auto set_locations =
+        [this](const std::vector<std::vector<IndexLocation>>& locations,
+               bool column_index) {
+          for (size_t i = 0; i < locations.size() && i < row_groups_.size(); ++i) {
+            auto& columns = row_groups_[i].columns;
+            for (size_t j = 0; j < locations[i].size() && j < columns.size(); ++j) {
+              const IndexLocation& index_location = locations[i][j];
+              if (index_location.length == 0) {
+                continue;
+              }
+              if (column_index) {
+                columns[j].__set_column_index_offset(index_location.offset);
+                columns[j].__set_column_index_length(index_location.length);
+              } else {
+                columns[j].__set_offset_index_offset(index_location.offset);
+                columns[j].__set_offset_index_length(index_location.length);
+              }
+            }
+          }
+        };
+    set_locations(location.column_index_locations, /*column_index=*/true);
+    set_locations(location.offset_index_locations, /*column_index=*/false);
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -1402,6 +1474,10 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location) {
+  impl_->SetPageIndexLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 std::unique_ptr<FileCryptoMetaData> FileMetaDataBuilder::GetCryptoMetaData() {
@@ -39,6 +39,7 @@ class SchemaDescriptor;
 
 class FileCryptoMetaData;
 class InternalFileDecryptor;
+struct PageIndexLocation;
 class Decryptor;
 class Encryptor;
 class FooterSigningEncryptor;
@@ -104,6 +105,12 @@ class PARQUET_EXPORT ApplicationVersion {
                             SortOrder::type sort_order = SortOrder::SIGNED) const;
 };
 
+/// \brief Position of a ColumnIndex or OffsetIndex in the file
+struct PARQUET_EXPORT IndexLocation {
+  int64_t offset;
+  int32_t length;
+};
+
 class PARQUET_EXPORT ColumnCryptoMetaData {
  public:
   static std::unique_ptr<ColumnCryptoMetaData> Make(const uint8_t* metadata);
@@ -158,6 +165,12 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t index_page_offset() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  bool has_column_index() const;
+  IndexLocation column_index_location() const;
+  bool has_offset_index() const;
+  IndexLocation offset_index_location() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
  private:
@@ -311,6 +324,8 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // Bloom filter written at the given position of the file
+  void SetBloomFilterOffset(int64_t offset);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
@@ -378,6 +393,9 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Record where the page index of each column chunk was written
+  void SetPageIndexLocation(const PageIndexLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
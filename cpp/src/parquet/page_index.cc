@@ -0,0 +1,369 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+namespace {
+
+class ColumnIndexImpl : public ColumnIndex {
+ public:
+  explicit ColumnIndexImpl(const format::ColumnIndex& column_index)
+      : column_index_(column_index) {
+    const size_t num_pages = column_index_.null_pages.size();
+    if (column_index_.min_values.size() != num_pages ||
+        column_index_.max_values.size() != num_pages ||
+        (column_index_.__isset.null_counts &&
+         column_index_.null_counts.size() != num_pages)) {
+      throw ParquetException("Invalid column index: inconsistent number of pages");
+    }
+  }
+
+  const std::vector<bool>& null_pages() const override {
+    return column_index_.null_pages;
+  }
+
+  const std::vector<std::string>& encoded_min_values() const override {
+    return column_index_.min_values;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const override {
+    return column_index_.max_values;
+  }
+
+  BoundaryOrder::type boundary_order() const override {
+    return static_cast<BoundaryOrder::type>(column_index_.boundary_order);
+  }
+
+  bool has_null_counts() const override { return column_index_.__isset.null_counts; }
+
+  const std::vector<int64_t>& null_counts() const override {
+    return column_index_.null_counts;
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+};
+
+class OffsetIndexImpl : public OffsetIndex {
+ public:
+  explicit OffsetIndexImpl(const format::OffsetIndex& offset_index) {
+    page_locations_.reserve(offset_index.page_locations.size());
+    for (const auto& location : offset_index.page_locations) {
+      if (!page_locations_.empty() &&
+          location.first_row_index <= page_locations_.back().first_row_index) {
+        throw ParquetException("Invalid offset index: unordered page locations");
+      }
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+class ColumnIndexBuilderImpl : public ColumnIndexBuilder {
+ public:
+  ColumnIndexBuilderImpl() : valid_(true) {
+    // Establishing the boundary order would require decoding the values
+    column_index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    column_index_.__isset.null_counts = true;
+  }
+
+  void AddPage(const EncodedStatistics& stats, int64_t num_values) override {
+    if (!valid_) {
+      return;
+    }
+    const bool null_page = stats.has_null_count && stats.null_count == num_values;
+    if (!null_page && !(stats.has_min && stats.has_max)) {
+      valid_ = false;
+      return;
+    }
+    column_index_.null_pages.push_back(null_page);
+    column_index_.min_values.push_back(null_page ? "" : stats.min());
+    column_index_.max_values.push_back(null_page ? "" : stats.max());
+    if (stats.has_null_count) {
+      column_index_.null_counts.push_back(stats.null_count);
+    } else {
+      column_index_.__isset.null_counts = false;
+    }
+  }
+
+  bool valid() const override { return valid_; }
+
+  void WriteTo(ArrowOutputStream* sink) const override {
+    DCHECK(valid_);
+    // null_counts is only serialized if set for all pages
+    ThriftSerializer serializer;
+    serializer.Serialize(&column_index_, sink);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+  bool valid_;
+};
+
+class OffsetIndexBuilderImpl : public OffsetIndexBuilder {
+ public:
+  void AddPage(int64_t offset, int32_t compressed_page_size,
+               int64_t first_row_index) override {
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(first_row_index);
+    offset_index_.page_locations.push_back(location);
+  }
+
+  void Finish(int64_t final_position) override {
+    for (auto& location : offset_index_.page_locations) {
+      location.__set_offset(location.offset + final_position);
+    }
+  }
+
+  void WriteTo(ArrowOutputStream* sink) const override {
+    ThriftSerializer serializer;
+    serializer.Serialize(&offset_index_, sink);
+  }
+
+ private:
+  format::OffsetIndex offset_index_;
+};
+
+}  // namespace
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  return std::unique_ptr<ColumnIndex>(new ColumnIndexImpl(column_index));
+}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  return std::unique_ptr<OffsetIndex>(new OffsetIndexImpl(offset_index));
+}
+
+std::unique_ptr<ColumnIndexBuilder> ColumnIndexBuilder::Make() {
+  return std::unique_ptr<ColumnIndexBuilder>(new ColumnIndexBuilderImpl());
+}
+
+std::unique_ptr<OffsetIndexBuilder> OffsetIndexBuilder::Make() {
+  return std::unique_ptr<OffsetIndexBuilder>(new OffsetIndexBuilderImpl());
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+PageIndexBuilder::PageIndexBuilder(const SchemaDescriptor* schema) : schema_(schema) {}
+
+PageIndexBuilder::~PageIndexBuilder() = default;
+
+void PageIndexBuilder::AppendRowGroup() {
+  const int num_columns = schema_->num_columns();
+  std::vector<std::unique_ptr<ColumnIndexBuilder>> column_index_builders(num_columns);
+  std::vector<std::unique_ptr<OffsetIndexBuilder>> offset_index_builders(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    // Pages of repeated columns may start in the middle of a row
+    if (schema_->Column(i)->max_repetition_level() == 0) {
+      column_index_builders[i] = ColumnIndexBuilder::Make();
+      offset_index_builders[i] = OffsetIndexBuilder::Make();
+    }
+  }
+  column_index_builders_.push_back(std::move(column_index_builders));
+  offset_index_builders_.push_back(std::move(offset_index_builders));
+}
+
+ColumnIndexBuilder* PageIndexBuilder::GetColumnIndexBuilder(int i) {
+  DCHECK(!column_index_builders_.empty());
+  return column_index_builders_.back()[i].get();
+}
+
+OffsetIndexBuilder* PageIndexBuilder::GetOffsetIndexBuilder(int i) {
+  DCHECK(!offset_index_builders_.empty());
+  return offset_index_builders_.back()[i].get();
+}
+
+namespace {
+
+bool IsWritable(const ColumnIndexBuilder& builder) { return builder.valid(); }
+
+bool IsWritable(const OffsetIndexBuilder&) { return true; }
+
+template <typename Builder>
+void WriteIndexes(const std::vector<std::vector<std::unique_ptr<Builder>>>& builders,
+                  ArrowOutputStream* sink,
+                  std::vector<std::vector<IndexLocation>>* locations) {
+  locations->clear();
+  for (const auto& row_group_builders : builders) {
+    std::vector<IndexLocation> row_group_locations(row_group_builders.size(),
+                                                   IndexLocation{-1, 0});
+    for (size_t i = 0; i < row_group_builders.size(); ++i) {
+      const auto& builder = row_group_builders[i];
+      if (builder == nullptr || !IsWritable(*builder)) {
+        continue;
+      }
+      PARQUET_ASSIGN_OR_THROW(int64_t start, sink->Tell());
+      builder->WriteTo(sink);
+      PARQUET_ASSIGN_OR_THROW(int64_t end, sink->Tell());
+      row_group_locations[i] = {start, static_cast<int32_t>(end - start)};
+    }
+    locations->push_back(std::move(row_group_locations));
+  }
+}
+
+}  // namespace
+
+void PageIndexBuilder::WriteTo(ArrowOutputStream* sink,
+                               PageIndexLocation* location) const {
+  WriteIndexes(column_index_builders_, sink, &location->column_index_locations);
+  WriteIndexes(offset_index_builders_, sink, &location->offset_index_locations);
+}
+
+// ----------------------------------------------------------------------
+// Row ranges
+
+RowRanges PageRowRanges(const OffsetIndex& offset_index,
+                        const std::vector<bool>& selected_pages, int64_t num_rows) {
+  const auto& pages = offset_index.page_locations();
+  DCHECK_EQ(pages.size(), selected_pages.size());
+  RowRanges ranges;
+  for (size_t i = 0; i < pages.size(); ++i) {
+    if (!selected_pages[i]) {
+      continue;
+    }
+    const int64_t first_row = pages[i].first_row_index;
+    const int64_t end_row =
+        i + 1 < pages.size() ? pages[i + 1].first_row_index : num_rows;
+    if (!ranges.empty() &&
+        ranges.back().first_row + ranges.back().num_rows == first_row) {
+      ranges.back().num_rows += end_row - first_row;
+    } else {
+      ranges.push_back({first_row, end_row - first_row});
+    }
+  }
+  return ranges;
+}
+
+RowRanges IntersectRowRanges(const RowRanges& a, const RowRanges& b) {
+  RowRanges ranges;
+  auto it_a = a.begin();
+  auto it_b = b.begin();
+  while (it_a != a.end() && it_b != b.end()) {
+    const int64_t first_row = std::max(it_a->first_row, it_b->first_row);
+    const int64_t end_a = it_a->first_row + it_a->num_rows;
+    const int64_t end_b = it_b->first_row + it_b->num_rows;
+    const int64_t end_row = std::min(end_a, end_b);
+    if (first_row < end_row) {
+      ranges.push_back({first_row, end_row - first_row});
+    }
+    if (end_a < end_b) {
+      ++it_a;
+    } else {
+      ++it_b;
+    }
+  }
+  return ranges;
+}
+
+namespace {
+
+// Sort and merge overlapping or adjacent ranges, dropping empty ones
+RowRanges NormalizeRowRanges(RowRanges rows) {
+  rows.erase(std::remove_if(rows.begin(), rows.end(),
+                            [](const RowRange& range) { return range.num_rows <= 0; }),
+             rows.end());
+  std::sort(rows.begin(), rows.end(), [](const RowRange& a, const RowRange& b) {
+    return a.first_row < b.first_row;
+  });
+  RowRanges normalized;
+  for (const auto& range : rows) {
+    if (!normalized.empty()) {
+      RowRange& last = normalized.back();
+      const int64_t last_end = last.first_row + last.num_rows;
+      if (range.first_row <= last_end) {
+        last.num_rows = std::max(last_end, range.first_row + range.num_rows) -
+                        last.first_row;
+        continue;
+      }
+    }
+    normalized.push_back(range);
+  }
+  return normalized;
+}
+
+}  // namespace
+
+RowRanges AlignRowRanges(RowRanges rows,
+                         const std::vector<const OffsetIndex*>& offset_indexes,
+                         int64_t num_rows) {
+  rows = NormalizeRowRanges(std::move(rows));
+  // Extending a range to the pages of a column may make it overlap other
+  // pages of a previous column, so iterate until no range changes.
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (const OffsetIndex* offset_index : offset_indexes) {
+      const auto& pages = offset_index->page_locations();
+      if (pages.empty()) {
+        continue;
+      }
+      auto page_starting_after = [&pages](int64_t row) {
+        return std::upper_bound(pages.begin(), pages.end(), row,
+                                [](int64_t value, const PageLocation& page) {
+                                  return value < page.first_row_index;
+                                });
+      };
+      for (auto& range : rows) {
+        // The page containing the first row starts at or before it
+        auto first_page = page_starting_after(range.first_row);
+        const int64_t first_row =
+            first_page == pages.begin() ? 0 : std::prev(first_page)->first_row_index;
+        // The page after the one containing the last row
+        auto end_page = page_starting_after(range.first_row + range.num_rows - 1);
+        const int64_t end_row =
+            end_page == pages.end() ? num_rows : end_page->first_row_index;
+        if (first_row != range.first_row || end_row != range.first_row + range.num_rows) {
+          range = {first_row, end_row - first_row};
+          changed = true;
+        }
+      }
+      rows = NormalizeRowRanges(std::move(rows));
+    }
+  }
+  return rows;
+}
+
+}  // namespace parquet
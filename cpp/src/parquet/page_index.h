@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/metadata.h"
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class EncodedStatistics;
+class SchemaDescriptor;
+
+// ----------------------------------------------------------------------
+// Page index: per data page statistics (ColumnIndex) and locations
+// (OffsetIndex) of a column chunk, stored near the footer so that readers
+// can skip pages without reading their headers.
+
+struct PARQUET_EXPORT BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief Location of a data page in the file
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, header included
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within the row group
+  int64_t first_row_index;
+};
+
+/// \brief The statistics of each data page of a column chunk
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex, throw on error
+  static std::unique_ptr<ColumnIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~ColumnIndex() = default;
+
+  /// Whether each page only contains nulls, in which case its min and max
+  /// values are empty
+  virtual const std::vector<bool>& null_pages() const = 0;
+
+  /// The plain encoded minimum value of each page, as in Statistics
+  virtual const std::vector<std::string>& encoded_min_values() const = 0;
+
+  /// The plain encoded maximum value of each page, as in Statistics
+  virtual const std::vector<std::string>& encoded_max_values() const = 0;
+
+  virtual BoundaryOrder::type boundary_order() const = 0;
+
+  virtual bool has_null_counts() const = 0;
+
+  /// The number of nulls of each page, if has_null_counts()
+  virtual const std::vector<int64_t>& null_counts() const = 0;
+};
+
+/// \brief The location of each data page of a column chunk
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex, throw on error
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~OffsetIndex() = default;
+
+  /// Ordered by offset and first row index
+  virtual const std::vector<PageLocation>& page_locations() const = 0;
+};
+
+/// \brief Build the ColumnIndex of a column chunk as its pages are written
+class PARQUET_EXPORT ColumnIndexBuilder {
+ public:
+  static std::unique_ptr<ColumnIndexBuilder> Make();
+
+  virtual ~ColumnIndexBuilder() = default;
+
+  /// \brief Add the statistics of the next data page
+  ///
+  /// If a page which is not only nulls has no min and max values, no
+  /// ColumnIndex is written for the column chunk.
+  virtual void AddPage(const EncodedStatistics& stats, int64_t num_values) = 0;
+
+  /// \brief Whether a ColumnIndex can be written for the pages added so far
+  virtual bool valid() const = 0;
+
+  /// \brief Serialize the ColumnIndex
+  virtual void WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Build the OffsetIndex of a column chunk as its pages are written
+class PARQUET_EXPORT OffsetIndexBuilder {
+ public:
+  static std::unique_ptr<OffsetIndexBuilder> Make();
+
+  virtual ~OffsetIndexBuilder() = default;
+
+  /// \brief Add the location of the next data page
+  virtual void AddPage(int64_t offset, int32_t compressed_page_size,
+                       int64_t first_row_index) = 0;
+
+  /// \brief Complete the page locations once the column chunk is written
+  ///
+  /// \param[in] final_position the position at which the pages written to a
+  /// temporary buffer were copied to the file, 0 if they were written to it
+  /// directly
+  virtual void Finish(int64_t final_position) = 0;
+
+  /// \brief Serialize the OffsetIndex
+  virtual void WriteTo(ArrowOutputStream* sink) const = 0;
+};
+
+/// \brief Where the page index of each column chunk was written, by row
+/// group then column. A length of 0 means the index was not written.
+struct PARQUET_EXPORT PageIndexLocation {
+  std::vector<std::vector<IndexLocation>> column_index_locations;
+  std::vector<std::vector<IndexLocation>> offset_index_locations;
+};
+
+/// \brief Collect the page indexes of the column chunks of a file
+///
+/// Page indexes are only written for columns which are not repeated, since
+/// their pages start at row boundaries.
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  explicit PageIndexBuilder(const SchemaDescriptor* schema);
+  ~PageIndexBuilder();
+
+  /// \brief Start collecting the page indexes of a new row group
+  void AppendRowGroup();
+
+  /// \brief The ColumnIndex builder of column i in the current row group,
+  /// or nullptr if no page index is written for the column
+  ColumnIndexBuilder* GetColumnIndexBuilder(int i);
+
+  /// \brief The OffsetIndex builder of column i in the current row group,
+  /// or nullptr if no page index is written for the column
+  OffsetIndexBuilder* GetOffsetIndexBuilder(int i);
+
+  /// \brief Serialize all the page indexes, column indexes first
+  void WriteTo(ArrowOutputStream* sink, PageIndexLocation* location) const;
+
+ private:
+  const SchemaDescriptor* schema_;
+  std::vector<std::vector<std::unique_ptr<ColumnIndexBuilder>>> column_index_builders_;
+  std::vector<std::vector<std::unique_ptr<OffsetIndexBuilder>>> offset_index_builders_;
+};
+
+// ----------------------------------------------------------------------
+// Row ranges, to select the pages to read from a row group
+
+/// \brief A range of rows of a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t first_row;
+  int64_t num_rows;
+
+  bool operator==(const RowRange& other) const {
+    return first_row == other.first_row && num_rows == other.num_rows;
+  }
+  bool operator!=(const RowRange& other) const { return !(*this == other); }
+};
+
+/// Sorted, non-empty, non-overlapping and non-adjacent ranges
+using RowRanges = std::vector<RowRange>;
+
+/// \brief The rows of the pages for which selected_pages is true
+///
+/// \param[in] offset_index the page locations of a column chunk
+/// \param[in] selected_pages whether to select each page
+/// \param[in] num_rows the number of rows of the row group
+PARQUET_EXPORT
+RowRanges PageRowRanges(const OffsetIndex& offset_index,
+                        const std::vector<bool>& selected_pages, int64_t num_rows);
+
+/// \brief The rows which are in both a and b
+PARQUET_EXPORT
+RowRanges IntersectRowRanges(const RowRanges& a, const RowRanges& b);
+
+/// \brief Extend ranges of rows so that they start and end at page boundaries
+/// of every given column chunk
+///
+/// The pages of each column chunk overlapping the result then span exactly
+/// the same rows.
+PARQUET_EXPORT
+RowRanges AlignRowRanges(RowRanges rows,
+                         const std::vector<const OffsetIndex*>& offset_indexes,
+                         int64_t num_rows);
+
+}  // namespace parquet
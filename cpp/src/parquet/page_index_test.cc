@@ -0,0 +1,286 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/platform.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::NodePtr;
+using schema::PrimitiveNode;
+
+// An OffsetIndex with pages starting at the given rows
+std::unique_ptr<OffsetIndex> MakeOffsetIndex(const std::vector<int64_t>& first_rows) {
+  auto builder = OffsetIndexBuilder::Make();
+  for (size_t i = 0; i < first_rows.size(); ++i) {
+    builder->AddPage(/*offset=*/100 * i, /*compressed_page_size=*/100, first_rows[i]);
+  }
+  builder->Finish(/*final_position=*/4);
+  auto sink = CreateOutputStream();
+  builder->WriteTo(sink.get());
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+}
+
+TEST(PageIndex, OffsetIndexRoundTrip) {
+  auto offset_index = MakeOffsetIndex({0, 10, 25});
+  const auto& pages = offset_index->page_locations();
+  ASSERT_EQ(3, pages.size());
+  for (size_t i = 0; i < pages.size(); ++i) {
+    ASSERT_EQ(static_cast<int64_t>(4 + 100 * i), pages[i].offset);
+    ASSERT_EQ(100, pages[i].compressed_page_size);
+  }
+  ASSERT_EQ(0, pages[0].first_row_index);
+  ASSERT_EQ(10, pages[1].first_row_index);
+  ASSERT_EQ(25, pages[2].first_row_index);
+}
+
+TEST(PageIndex, ColumnIndexRoundTrip) {
+  auto builder = ColumnIndexBuilder::Make();
+  EncodedStatistics stats;
+  stats.set_min("a").set_max("c").set_null_count(1);
+  builder->AddPage(stats, 10);
+  EncodedStatistics null_stats;
+  null_stats.set_null_count(5);
+  builder->AddPage(null_stats, 5);
+  ASSERT_TRUE(builder->valid());
+
+  auto sink = CreateOutputStream();
+  builder->WriteTo(sink.get());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto column_index =
+      ColumnIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  ASSERT_EQ(std::vector<bool>({false, true}), column_index->null_pages());
+  ASSERT_EQ(std::vector<std::string>({"a", ""}), column_index->encoded_min_values());
+  ASSERT_EQ(std::vector<std::string>({"c", ""}), column_index->encoded_max_values());
+  ASSERT_EQ(BoundaryOrder::UNORDERED, column_index->boundary_order());
+  ASSERT_TRUE(column_index->has_null_counts());
+  ASSERT_EQ(std::vector<int64_t>({1, 5}), column_index->null_counts());
+
+  // Pages without min and max values cannot be indexed
+  builder->AddPage(EncodedStatistics(), 10);
+  ASSERT_FALSE(builder->valid());
+}
+
+TEST(RowRanges, PageRowRanges) {
+  auto offset_index = MakeOffsetIndex({0, 10, 25, 40});
+  ASSERT_EQ(RowRanges({{10, 15}, {40, 10}}),
+            PageRowRanges(*offset_index, {false, true, false, true}, 50));
+  ASSERT_EQ(RowRanges({{0, 40}}),
+            PageRowRanges(*offset_index, {true, true, true, false}, 50));
+  ASSERT_EQ(RowRanges(), PageRowRanges(*offset_index, {false, false, false, false}, 50));
+}
+
+TEST(RowRanges, IntersectRowRanges) {
+  ASSERT_EQ(RowRanges(), IntersectRowRanges({}, {{0, 10}}));
+  ASSERT_EQ(RowRanges({{5, 5}}), IntersectRowRanges({{0, 10}}, {{5, 10}}));
+  ASSERT_EQ(RowRanges({{2, 3}, {8, 2}, {20, 1}}),
+            IntersectRowRanges({{0, 10}, {20, 5}}, {{2, 3}, {8, 13}}));
+  ASSERT_EQ(RowRanges(), IntersectRowRanges({{0, 10}}, {{10, 10}}));
+}
+
+TEST(RowRanges, AlignRowRanges) {
+  auto a = MakeOffsetIndex({0, 10, 20, 30, 40});
+  auto b = MakeOffsetIndex({0, 20, 35});
+  auto c = MakeOffsetIndex({0, 15, 35});
+
+  ASSERT_EQ(RowRanges({{10, 10}}), AlignRowRanges({{12, 3}}, {a.get()}, 50));
+  ASSERT_EQ(RowRanges({{0, 20}}), AlignRowRanges({{12, 3}}, {a.get(), b.get()}, 50));
+  // Ranges only end on page boundaries shared by all columns
+  ASSERT_EQ(RowRanges({{0, 50}}),
+            AlignRowRanges({{12, 3}}, {a.get(), MakeOffsetIndex({0, 25}).get()}, 50));
+  // Extending to the pages of c overlaps more pages of a and b
+  ASSERT_EQ(RowRanges({{0, 50}}),
+            AlignRowRanges({{30, 1}}, {a.get(), b.get(), c.get()}, 50));
+  // Unsorted and overlapping ranges are merged
+  ASSERT_EQ(RowRanges({{10, 20}, {40, 10}}),
+            AlignRowRanges({{45, 2}, {22, 2}, {12, 2}}, {a.get()}, 50));
+  ASSERT_EQ(RowRanges(), AlignRowRanges({}, {a.get()}, 50));
+}
+
+class TestPageIndexFile : public ::testing::Test {
+ public:
+  static constexpr int64_t kNumRows = 100;
+
+  // Write two INT64 columns with pages of 10 and 20 rows
+  std::shared_ptr<Buffer> WriteFile(bool write_page_index) {
+    NodePtr schema = GroupNode::Make(
+        "schema", Repetition::REQUIRED,
+        {PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT64),
+         PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::INT64)});
+    WriterProperties::Builder builder;
+    builder.disable_dictionary()->data_pagesize(1);
+    if (write_page_index) {
+      builder.enable_write_page_index();
+    }
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(
+        sink, std::static_pointer_cast<GroupNode>(schema), builder.build());
+    auto row_group_writer = file_writer->AppendRowGroup();
+
+    std::vector<int64_t> values(kNumRows);
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      values[i] = i;
+    }
+    std::vector<int16_t> def_levels(kNumRows, 1);
+    // Each WriteBatch() call fills a data page
+    auto writer_a = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+    for (int64_t i = 0; i < kNumRows; i += 10) {
+      writer_a->WriteBatch(10, nullptr, nullptr, values.data() + i);
+    }
+    auto writer_b = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+    for (int64_t i = 0; i < kNumRows; i += 20) {
+      writer_b->WriteBatch(20, def_levels.data(), nullptr, values.data() + i);
+    }
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    return buffer;
+  }
+
+  std::unique_ptr<ParquetFileReader> OpenFile(std::shared_ptr<Buffer> buffer) {
+    return ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(std::move(buffer)));
+  }
+
+  std::vector<int64_t> ReadColumn(const std::shared_ptr<RowGroupReader>& row_group,
+                                  int i) {
+    auto reader = std::static_pointer_cast<Int64Reader>(row_group->Column(i));
+    std::vector<int64_t> values(kNumRows);
+    std::vector<int16_t> def_levels(kNumRows);
+    int64_t total_values_read = 0;
+    // ReadBatch() does not read past the end of a data page
+    while (reader->HasNext()) {
+      int64_t values_read = 0;
+      reader->ReadBatch(kNumRows - total_values_read, def_levels.data(), nullptr,
+                        values.data() + total_values_read, &values_read);
+      total_values_read += values_read;
+    }
+    values.resize(total_values_read);
+    return values;
+  }
+
+  static std::vector<int64_t> Iota(int64_t first, int64_t count) {
+    std::vector<int64_t> values(count);
+    for (int64_t i = 0; i < count; ++i) {
+      values[i] = first + i;
+    }
+    return values;
+  }
+};
+
+TEST_F(TestPageIndexFile, WriteRead) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true));
+  auto row_group = file_reader->RowGroup(0);
+  auto col_a = row_group->metadata()->ColumnChunk(0);
+  ASSERT_TRUE(col_a->has_column_index());
+  ASSERT_TRUE(col_a->has_offset_index());
+
+  auto offset_index = row_group->GetOffsetIndex(0);
+  ASSERT_NE(nullptr, offset_index);
+  const auto& pages = offset_index->page_locations();
+  ASSERT_EQ(10, pages.size());
+  ASSERT_EQ(col_a->data_page_offset(), pages[0].offset);
+  for (size_t i = 0; i < pages.size(); ++i) {
+    ASSERT_EQ(static_cast<int64_t>(10 * i), pages[i].first_row_index);
+    if (i > 0) {
+      ASSERT_EQ(pages[i - 1].offset + pages[i - 1].compressed_page_size,
+                pages[i].offset);
+    }
+  }
+  ASSERT_EQ(5, row_group->GetOffsetIndex(1)->page_locations().size());
+
+  auto column_index = row_group->GetColumnIndex(1);
+  ASSERT_NE(nullptr, column_index);
+  ASSERT_EQ(5, column_index->null_pages().size());
+  for (int64_t i = 0; i < 5; ++i) {
+    int64_t min_value, max_value;
+    std::memcpy(&min_value, column_index->encoded_min_values()[i].data(),
+                sizeof(int64_t));
+    std::memcpy(&max_value, column_index->encoded_max_values()[i].data(),
+                sizeof(int64_t));
+    ASSERT_EQ(20 * i, min_value);
+    ASSERT_EQ(20 * i + 19, max_value);
+    ASSERT_EQ(0, column_index->null_counts()[i]);
+  }
+}
+
+TEST_F(TestPageIndexFile, SelectRows) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true));
+  // Rows 32 to 36 are in the second page of b, from row 20 to row 40
+  ASSERT_EQ(RowRanges({{20, 20}}), file_reader->SelectRows(0, {{32, 5}}, {0, 1}));
+  auto row_group = file_reader->RowGroup(0);
+  ASSERT_EQ(Iota(20, 20), ReadColumn(row_group, 0));
+  ASSERT_EQ(Iota(20, 20), ReadColumn(row_group, 1));
+
+  ASSERT_EQ(RowRanges({{0, 10}, {90, 10}}),
+            file_reader->SelectRows(0, {{95, 1}, {2, 3}}, {0}));
+  row_group = file_reader->RowGroup(0);
+  // Column b was not selected
+  ASSERT_THROW(row_group->Column(1), ParquetException);
+  std::vector<int64_t> expected = Iota(0, 10);
+  for (int64_t value : Iota(90, 10)) {
+    expected.push_back(value);
+  }
+  ASSERT_EQ(expected, ReadColumn(row_group, 0));
+
+  ASSERT_EQ(RowRanges(), file_reader->SelectRows(0, {}, {0, 1}));
+  ASSERT_EQ(std::vector<int64_t>(), ReadColumn(file_reader->RowGroup(0), 1));
+}
+
+TEST_F(TestPageIndexFile, SelectRowsOnlyAppliesToTheNextRead) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true));
+  ASSERT_EQ(RowRanges({{20, 20}}), file_reader->SelectRows(0, {{32, 5}}, {0, 1}));
+  ASSERT_EQ(Iota(20, 20), ReadColumn(file_reader->RowGroup(0), 0));
+  // The selection is kept until all the selected columns were read
+  ASSERT_EQ(Iota(20, 20), ReadColumn(file_reader->RowGroup(0), 1));
+
+  ASSERT_EQ(Iota(0, kNumRows), ReadColumn(file_reader->RowGroup(0), 0));
+  ASSERT_EQ(Iota(0, kNumRows), ReadColumn(file_reader->RowGroup(0), 1));
+}
+
+TEST_F(TestPageIndexFile, SelectRowsWithoutPageIndex) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/false));
+  auto row_group = file_reader->RowGroup(0);
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(0)->has_offset_index());
+  ASSERT_EQ(nullptr, row_group->GetColumnIndex(0));
+  ASSERT_EQ(nullptr, row_group->GetOffsetIndex(0));
+
+  // All rows are read
+  ASSERT_EQ(RowRanges({{0, kNumRows}}), file_reader->SelectRows(0, {{32, 5}}, {0, 1}));
+  ASSERT_EQ(Iota(0, kNumRows), ReadColumn(file_reader->RowGroup(0), 0));
+}
+
+}  // namespace parquet
@@ -24,6 +24,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/io/caching.h"
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
 #include "parquet/encryption.h"
@@ -85,6 +86,8 @@ ReaderProperties PARQUET_EXPORT default_reader_properties();
 static constexpr int64_t kDefaultDataPageSize = 1024 * 1024;
 static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
+static constexpr int64_t DEFAULT_DICTIONARY_SAMPLE_SIZE = 0;
+static constexpr double DEFAULT_DICTIONARY_MAX_DISTINCT_RATIO = 0.5;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
@@ -94,6 +97,20 @@ static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+
+/// \brief Sizing of the Bloom filters written for a column
+struct PARQUET_EXPORT BloomFilterOptions {
+  explicit BloomFilterOptions(int32_t ndv = DEFAULT_BLOOM_FILTER_NDV,
+                              double fpp = DEFAULT_BLOOM_FILTER_FPP)
+      : ndv(ndv), fpp(fpp) {}
+
+  /// Expected number of distinct values in a column chunk
+  int32_t ndv;
+  /// False positive probability at ndv distinct values
+  double fpp;
+};
 
 class PARQUET_EXPORT ColumnProperties {
  public:
@@ -107,7 +124,8 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(false) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -129,6 +147,14 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -141,6 +167,10 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const { return bloom_filter_options_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -148,6 +178,8 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  BloomFilterOptions bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -157,11 +189,14 @@ class PARQUET_EXPORT WriterProperties {
     Builder()
         : pool_(::arrow::default_memory_pool()),
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
+          dictionary_sample_size_(DEFAULT_DICTIONARY_SAMPLE_SIZE),
+          dictionary_max_distinct_ratio_(DEFAULT_DICTIONARY_MAX_DISTINCT_RATIO),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
           pagesize_(kDefaultDataPageSize),
           version_(DEFAULT_WRITER_VERSION),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          write_page_index_(false) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -202,6 +237,27 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Decide whether to dictionary-encode each column chunk from the
+    /// estimated number of distinct values among its first sample_size values
+    ///
+    /// Dictionary encoding is abandoned for the rest of the column chunk when
+    /// more than dictionary_max_distinct_ratio of the sampled values are
+    /// distinct, instead of only once the dictionary page size limit is
+    /// reached. The decision is taken before any value is encoded if the sample
+    /// is within the first write_batch_size() values written. 0, the default,
+    /// disables sampling.
+    Builder* dictionary_sample_size(int64_t sample_size) {
+      dictionary_sample_size_ = sample_size;
+      return this;
+    }
+
+    /// \brief The largest fraction of distinct sampled values for which
+    /// dictionary encoding is kept, see dictionary_sample_size()
+    Builder* dictionary_max_distinct_ratio(double ratio) {
+      dictionary_max_distinct_ratio_ = ratio;
+      return this;
+    }
+
     Builder* write_batch_size(int64_t write_batch_size) {
       write_batch_size_ = write_batch_size;
       return this;
@@ -227,11 +283,28 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Write the page index (ColumnIndex and OffsetIndex) of each column chunk
+    /// before the footer, letting readers skip data pages by their statistics,
+    /// see ParquetFileReader::SelectRows(). Not written for repeated columns
+    /// nor for encrypted files.
+    Builder* enable_write_page_index() {
+      write_page_index_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      write_page_index_ = false;
+      return this;
+    }
+
     /**
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
      * as the dictionary grew too large.
+     *
+     * DELTA_BINARY_PACKED only applies to INT32 and INT64 columns,
+     * DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY to BYTE_ARRAY columns.
      */
     Builder* encoding(Encoding::type encoding_type) {
       if (encoding_type == Encoding::PLAIN_DICTIONARY ||
@@ -373,6 +446,34 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write a Bloom filter of the values of each chunk of a column
+    ///
+    /// Readers can then rule out that a row group contains a value; see
+    /// RowGroupReader::GetColumnBloomFilter(). Bloom filters are not written
+    /// for boolean and encrypted columns.
+    Builder* enable_bloom_filter(
+        const std::string& path,
+        const BloomFilterOptions& options = BloomFilterOptions()) {
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(
+        const std::shared_ptr<schema::ColumnPath>& path,
+        const BloomFilterOptions& options = BloomFilterOptions()) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -391,21 +492,30 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
-          pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties));
+          pool_, dictionary_pagesize_limit_, dictionary_sample_size_,
+          dictionary_max_distinct_ratio_, write_batch_size_, max_row_group_length_,
+          pagesize_, version_, created_by_, write_page_index_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties));
     }
 
    private:
     MemoryPool* pool_;
     int64_t dictionary_pagesize_limit_;
+    int64_t dictionary_sample_size_;
+    double dictionary_max_distinct_ratio_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     std::string created_by_;
+    bool write_page_index_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -416,12 +526,20 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
 
   inline int64_t dictionary_pagesize_limit() const { return dictionary_pagesize_limit_; }
 
+  inline int64_t dictionary_sample_size() const { return dictionary_sample_size_; }
+
+  inline double dictionary_max_distinct_ratio() const {
+    return dictionary_max_distinct_ratio_;
+  }
+
   inline int64_t write_batch_size() const { return write_batch_size_; }
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
@@ -432,6 +550,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return write_page_index_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -479,6 +599,15 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -494,30 +623,37 @@ class PARQUET_EXPORT WriterProperties {
 
  private:
   explicit WriterProperties(
-      MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
+      MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t dictionary_sample_size,
+      double dictionary_max_distinct_ratio, int64_t write_batch_size,
       int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
-      const std::string& created_by,
+      const std::string& created_by, bool write_page_index,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
+        dictionary_sample_size_(dictionary_sample_size),
+        dictionary_max_distinct_ratio_(dictionary_max_distinct_ratio),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
         pagesize_(pagesize),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        write_page_index_(write_page_index),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
 
   MemoryPool* pool_;
   int64_t dictionary_pagesize_limit_;
+  int64_t dictionary_sample_size_;
+  double dictionary_max_distinct_ratio_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
   int64_t pagesize_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool write_page_index_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -535,18 +671,36 @@ static constexpr bool kArrowDefaultUseThreads = false;
 // Default number of rows to read when using ::arrow::RecordBatchReader
 static constexpr int64_t kArrowDefaultBatchSize = 64 * 1024;
 
+// Default number of record batches decoded ahead of the consumer of a
+// threaded ::arrow::RecordBatchReader
+static constexpr int32_t kArrowDefaultReadahead = 1;
+
+// Default size limit of the record batches decoded ahead
+static constexpr int64_t kArrowDefaultReadaheadBytes = 256 * 1024 * 1024;
+
 /// EXPERIMENTAL: Properties for configuring FileReader behavior.
 class PARQUET_EXPORT ArrowReaderProperties {
  public:
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        batch_size_(kArrowDefaultBatchSize),
+        readahead_(kArrowDefaultReadahead),
+        readahead_bytes_(kArrowDefaultReadaheadBytes),
+        pre_buffer_(false),
+        cache_options_(::arrow::io::CacheOptions::Defaults()) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
   bool use_threads() const { return use_threads_; }
 
+  /// \brief Read a column as dictionary-encoded Arrow data
+  ///
+  /// Only applies to columns read as int32, int64, float32, float64, binary,
+  /// string and fixed_size_binary. Dictionary-encoded column chunks are read
+  /// without decoding their values: their dictionary page becomes the
+  /// dictionary of the result, shared by consecutive row groups having equal
+  /// dictionaries.
   void set_read_dictionary(int column_index, bool read_dict) {
     if (read_dict) {
       read_dict_indices_.insert(column_index);
@@ -566,10 +720,52 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// \brief Number of record batches to decode ahead of the consumer
+  ///
+  /// When use_threads() is enabled, the ::arrow::RecordBatchReader decodes
+  /// the columns of its batches concurrently on the CPU thread pool, and
+  /// keeps decoding up to this number of batches while the previous ones
+  /// are consumed. 0 only decodes batches when they are requested. Batches
+  /// requested from a CPU thread pool worker, e.g. by a threaded dataset
+  /// scan, are decoded serially on that worker instead.
+  void set_readahead(int32_t readahead) { readahead_ = readahead; }
+
+  int32_t readahead() const { return readahead_; }
+
+  /// \brief Size limit of the record batches decoded ahead of the consumer
+  ///
+  /// Fewer batches than readahead() are decoded ahead when they are
+  /// estimated to exceed this size.
+  void set_readahead_bytes(int64_t readahead_bytes) {
+    readahead_bytes_ = readahead_bytes;
+  }
+
+  int64_t readahead_bytes() const { return readahead_bytes_; }
+
+  /// \brief Read the column chunks to decode ahead of time
+  ///
+  /// When enabled, the byte ranges of the selected columns of the selected
+  /// row groups are computed up front, nearby ranges are coalesced and all
+  /// of them are read concurrently on the I/O thread pool. This helps on
+  /// high latency filesystems such as S3, at the cost of holding the
+  /// compressed column chunks in memory while they are decoded.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// \brief How to coalesce reads when pre-buffering
+  void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
+
+  const ::arrow::io::CacheOptions& cache_options() const { return cache_options_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
+  int32_t readahead_;
+  int64_t readahead_bytes_;
+  bool pre_buffer_;
+  ::arrow::io::CacheOptions cache_options_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -587,7 +783,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           truncated_timestamps_allowed_(false),
           store_schema_(false),
           // TODO: At some point we should flip this.
-          compliant_nested_types_(false) {}
+          compliant_nested_types_(false),
+          use_threads_(kArrowDefaultUseThreads) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -634,10 +831,23 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of each row group in
+    /// parallel, using the global CPU thread pool
+    ///
+    /// Each row group is then buffered in memory until all its column chunks
+    /// are encoded, and written in column order. Ignored when the file is
+    /// encrypted. Column chunks written from a CPU thread pool worker are
+    /// encoded serially on that worker instead.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_, store_schema_, compliant_nested_types_));
+          truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
+          use_threads_));
     }
 
    private:
@@ -649,6 +859,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
     bool store_schema_;
     bool compliant_nested_types_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -669,18 +880,22 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// "element".
   bool compliant_nested_types() const { return compliant_nested_types_; }
 
+  /// \brief Whether the column chunks of a row group are encoded in parallel
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
-                                 bool compliant_nested_types)
+                                 bool compliant_nested_types, bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
-        compliant_nested_types_(compliant_nested_types) {}
+        compliant_nested_types_(compliant_nested_types),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -688,6 +903,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool truncated_timestamps_allowed_;
   const bool store_schema_;
   const bool compliant_nested_types_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
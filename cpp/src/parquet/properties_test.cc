@@ -65,6 +65,25 @@ TEST(TestWriterProperties, AdvancedHandling) {
             props->encoding(ColumnPath::FromDotString("delta-length")));
 }
 
+TEST(TestWriterProperties, BloomFilter) {
+  WriterProperties::Builder builder;
+  builder.enable_bloom_filter("a");
+  builder.enable_bloom_filter("b", BloomFilterOptions(/*ndv=*/1000, /*fpp=*/0.01));
+  builder.enable_bloom_filter("c")->disable_bloom_filter("c");
+  std::shared_ptr<WriterProperties> props = builder.build();
+
+  auto a = ColumnPath::FromDotString("a");
+  auto b = ColumnPath::FromDotString("b");
+  ASSERT_TRUE(props->bloom_filter_enabled(a));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_NDV, props->bloom_filter_options(a).ndv);
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_FPP, props->bloom_filter_options(a).fpp);
+  ASSERT_TRUE(props->bloom_filter_enabled(b));
+  ASSERT_EQ(1000, props->bloom_filter_options(b).ndv);
+  ASSERT_EQ(0.01, props->bloom_filter_options(b).fpp);
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("c")));
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("d")));
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";